@@ -33,6 +33,8 @@ win32:RC_ICONS = images/qblade.ico
 #QMAKE_CXXFLAGS += -fpermissive
 # fixes the "too many sections" issue when compiling debug build under windows
 win32:QMAKE_CXXFLAGS += -Wa,-mbig-ob
+# MinGW does not align the stack for spilled AVX registers, the SIMD Biot-Savart kernels need unaligned moves (binutils 2.38)
+win32:QMAKE_CXXFLAGS += -Wa,-muse-unaligned-vector-move
 
 #disable all warnings
 QMAKE_CXXFLAGS += -w
@@ -96,8 +98,10 @@ SOURCES += src/MainFrame.cpp \
     src/PolarModule/PolarMenu.cpp \
     src/PolarModule/PolarModule.cpp \
     src/PolarModule/PolarToolBar.cpp \
+    src/PolarModule/XFoilResultCache.cpp \
     src/IceThrowSimulation/IceParticle.cpp \
     src/ImportExport.cpp \
+    src/ParallelSweep.cpp \
     src/Main.cpp \
     src/Globals.cpp \
     src/GUI/EnvironmentDialog.cpp \
@@ -117,6 +121,7 @@ SOURCES += src/MainFrame.cpp \
     src/Waves/LinearWave.cpp \
     src/Waves/WaveCreatorDialog.cpp \
     src/Waves/WaveDock.cpp \
+    src/Waves/WaveKinematicsGrid.cpp \
     src/Waves/WaveMenu.cpp \
     src/Waves/WaveModule.cpp \
     src/Waves/WaveToolBar.cpp \
@@ -136,6 +141,7 @@ SOURCES += src/MainFrame.cpp \
     src/QBEM/CreateBEMDlg.cpp \
     src/QBEM/BladeScaleDlg.cpp \
     src/QBEM/BEMData.cpp \
+    src/QBEM/BEMSweep.cpp \
     src/QBEM/BEM.cpp \
     src/QBEM/Edit360PolarDlg.cpp \
     src/QBEM/BData.cpp \
@@ -155,12 +161,14 @@ SOURCES += src/MainFrame.cpp \
     src/QDMS/BladeScaleDlgVAWT.cpp \
     src/QDMS/CreateDMSDlg.cpp \
     src/QDMS/DMSData.cpp \
+    src/QDMS/DMSSweep.cpp \
     src/QDMS/DData.cpp \
     src/QDMS/TDMSData.cpp \
     src/QDMS/DMSSimDock.cpp \
     src/QDMS/DMSDock.cpp \
     src/QDMS/CDMSData.cpp \
     src/Windfield/WindField.cpp \
+    src/Windfield/WindFieldStorage.cpp \
     src/XWidgets.cpp \
     src/Windfield/WindFieldModule.cpp \
     src/Module.cpp \
@@ -191,6 +199,7 @@ SOURCES += src/MainFrame.cpp \
     src/Serializer.cpp \
     src/StoreAssociatedComboBox.cpp \
     src/GlobalFunctions.cpp \
+    src/SpectralAnalysis.cpp \
     src/GUI/SignalBlockerInterface.cpp \
     src/Graph/NewGraph.cpp \
     src/Graph/Axis.cpp \
@@ -205,6 +214,7 @@ SOURCES += src/MainFrame.cpp \
     src/TwoDContextMenu.cpp \
     src/GUI/FixedSizeLabel.cpp \
     src/QBladeApplication.cpp \
+    src/QBladeBatchRunner.cpp \
     src/VortexObjects/VortexNode.cpp \
     src/VortexObjects/VortexLine.cpp \
     src/VortexObjects/DummyLine.cpp \
@@ -251,11 +261,14 @@ SOURCES += src/MainFrame.cpp \
     src/StructModel/ChBodyAddedMass.cpp \
     src/StructModel/ChNodeFEAxyzrotAddedMass.cpp \
     src/StructModel/ChVariablesBodyAddedMass.cpp \
+    src/StructModel/ChSolverSparseLUReuse.cpp \
     src/QBEM/AFC.cpp \
     src/QBEM/DynPolarSet.cpp \
     src/QBEM/DynPolarSetDialog.cpp \
     src/QBEM/FlapCreatorDialog.cpp \
     src/VortexObjects/VortexParticle.cpp \
+    src/VortexObjects/VortexLineArrays.cpp \
+    src/VortexObjects/BiotSavartKernels.cpp \
     src/StructModel/PID.cpp \
     src/QControl/QControl.cpp \
     src/StructModel/CoordSys.cpp \
@@ -269,12 +282,14 @@ SOURCES += src/MainFrame.cpp \
     src/QSimulation/QSimulation.cpp \
     src/QSimulation/QSimulationCreatorDialog.cpp \
     src/StructModel/StrModel.cpp \
+    src/StructModel/PotentialFlowCache.cpp \
     src/StructModel/StrObjects.cpp \
     src/QTurbine/QTurbineSimulationData.cpp \
     src/QTurbine/QTurbineResults.cpp \
     src/QTurbine/QTurbineGlRendering.cpp \
     src/OpenCLSetup.cpp \
     src/QSimulation/QVelocityCutPlane.cpp \
+    src/QSimulation/ResultStreamWriter.cpp \
     src/QBEM/Interpolate360PolarsDlg.cpp \
     src/BinaryProgressDialog.cpp \
     src/Windfield/WindFieldTwoDContextMenu.cpp \
@@ -282,6 +297,7 @@ SOURCES += src/MainFrame.cpp \
     src/VPML/ML_Box.cpp \
     src/VPML/ML_Euler.cpp \
     src/VPML/Particle_Grid.cpp \
+    src/VPML/Vortex_Treecode.cpp \
     src/QTurbine/QTurbineMenu.cpp
 
 HEADERS += src/MainFrame.h \
@@ -298,8 +314,10 @@ HEADERS += src/MainFrame.h \
     src/PolarModule/PolarMenu.h \
     src/PolarModule/PolarModule.h \
     src/PolarModule/PolarToolBar.h \
+    src/PolarModule/XFoilResultCache.h \
     src/IceThrowSimulation/IceParticle.h \
     src/ImportExport.h \
+    src/ParallelSweep.h \
     src/GUI/EnvironmentDialog.h \
     src/Params.h \
     src/Globals.h \
@@ -319,6 +337,7 @@ HEADERS += src/MainFrame.h \
     src/Waves/LinearWave.h \
     src/Waves/WaveCreatorDialog.h \
     src/Waves/WaveDock.h \
+    src/Waves/WaveKinematicsGrid.h \
     src/Waves/WaveMenu.h \
     src/Waves/WaveModule.h \
     src/Waves/WaveToolBar.h \
@@ -340,6 +359,7 @@ HEADERS += src/MainFrame.h \
     src/QBEM/CreateBEMDlg.h \
     src/QBEM/BladeScaleDlg.h \
     src/QBEM/BEMData.h \
+    src/QBEM/BEMSweep.h \
     src/QBEM/BEM.h \
     src/QBEM/Edit360PolarDlg.h \
     src/QBEM/BData.h \
@@ -358,12 +378,14 @@ HEADERS += src/MainFrame.h \
     src/QDMS/BladeScaleDlgVAWT.h \
     src/QDMS/CreateDMSDlg.h \
     src/QDMS/DMSData.h \
+    src/QDMS/DMSSweep.h \
     src/QDMS/DData.h \
     src/QDMS/TDMSData.h \
     src/QDMS/DMSSimDock.h \
     src/QDMS/DMSDock.h \
     src/QDMS/CDMSData.h \
     src/Windfield/WindField.h \
+    src/Windfield/WindFieldStorage.h \
     src/XWidgets.h \
     src/Windfield/WindFieldModule.h \
     src/Module.h \
@@ -396,6 +418,7 @@ HEADERS += src/MainFrame.h \
     src/Store_include.h \
     src/StorableObject_heirs.h \
     src/GlobalFunctions.h \
+    src/SpectralAnalysis.h \
     src/GUI/SignalBlockerInterface.h \
     src/Graph/NewGraph.h \
     src/Graph/Axis.h \
@@ -410,6 +433,7 @@ HEADERS += src/MainFrame.h \
     src/TwoDContextMenu.h \
     src/GUI/FixedSizeLabel.h \
     src/QBladeApplication.h \
+    src/QBladeBatchRunner.h \
     src/VortexObjects/VortexNode.h \
     src/VortexObjects/VortexLine.h \
     src/VortexObjects/DummyLine.h \
@@ -457,12 +481,17 @@ HEADERS += src/MainFrame.h \
     src/StructModel/ChBodyAddedMass.h \
     src/StructModel/ChNodeFEAxyzrotAddedMass.h \
     src/StructModel/ChVariablesBodyAddedMass.h \
+    src/StructModel/ChSolverSparseLUReuse.h \
     src/StructModel/StrLoads.h \
     src/QBEM/AFC.h \
     src/QBEM/DynPolarSet.h \
     src/QBEM/DynPolarSetDialog.h \
     src/QBEM/FlapCreatorDialog.h \
     src/VortexObjects/VortexParticle.h \
+    src/VortexObjects/VortexLineArrays.h \
+    src/VortexObjects/BiotSavartKernels.h \
+    src/VortexObjects/BiotSavartKernelsSIMD.h \
+    src/VortexObjects/VortexPool.h \
     src/StructModel/PID.h \
     src/QControl/QControl.h \
     src/StructModel/CoordSys.h \
@@ -476,6 +505,7 @@ HEADERS += src/MainFrame.h \
     src/QSimulation/QSimulation.h \
     src/QSimulation/QSimulationCreatorDialog.h \
     src/StructModel/StrModel.h \
+    src/StructModel/PotentialFlowCache.h \
     src/StructModel/StrObjects.h \
     src/QTurbine/QTurbineSimulationData.h \
     src/QTurbine/QTurbineResults.h \
@@ -483,6 +513,7 @@ HEADERS += src/MainFrame.h \
     src/QSimulation/QSimulationThread.h \
     src/OpenCLSetup.h \
     src/QSimulation/QVelocityCutPlane.h \
+    src/QSimulation/ResultStreamWriter.h \
     src/QBEM/Interpolate360PolarsDlg.h \
     src/BinaryProgressDialog.h \
     src/Windfield/WindFieldTwoDContextMenu.h \
@@ -496,6 +527,7 @@ HEADERS += src/MainFrame.h \
     src/VPML/Particle_Grid.h \
     src/VPML/Tree_Methods.h \
     src/VPML/VPML_Gobal_Vars.h \
+    src/VPML/Vortex_Treecode.h \
     src/QTurbine/QTurbineMenu.h
 
 #here a few usefull files and required binaries are automatically copied to the build directory
@@ -22,6 +22,9 @@
 #include <QRadioButton>
 #include "Globals.h"
 #include "MainFrame.h"
+#include "Store.h"
+#include "QBEM/Polar360.h"
+#include "VortexObjects/BiotSavartKernels.h"
 
 void redirectOutputToDialog(QtMsgType type, const QMessageLogContext &context, const QString &msg)
 {
@@ -49,6 +52,8 @@ DebugDialog::DebugDialog()
     QHBoxLayout *hBox = new QHBoxLayout ();
 
     QPushButton *clearButton = new QPushButton(tr("Clear Output"));
+    QPushButton *benchmarkButton = new QPushButton(tr("Benchmark Polar Lookup"));
+    QPushButton *kernelButton = new QPushButton(tr("Check Biot-Savart Kernels"));
 
     QRect rec = QApplication::desktop()->screenGeometry();
     int width = rec.width();
@@ -107,12 +112,16 @@ DebugDialog::DebugDialog()
     vBox->addWidget(textEdit);
     vBox->addLayout(hBox);
     hBox->addWidget(clearButton);
+    hBox->addWidget(benchmarkButton);
+    hBox->addWidget(kernelButton);
     hBox->addStretch();
     hBox->addWidget(closeButton);
     closeButton->setAutoDefault(true);
 
     connect (closeButton,SIGNAL(clicked()), this,SLOT(hide()));
     connect (clearButton,SIGNAL(clicked()), this,SLOT(ClearEdit()));
+    connect (benchmarkButton,SIGNAL(clicked()), this,SLOT(OnBenchmarkPolarLookup()));
+    connect (kernelButton,SIGNAL(clicked()), this,SLOT(OnCheckBiotSavartKernels()));
 }
 
 void DebugDialog::OnRedirectOutput(){
@@ -142,3 +151,19 @@ void DebugDialog::ClearEdit(){
     textEdit->clear();
 }
 
+void DebugDialog::OnBenchmarkPolarLookup(){
+
+    if (!g_360PolarStore.size()){
+        textEdit->append("No 360 polars in the database to benchmark");
+        return;
+    }
+
+    for (int i=0;i<g_360PolarStore.size();i++)
+        textEdit->append(Polar360::BenchmarkLookup(g_360PolarStore.at(i)));
+}
+
+void DebugDialog::OnCheckBiotSavartKernels(){
+
+    textEdit->append("Biot-Savart kernels in use: "+getBiotSavartISAName(getBiotSavartISA()));
+    textEdit->append(checkBiotSavartKernels());
+}
@@ -40,6 +40,8 @@ private slots:
     void OnBoxChecked();
     void ClearEdit();
     void OnRedirectOutput();
+    void OnBenchmarkPolarLookup();
+    void OnCheckBiotSavartKernels();
 
 };
 
@@ -25,6 +25,8 @@
 #include <QFileDialog>
 #include <QProcess>
 #include <QUuid>
+#include <QStandardPaths>
+#include <QDateTime>
 
 #include "Store.h"
 #include "Params.h"
@@ -36,6 +38,7 @@
 #include "XWidgets.h"
 #include "src/ColorManager.h"
 #include "src/ImportExport.h"
+#include "src/SpectralAnalysis.h"
 
 #include "QBEM/Polar360.h"
 #include "FoilModule/Airfoil.h"
@@ -238,6 +241,52 @@ QString UpdateLastDirName(QString fileName){
     return fileName.left(pos);
 }
 
+QString GetUserCacheDirectory(QString name){
+
+    // the same location for the GUI and the batch mode (which runs without application and organization name),
+    // falls back to the system temp dir if no cache location is available
+
+    QString base = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    if (base.isEmpty()) base = QDir::tempPath();
+
+    return QDir(base).absoluteFilePath("QBlade" + QString(QDir::separator()) + name);
+}
+
+void TouchCacheFile(QString fileName){
+
+    // the modification time marks the last use of a cache file for the eviction
+
+    QFile file(fileName);
+    if (file.open(QIODevice::ReadWrite))
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+}
+
+qint64 EvictCacheFiles(QString directory, QStringList nameFilters, double maxSizeMB, double reserveMB){
+
+    // removes the least recently used files until the cache, plus an entry of reserveMB that is about to be
+    // written, fits into maxSizeMB; files that are still mapped or opened by another process may fail to be
+    // removed and are skipped. Returns the size of the remaining files in bytes.
+
+    QDir dir(directory);
+    if (!dir.exists()) return 0;
+
+    QFileInfoList files = dir.entryInfoList(nameFilters, QDir::Files, QDir::Time | QDir::Reversed);
+
+    qint64 totalSize = 0;
+    for (int i=0;i<files.size();i++) totalSize += files.at(i).size();
+
+    const qint64 maxSize = qint64((maxSizeMB - reserveMB) * 1024.0 * 1024.0);
+
+    for (int i=0;i<files.size() && totalSize > maxSize;i++){
+        if (QFile::remove(files.at(i).absoluteFilePath())){
+            totalSize -= files.at(i).size();
+            if (debugStores) qDebug().noquote() << "...evicted cache file" << files.at(i).absoluteFilePath();
+        }
+    }
+
+    return totalSize;
+}
+
 QStringList FileContentToQStringList(QString filename, bool giveWarning){
     QStringList list;
     list.clear();
@@ -839,10 +888,17 @@ QString SerializeQBladeProject(QDataStream &ar, bool isStoring, QString ident, b
     if (isStoring) {
         g_serializer.setMode(Serializer::WRITE);
         g_serializer.setArchiveFormat(VERSIONNUMBER);  //
-        g_serializer.writeInt(g_serializer.getArchiveFormat()); // * 310005 : added propeller data
+        g_serializer.writeInt(g_serializer.getArchiveFormat()); // * 310012 : DMS iterations and computation time
         g_serializer.writeInt(11229944);
         g_serializer.readOrWriteBool(&uintRes);
         g_serializer.readOrWriteBool(&uintVortexWake);
+        // 310011 : stored treecode settings
+        // 310010 : multi-rate aero coupling
+        // 310009 : block compressed results
+        // 310008 : added result streaming
+        // 310007 : added blade output selection
+        // 310006 : added wave kinematics grid
+        // 310005 : added propeller data
         // 310004 : added offshore dlc data
         // 310003 : added wind field shift
         // 310002 : added custom spectrum for waves
@@ -1519,93 +1575,43 @@ void ConstrainAngle_180_180_Radian(float &ang){
     ang -= PI_;
 }
 
-void CalculatePSD(QVector<float> *data, QVector<float> &xResult, QVector<float> &yResult, double dT){
-
-    int size = data->size();
-
-    if (size > 200){
+void CalculateFFT(QVector<std::complex<double> > &data, bool inverse){
 
-        int resSize = size/2+1;
+    // in-place discrete fourier transform of arbitrary length: X_k = sum_n x_n exp(-+ 2 pi i k n / N)
+    // powers of two are transformed directly, all other lengths with Bluestein's chirp-z algorithm,
+    // the plans are cached per length (see SpectralAnalysis.h); the inverse transform is not normalized
 
-        float *RE = new float[resSize];
-        float *IM = new float[resSize];
+    if (data.size() < 2) return;
 
+    FFTPlan::getPlan(data.size())->Transform(data.data(), inverse);
+}
 
-        // initialize REX[] and IMX[] so they can be used as accumulators
-        for (int k = 0; k < resSize; k++)
-        {
-            RE[k] = 0;
-            IM[k] = 0;
-        }
-
-        // loop through each sample in the frequency domain
-        #pragma omp parallel default (none) shared (data,RE,IM,size,resSize)
-        {
-        #pragma omp for
-            for (int k = 0; k < resSize; k++){
-                // loop through each sample in the time domain
-                for (int l = 0; l < size; l++){
-                    float arg = float(2.0f*PI_*k*l/size);
-                    RE[k] += data->at(l) * cos(arg);
-                    IM[k] += -data->at(l) * sin(arg);
-                }
-            }
-        }
-
-        double dF = 1./dT;
+void CalculatePSD(QVector<float> *data, QVector<float> &xResult, QVector<float> &yResult, double dT){
 
-        for (int k=1;k<resSize;k++){
-            yResult.append(RE[k]*RE[k]+IM[k]*IM[k]*2.0*2.0/size/size);
-            xResult.append(float(k)*dF/(size));
-        }
+    // Welch estimate of the one-sided PSD, Hann window, 50% overlap and 8 segments
 
-        delete [] RE;
-        delete [] IM;
-    }
+    if (data->size() > 200) CalculateWelchPSD(data->constData(), data->size(), dT, xResult, yResult);
 }
 
 void CalculatePSD2(QVector<float> *data, QVector<float> &freq, QVector<float> &amp, QVector<float> &phase, double dT){
 
+    // amplitude and phase spectrum of the full signal (no windowing), used to decompose a time series into wave trains
+
     int size = data->size();
 
     if (size > 200){
 
-        int resSize = size/2+1;
-
-        float *RE = new float[resSize];
-        float *IM = new float[resSize];
-
-
-        // initialize REX[] and IMX[] so they can be used as accumulators
-        for (int k = 0; k < resSize; k++)
-        {
-            RE[k] = 0;
-            IM[k] = 0;
-        }
+        QVector<std::complex<double> > spectrum(size);
+        for (int l = 0; l < size; l++) spectrum[l] = std::complex<double>(data->at(l), 0);
 
-        // loop through each sample in the frequency domain
-        #pragma omp parallel default (none) shared (data,RE,IM,size,resSize)
-        {
-        #pragma omp for
-            for (int k = 0; k < resSize; k++){
-                // loop through each sample in the time domain
-                for (int l = 0; l < size; l++){
-                    float arg = float(2.0f*PI_*k*l/size);
-                    RE[k] += data->at(l) * cos(arg);
-                    IM[k] += -data->at(l) * sin(arg);
-                }
-            }
-        }
+        CalculateFFT(spectrum);
 
         double dF = 1./dT;
 
-        for (int k=1;k<resSize;k++){
-            amp.append(sqrt(RE[k]*RE[k]+IM[k]*IM[k])/size*2);
-            phase.append(atan2(-IM[k],RE[k]));
+        for (int k=1;k<size/2+1;k++){
+            amp.append(std::abs(spectrum.at(k))/size*2);
+            phase.append(atan2(-spectrum.at(k).imag(),spectrum.at(k).real()));
             freq.append(float(k)*dF/(size));
         }
-
-        delete [] RE;
-        delete [] IM;
     }
 }
@@ -21,6 +21,8 @@
 #include <QString>
 #include <QTextStream>
 #include <QFile>
+#include <QVector>
+#include <complex>
 #include "Eigen/Core"
 
 class Airfoil;
@@ -40,6 +42,7 @@ QList< QList<double> > FindNumericDataTable(QString value, QStringList File, int
 QList< QList<double> > FindNumericValuesInFile(int minColCount, QStringList File, QString *error_msg = NULL, QString FileName = "");
 QList< QStringList > FindDlcTableInFile(int colCount, QStringList File, bool allowAuto, QString *error_msg = NULL, QString FileName = "");
 
+void CalculateFFT(QVector<std::complex<double> > &data, bool inverse = false);
 void CalculatePSD(QVector<float> *data, QVector<float> &xResult, QVector<float> &yResult, double dT);
 void CalculatePSD2(QVector<float> *data, QVector<float> &freq, QVector<float> &amp, QVector<float> &phase, double dT);
 void ConstrainAngle_0_360_Degree(double &ang);
@@ -58,6 +61,11 @@ void ReadFileToStream(QString &fileName, QStringList &stream, bool updateLastDir
 
 QString UpdateLastDirName(QString fileName);
 
+// persistent per-user caches, outside of the application and Temp directories
+QString GetUserCacheDirectory(QString name);
+void TouchCacheFile(QString fileName);
+qint64 EvictCacheFiles(QString directory, QStringList nameFilters, double maxSizeMB, double reserveMB = 0);
+
 // store related functions
 void serializeAllStoresPublic(QString ident = "");
 void sortAllStores();
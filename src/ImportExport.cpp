@@ -34,6 +34,7 @@
 #include "Windfield/WindField.h"
 #include "StructModel/StrModel.h"
 #include "QSimulation/QVelocityCutPlane.h"
+#include "Waves/WaveKinematicsGrid.h"
 #include "src/ColorManager.h"
 
 #include "Globals.h"
@@ -684,7 +685,6 @@ void ExportSimulationDefinition(QSimulation *sim, QList<QTurbine *> turbList, QS
             stream << QString(indent+QString().number(turbList.at(i)->m_DemandedOmega / 2.0 / PI_ * 60,'f',3)).leftJustified(padding,' ')<<QString(" RPMPRESCRIBED").leftJustified(padding2,' ')<<"- the prescribed rotor RPM [-]"<<endl;
             stream << QString(indent+QString().number(turbList.at(i)->m_integrationType,'f',0)).leftJustified(padding,' ')<<QString(" TINTEGRATOR").leftJustified(padding2,' ')<<"- the time integrator for the structural sim (0 = HHT; 1 = linEuler; 2 = projEuler; 3 = Euler)"<<endl;
             stream << QString(indent+QString().number(turbList.at(i)->m_structuralIterations,'f',0)).leftJustified(padding,' ')<<QString(" STRITERATIONS").leftJustified(padding2,' ')<<"- number of iterations for the time integration (used when integrator is HHT or Euler)"<<endl;
-            stream << QString(indent+QString().number(0,'f',0)).leftJustified(padding,' ')<<QString(" MODNEWTONITER").leftJustified(padding2,' ')<<"- use the modified newton iteration?"<<endl;
             stream << QString(indent+QString().number(turbList.at(i)->m_globalPosition.x,'f',2)).leftJustified(padding,' ')<<QString(" GLOBPOS_X").leftJustified(padding2,' ')<<"- the global x-position of the turbine [m]"<<endl;
             stream << QString(indent+QString().number(turbList.at(i)->m_globalPosition.y,'f',2)).leftJustified(padding,' ')<<QString(" GLOBPOS_Y").leftJustified(padding2,' ')<<"- the global y-position of the turbine [m]"<<endl;
             stream << QString(indent+QString().number(posZ,'f',2)).leftJustified(padding,' ')<<QString(" GLOBPOS_Z").leftJustified(padding2,' ')<<"- the global z-position of the turbine [m]"<<endl;
@@ -714,7 +714,13 @@ void ExportSimulationDefinition(QSimulation *sim, QList<QTurbine *> turbList, QS
     stream << QString().number(sim->m_precomputeTime,'f',3).leftJustified(padding,' ')<<QString(" RAMPUP").leftJustified(padding2,' ')<<"- the rampup time for the structural model"<<endl;
     stream << QString().number(sim->m_addedDampingTime,'f',3).leftJustified(padding,' ')<<QString(" ADDDAMP").leftJustified(padding2,' ')<<"- the initial time with additional damping"<<endl;
     stream << QString().number(sim->m_addedDampingFactor,'f',3).leftJustified(padding,' ')<<QString(" ADDDAMPFACTOR").leftJustified(padding2,' ')<<"- for the additional damping time this factor is used to increase the damping of all components"<<endl;
-    stream << QString().number(sim->m_wakeInteractionTime,'f',3).leftJustified(padding,' ')<<QString(" WAKEINTERACTION").leftJustified(padding2,' ')<<"- in case of multi-turbine simulation the wake interaction start at? [s]"<<endl<<endl;    
+    stream << QString().number(sim->m_wakeInteractionTime,'f',3).leftJustified(padding,' ')<<QString(" WAKEINTERACTION").leftJustified(padding2,' ')<<"- in case of multi-turbine simulation the wake interaction start at? [s]"<<endl;
+    stream << QString().number(sim->m_aeroCouplingType,'f',0).leftJustified(padding,' ')<<QString(" AEROCOUPLING").leftJustified(padding2,' ')<<"- the aero loads over the structural substeps: 0 = held constant, 1 = extrapolated from the last aero timesteps"<<endl;
+    stream << QString().number(sim->m_aeroCouplingLimit,'f',3).leftJustified(padding,' ')<<QString(" AEROCOUPLINGLIMIT").leftJustified(padding2,' ')<<"- the max. extrapolated load increment, relative to the last aero load [-]"<<endl;
+    stream << QString().number(sim->m_bTreecodeInduction,'f',0).leftJustified(padding,' ')<<QString(" TREECODE").leftJustified(padding2,' ')<<"- use the treecode wake induction for command line and batch runs on the CPU: 0 = off, 1 = on"<<endl;
+    stream << QString().number(sim->m_treecodeTheta,'f',3).leftJustified(padding,' ')<<QString(" TREECODETHETA").leftJustified(padding2,' ')<<"- the opening angle of the treecode, smaller values are more accurate [-]"<<endl;
+    stream << QString().number(sim->m_treecodeOrder,'f',0).leftJustified(padding,' ')<<QString(" TREECODEORDER").leftJustified(padding2,' ')<<"- the expansion order of the treecode: 0 = monopole, 1 = dipole, 2 = quadrupole"<<endl;
+    stream << QString().number(sim->m_bTreecodeCheck,'f',0).leftJustified(padding,' ')<<QString(" TREECODECHECK").leftJustified(padding2,' ')<<"- compare the treecode against the direct sum and store the errors: 0 = off, 1 = on"<<endl<<endl;
     stream << "----------------------------------------Wind Input-----------------------------------------------------------------"<<endl;
     stream << QString().number(sim->m_windInputType,'f',0).leftJustified(padding,' ')<<QString(" WNDTYPE").leftJustified(padding2,' ')<<"- use a number: 0 = steady; 1 = windfield; 2 = hubheight"<<endl;
     stream << QString(windName).leftJustified(padding,' ')<<QString(" WNDNAME").leftJustified(padding2,' ')<<"- filename of the turbsim input file or hubheight file (with extension), leave blank if unused"<<endl;
@@ -734,6 +740,12 @@ void ExportSimulationDefinition(QSimulation *sim, QList<QTurbine *> turbList, QS
     stream << QString().number(sim->m_waterDepth,'f',2).leftJustified(padding,' ')<<QString(" WATERDEPTH").leftJustified(padding2,' ')<<"- the water depth"<<endl;
     stream << QString(waveName).leftJustified(padding,' ')<<QString(" WAVEFILE").leftJustified(padding2,' ')<<"- the path to the wave file, leave blank if unused"<<endl;
     stream << QString().number(sim->m_waveStretchingType,'f',0).leftJustified(padding,' ')<<QString(" WAVESTRETCHING").leftJustified(padding2,' ')<<"- the type of wavestretching, 0 = vertical, 1 = wheeler, 2 = extrapolation, 3 = none"<<endl;
+    stream << QString().number(sim->m_bUseWaveGrid,'f',0).leftJustified(padding,' ')<<QString(" WAVEGRID").leftJustified(padding2,' ')<<"- precompute the wave kinematics on a grid around the substructure: 0 = off, 1 = on"<<endl;
+    stream << QString().number(sim->m_waveGridSpacing,'f',2).leftJustified(padding,' ')<<QString(" WAVEGRIDDXY").leftJustified(padding2,' ')<<"- the horizontal spacing of the wave kinematics grid [m]"<<endl;
+    stream << QString().number(sim->m_waveGridVerticalSpacing,'f',2).leftJustified(padding,' ')<<QString(" WAVEGRIDDZ").leftJustified(padding2,' ')<<"- the vertical spacing of the wave kinematics grid [m]"<<endl;
+    stream << QString().number(sim->m_waveGridTimestep,'f',3).leftJustified(padding,' ')<<QString(" WAVEGRIDDT").leftJustified(padding2,' ')<<"- the timestep of the wave kinematics grid [s]"<<endl;
+    stream << QString().number(sim->m_waveGridInterpolation,'f',0).leftJustified(padding,' ')<<QString(" WAVEGRIDINTERP").leftJustified(padding2,' ')<<"- the interpolation in the wave kinematics grid: 0 = linear, 1 = cubic"<<endl;
+    stream << QString().number(sim->m_waveGridErrorBound,'f',4).leftJustified(padding,' ')<<QString(" WAVEGRIDERROR").leftJustified(padding2,' ')<<"- the max. relative error of the grid, checked against the exact kinematics; if exceeded the grid is not used [-]"<<endl;
     stream << QString().number(sim->m_seabedStiffness,'f',2).leftJustified(padding,' ')<<QString(" SEABEDSTIFF").leftJustified(padding2,' ')<<"- the vertical seabed stiffness [N/m^3]"<<endl;
     stream << QString().number(sim->m_seabedDampFactor,'f',2).leftJustified(padding,' ')<<QString(" SEABEDDAMP").leftJustified(padding2,' ')<<"- a damping factor for the vertical seabed stiffness evaluation, between 0 and 1 [-]"<<endl;
     stream << QString().number(sim->m_seabedShearFactor,'f',2).leftJustified(padding,' ')<<QString(" SEABEDSHEAR").leftJustified(padding2,' ')<<"- a factor for the evaluation of shear forces (friction), between 0 and 1 [-]"<<endl;
@@ -761,6 +773,13 @@ void ExportSimulationDefinition(QSimulation *sim, QList<QTurbine *> turbList, QS
     stream << QString().number(sim->m_bStoreStructuralData,'f',0).leftJustified(padding,' ')<<QString(" STORESTRUCT").leftJustified(padding2,' ')<<"- should the structural data be stored (0 = OFF; 1 = ON)"<<endl;
     stream << QString().number(sim->m_bStoreHydroData,'f',0).leftJustified(padding,' ')<<QString(" STOREHYDRO").leftJustified(padding2,' ')<<"- should the controller data be stored (0 = OFF; 1 = ON)"<<endl;
     stream << QString().number(sim->m_bStoreControllerData,'f',0).leftJustified(padding,' ')<<QString(" STORECONTROLLER").leftJustified(padding2,' ')<<"- should the controller data be stored (0 = OFF; 1 = ON)"<<endl;
+    stream << QString(sim->m_streamFileName).leftJustified(padding,' ')<<QString(" STREAMFILE").leftJustified(padding2,' ')<<"- the results are streamed to HAWC2 binary files (name_0001.sel/.dat, ...) during the simulation, leave blank if unused"<<endl;
+    stream << QString().number(sim->m_streamWindow,'f',0).leftJustified(padding,' ')<<QString(" STREAMWINDOW").leftJustified(padding2,' ')<<"- when streaming, only this number of timesteps (and replay frames) is kept in memory (0 = keep all)"<<endl;
+    if (sim->m_bladeOutputChannels.size()){
+        stream << "BLADE_OUTPUTS"<<endl;
+        for (int i=0;i<sim->m_bladeOutputChannels.size();i++) stream << sim->m_bladeOutputChannels.at(i)<<endl;
+        stream << "END_BLADE_OUTPUTS"<<endl;
+    }
     stream << "----------------------------------------Modal Analysis Parameters--------------------------------------------------"<<endl;
     stream << QString().number(sim->m_bModalAnalysis,'f',0).leftJustified(padding,' ')<<QString(" CALCMODAL").leftJustified(padding2,' ')<<"- perform a modal analysis after the simulation has completed (only for single turbine simulations)"<<endl;
     stream << QString().number(sim->m_minFreq,'f',5).leftJustified(padding,' ')<<QString(" MINFREQ").leftJustified(padding2,' ')<<"- store Eigenvalues, starting with this frequency"<<endl;
@@ -1258,6 +1277,8 @@ QSimulation* ImportSimulationDefinition(QString fileName, bool skip, bool remove
     QString windName, simName, waveName = "", mooringName;
     double windspeed, hangle, vangle, shear, roughness, dirShear, density, viscosity, densityWater, viscosityWater, gravity, rampup, timestep, storeFrom, refHeight, adddamp, adddampFactor, wakeinteraction;
     int windType, profileType, numTimesteps, storeReplay, storeAero, storeBlade, storeStruct, storeController, storeHydro, isoffshore, stretchingType = 0, ismodal;
+    int waveGrid = 0, waveGridInterp = WAVEGRID_CUBIC;
+    double waveGridDX = 4, waveGridDZ = 2, waveGridDT = 0.1, waveGridError = 0.02;
     double waterdepth = 1, surfu = 0, surfdir = 0, surfdepth = 30, subu = 0, subdir = 0, subexp = 0.14, shoreu = 0, shoredir = 0, minfreq, deltafreq, seastiff, seadamp, seashear, shifttime;
     bool ismirror, isshift;
 
@@ -1426,15 +1447,6 @@ QSimulation* ImportSimulationDefinition(QString fileName, bool skip, bool remove
                 }
             }
 
-//            value = "MODNEWTONITER";
-//            strong = FindValueInFile(value,turbSegment,&error_msg, true, &found);
-//            if (found){
-//                params.modNewton = strong.toInt(&converted);
-//                if(!converted){
-//                    error_msg.append("\n"+value+" could not be converted");
-//                }
-//            }
-
             value = "GLOBPOS_X";
             strong = FindValueInFile(value,turbSegment,&error_msg, true, &found);
             if (found){
@@ -1717,6 +1729,63 @@ QSimulation* ImportSimulationDefinition(QString fileName, bool skip, bool remove
         }
         if (stretchingType > NOSTRETCHING) stretchingType = NOSTRETCHING;
 
+        // the wave kinematics grid is optional, older simulation files do not contain these keywords
+
+        value = "WAVEGRID";
+        strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+        if (found){
+            waveGrid = int(strong.toDouble(&converted));
+            if(!converted){
+                error_msg.append("\n"+value+" could not be converted");
+            }
+        }
+
+        value = "WAVEGRIDDXY";
+        strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+        if (found){
+            waveGridDX = strong.toDouble(&converted);
+            if(!converted || waveGridDX <= 0){
+                error_msg.append("\n"+value+" could not be converted or is not positive");
+            }
+        }
+
+        value = "WAVEGRIDDZ";
+        strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+        if (found){
+            waveGridDZ = strong.toDouble(&converted);
+            if(!converted || waveGridDZ <= 0){
+                error_msg.append("\n"+value+" could not be converted or is not positive");
+            }
+        }
+
+        value = "WAVEGRIDDT";
+        strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+        if (found){
+            waveGridDT = strong.toDouble(&converted);
+            if(!converted || waveGridDT <= 0){
+                error_msg.append("\n"+value+" could not be converted or is not positive");
+            }
+        }
+
+        value = "WAVEGRIDINTERP";
+        strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+        if (found){
+            waveGridInterp = int(strong.toDouble(&converted));
+            if(!converted){
+                error_msg.append("\n"+value+" could not be converted");
+            }
+        }
+        if (waveGridInterp != WAVEGRID_LINEAR) waveGridInterp = WAVEGRID_CUBIC;
+
+        value = "WAVEGRIDERROR";
+        strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+        if (found){
+            waveGridError = strong.toDouble(&converted);
+            if(!converted){
+                error_msg.append("\n"+value+" could not be converted");
+            }
+        }
+
         value = "SURF_CURR_U";
         strong = FindValueInFile(value,fileStream,&error_msg, true, &found);
         if (found){
@@ -1932,6 +2001,92 @@ QSimulation* ImportSimulationDefinition(QString fileName, bool skip, bool remove
         }
     }
 
+    QString streamName;
+    value = "STREAMFILE";
+    strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+    if (found){
+        streamName = strong;
+        streamName.replace("/",QDir::separator()).replace("\\",QDir::separator());
+    }
+
+    int streamWindow = 0;
+    value = "STREAMWINDOW";
+    strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+    if (found){
+        streamWindow = strong.toInt(&converted);
+        if(!converted || streamWindow < 0){
+            error_msg.append("\n"+value+" could not be converted or is negative");
+        }
+    }
+
+    int aeroCoupling = AEROCOUPLING_HOLD;
+    value = "AEROCOUPLING";
+    strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+    if (found){
+        aeroCoupling = strong.toInt(&converted);
+        if(!converted || aeroCoupling < AEROCOUPLING_HOLD || aeroCoupling > AEROCOUPLING_EXTRAPOLATE){
+            error_msg.append("\n"+value+" could not be converted or is out of range (0 or 1)");
+        }
+    }
+
+    double aeroCouplingLimit = 0.5;
+    value = "AEROCOUPLINGLIMIT";
+    strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+    if (found){
+        aeroCouplingLimit = strong.toDouble(&converted);
+        if(!converted || aeroCouplingLimit < 0){
+            error_msg.append("\n"+value+" could not be converted or is negative");
+        }
+    }
+
+    bool treecode = false;
+    value = "TREECODE";
+    strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+    if (found){
+        treecode = strong.toInt(&converted);
+        if(!converted){
+            error_msg.append("\n"+value+" could not be converted");
+        }
+    }
+
+    double treecodeTheta = 0.5;
+    value = "TREECODETHETA";
+    strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+    if (found){
+        treecodeTheta = strong.toDouble(&converted);
+        if(!converted || treecodeTheta <= 0){
+            error_msg.append("\n"+value+" could not be converted or is not positive");
+        }
+    }
+
+    int treecodeOrder = 2;
+    value = "TREECODEORDER";
+    strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+    if (found){
+        treecodeOrder = strong.toInt(&converted);
+        if(!converted || treecodeOrder < 0 || treecodeOrder > 2){
+            error_msg.append("\n"+value+" could not be converted or is out of range (0 to 2)");
+        }
+    }
+
+    bool treecodeCheck = false;
+    value = "TREECODECHECK";
+    strong = FindValueInFile(value,fileStream,&error_msg, false, &found);
+    if (found){
+        treecodeCheck = strong.toInt(&converted);
+        if(!converted){
+            error_msg.append("\n"+value+" could not be converted");
+        }
+    }
+
+    // optional selection of the stored blade output variables, one variable name per line (e.g. "Angle of Attack at 0.25c")
+    QStringList bladeOutputChannels;
+    QStringList bladeOutputStream = FindStreamSegmentByKeyword("BLADE_OUTPUTS",fileStream);
+    for (int i=0;i<bladeOutputStream.size();i++){
+        QString channel = bladeOutputStream.at(i).simplified();
+        if (channel.size()) bladeOutputChannels.append(channel);
+    }
+
     value = "CALCMODAL";
     strong = FindValueInFile(value,fileStream,&error_msg, true, &found);
     if (found){
@@ -2109,7 +2264,7 @@ QSimulation* ImportSimulationDefinition(QString fileName, bool skip, bool remove
             }
         }
         else if (windName.contains(".bts")){
-            windfield = ImportBinaryWindField(folderName+windName);
+            windfield = ImportBinaryWindField(folderName+windName, true);  // large boxes of batch runs are mapped and shared
         }
 
         if (!windfield){
@@ -2225,6 +2380,23 @@ QSimulation* ImportSimulationDefinition(QString fileName, bool skip, bool remove
                       seadamp,
                       seashear);
 
+    simulation->m_bUseWaveGrid = waveGrid;
+    simulation->m_waveGridSpacing = waveGridDX;
+    simulation->m_waveGridVerticalSpacing = waveGridDZ;
+    simulation->m_waveGridTimestep = waveGridDT;
+    simulation->m_waveGridInterpolation = waveGridInterp;
+    simulation->m_waveGridErrorBound = waveGridError;
+    simulation->m_bladeOutputChannels = bladeOutputChannels;
+    if (streamName.size() && QFileInfo(streamName).isRelative()) streamName = folderName+streamName;
+    simulation->m_streamFileName = streamName;
+    simulation->m_streamWindow = streamWindow;
+    simulation->m_aeroCouplingType = aeroCoupling;
+    simulation->m_aeroCouplingLimit = aeroCouplingLimit;
+    simulation->m_bTreecodeInduction = treecode;
+    simulation->m_treecodeTheta = treecodeTheta;
+    simulation->m_treecodeOrder = treecodeOrder;
+    simulation->m_bTreecodeCheck = treecodeCheck;
+
     for (int i=0;i<turbineList.size();i++){
 
         turbineList.at(i).turb->setSingleParent(simulation);
@@ -4647,7 +4819,7 @@ CBlade* ImportQBladeFullBlade(QString bladeFile, bool searchForExisting){
 
 }
 
-WindField* ImportBinaryWindField(QString fileName){
+WindField* ImportBinaryWindField(QString fileName, bool mapFile){
 
     if (!fileName.size()) fileName = QFileDialog::getOpenFileName(g_mainFrame, "Open Binary Windfield File", g_mainFrame->m_LastDirName,
                                             "Binary Wind Field File (*.bts)");
@@ -4674,7 +4846,7 @@ WindField* ImportBinaryWindField(QString fileName){
         QDataStream fileStream (&windfieldFile);
         fileStream.setByteOrder(QDataStream::LittleEndian);
         fileStream.setFloatingPointPrecision(QDataStream::SinglePrecision);
-        importWindField = WindField::newByImport(fileStream);
+        importWindField = WindField::newByImport(fileStream, mapFile);
 
         importWindField->setName(windfieldname);
         importWindField->pen()->setColor(g_colorManager.getLeastUsedColor(&g_windFieldStore));
@@ -4784,66 +4956,52 @@ void CreateTurbSimStream(QTextStream &stream, int seed, int gridPointsZ, int gri
 
 QList<double> ReynoldsInterpolatePolarList(double AoA, double reynolds, QList<Polar360*> *list){
 
+    PolarProperties result;
+    ReynoldsInterpolatePolarList(AoA, reynolds, list, result);
+    return result.toList();
+}
+
+QList<double> ReynoldsInterpolatePolarVector(double AoA, double reynolds, QVector<Polar360*> *vector){
 
-    QList<double> results;
-    QList<double> L1, L2;
+    PolarProperties result;
+    ReynoldsInterpolatePolarVector(AoA, reynolds, vector, result);
+    return result.toList();
+}
+
+template <typename PolarContainer>
+static void ReynoldsInterpolatePolars(double AoA, double reynolds, PolarContainer *polars, PolarProperties &result){
+
+    PolarProperties L2;
     Polar360 *polarL = NULL, *polarH = NULL;
 
-    if (reynolds <= list->at(0)->reynolds) polarL = list->at(0);
-    else if (reynolds >= list->at(list->size()-1)->reynolds) polarL = list->at(list->size()-1);
+    if (reynolds <= polars->at(0)->reynolds) polarL = polars->at(0);
+    else if (reynolds >= polars->at(polars->size()-1)->reynolds) polarL = polars->at(polars->size()-1);
     else{
-        for (int i=0;i<list->size()-1;i++){
-            if (reynolds >= list->at(i)->reynolds && reynolds <= list->at(i+1)->reynolds){
-                polarL = list->at(i);
-                polarH = list->at(i+1);
+        for (int i=0;i<polars->size()-1;i++){
+            if (reynolds >= polars->at(i)->reynolds && reynolds <= polars->at(i+1)->reynolds){
+                polarL = polars->at(i);
+                polarH = polars->at(i+1);
             }
         }
     }
 
-    L1 = polarL->GetPropertiesAt(AoA);
-    if (polarH) L2 = polarH->GetPropertiesAt(AoA);
+    polarL->GetPropertiesAt(AoA, result);
+    if (!polarH) return;
 
-    if (!polarH){
-        return L1;
-    }
-    else{
-        for (int i=0;i<L1.size();i++){
-            results.append(L1.at(i)+(L2.at(i)-L1.at(i))*(reynolds-polarL->reynolds)/(polarH->reynolds-polarL->reynolds));
-        }
-        return results;
+    polarH->GetPropertiesAt(AoA, L2);
+    for (int i=0;i<result.size();i++){
+        result[i] = result[i]+(L2[i]-result[i])*(reynolds-polarL->reynolds)/(polarH->reynolds-polarL->reynolds);
     }
 }
 
-QList<double> ReynoldsInterpolatePolarVector(double AoA, double reynolds, QVector<Polar360*> *vector){
-
-
-    QList<double> results;
-    QList<double> L1, L2;
-    Polar360 *polarL = NULL, *polarH = NULL;
+void ReynoldsInterpolatePolarList(double AoA, double reynolds, QList<Polar360*> *list, PolarProperties &result){
 
-    if (reynolds <= vector->at(0)->reynolds) polarL = vector->at(0);
-    else if (reynolds >= vector->at(vector->size()-1)->reynolds) polarL = vector->at(vector->size()-1);
-    else{
-        for (int i=0;i<vector->size()-1;i++){
-            if (reynolds >= vector->at(i)->reynolds && reynolds <= vector->at(i+1)->reynolds){
-                polarL = vector->at(i);
-                polarH = vector->at(i+1);
-            }
-        }
-    }
+    ReynoldsInterpolatePolars(AoA, reynolds, list, result);
+}
 
-    L1 = polarL->GetPropertiesAt(AoA);
-    if (polarH) L2 = polarH->GetPropertiesAt(AoA);
+void ReynoldsInterpolatePolarVector(double AoA, double reynolds, QVector<Polar360*> *vector, PolarProperties &result){
 
-    if (!polarH){
-        return L1;
-    }
-    else{
-        for (int i=0;i<L1.size();i++){
-            results.append(L1.at(i)+(L2.at(i)-L1.at(i))*(reynolds-polarL->reynolds)/(polarH->reynolds-polarL->reynolds));
-        }
-        return results;
-    }
+    ReynoldsInterpolatePolars(AoA, reynolds, vector, result);
 }
 
 Polar360* Get360Polar(QString m_FoilName, QString PolarName) {
@@ -23,6 +23,7 @@
 #include <src/Vec3.h>
 
 class Polar360;
+struct PolarProperties;
 class CBlade;
 class Airfoil;
 class QTurbine;
@@ -42,7 +43,7 @@ struct turbineParams{
 };
 
 WindField* ImportFromTurbSimWindInp(QString windFileName = "", bool deleteFiles = false);
-WindField* ImportBinaryWindField(QString fileName = "");
+WindField* ImportBinaryWindField(QString fileName = "", bool mapFile = false);
 QSimulation *ImportSimulationDefinition(QString fileName = "", bool skip = false, bool removeWind = true, bool searchForExisting = false, QString setName = "", bool noBCimport = false);
 QTurbine *ImportTurbineDefinition(QString fileName = "", bool searchForExisting = false);
 QTurbine *ImportMultiTurbineDefinition(QString fileName = "", bool searchForExisting = false);
@@ -81,6 +82,8 @@ Airfoil* GenerateCircularFoil();
 
 QList<double> ReynoldsInterpolatePolarList(double AoA, double reynolds, QList<Polar360*> *list);
 QList<double> ReynoldsInterpolatePolarVector(double AoA, double reynolds, QVector<Polar360*> *vector);
+void ReynoldsInterpolatePolarList(double AoA, double reynolds, QList<Polar360*> *list, PolarProperties &result);
+void ReynoldsInterpolatePolarVector(double AoA, double reynolds, QVector<Polar360*> *vector, PolarProperties &result);
 
 Polar360* Get360Polar(QString m_FoilName,  QString PolarName);
 
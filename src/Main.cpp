@@ -22,6 +22,7 @@
 #include <QTest>
 
 #include "QBladeApplication.h"
+#include "QBladeBatchRunner.h"
 #include "Globals.h"
 
 int main(int argc, char *argv[]) {
@@ -29,6 +30,20 @@ int main(int argc, char *argv[]) {
     g_ChronoVersion = QString(chrono_string);
     g_VersionName = QString("QBlade CE v "+QString(version_string)+" "+QString(compiled_string));
 
+    if (QBladeBatchRunner::isBatchMode(argc, argv)){
+
+        // headless mode: no MainFrame, modules or OpenGL context are created
+        isGUI = false;
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+        QApplication app(argc, argv);
+        QLocale::setDefault(QLocale::English);
+        QBladeApplication::setGlobalPaths();
+
+        QBladeBatchRunner runner;
+        return runner.run(app.arguments());
+    }
+
     QBladeApplication::setAttribute(Qt::AA_UseHighDpiPixmaps);
     QBladeApplication app(argc, argv);
 
@@ -174,9 +174,9 @@ OpenCLSetup::OpenCLSetup(bool echo_off)
 
             if(g_QSimulationModule){
                 for (int i=0;i<g_QSimulationModule->GetDevices()->count();i++){
-                    if (g_QSimulationModule->GetDevices()->findText(QString("GPU"),Qt::MatchContains) - 2 >= 0){
+                    if (g_QSimulationModule->GetDevices()->findText(QString("GPU"),Qt::MatchContains) - 3 >= 0){
                         g_QSimulationModule->SetDeviceType(g_QSimulationModule->GetDevices()->findText(QString("GPU"),Qt::MatchContains));
-                        CompileKernels(g_QSimulationModule->GetDevices()->findText(QString("GPU"),Qt::MatchContains)-2);
+                        CompileKernels(g_QSimulationModule->GetDevices()->findText(QString("GPU"),Qt::MatchContains)-3);
                     }
                 }
             }
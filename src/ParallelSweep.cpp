@@ -0,0 +1,69 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "ParallelSweep.h"
+
+#include <QProgressDialog>
+#include <QFutureWatcher>
+#include <QEventLoop>
+#include <QTimer>
+#include <QtConcurrent/qtconcurrentrun.h>
+
+#include "MainFrame.h"
+#include "Globals.h"
+
+ParallelSweep::ParallelSweep(){
+    m_progress = 0;
+    m_canceled = false;
+}
+
+bool ParallelSweep::runInBackground(QString title, int numPoints, std::function<void()> sweep){
+
+    m_progress = 0;
+    m_canceled = false;
+
+    if (!isGUI){
+        sweep();
+        return !isCanceled();
+    }
+
+    // the sweep runs in the background, the dialog is updated from the progress counter
+
+    QProgressDialog progress("Running Multi-Threaded "+title+" ("+QString().number(numPoints)+" Simulations)\nPlease wait...", "Cancel", 0, numPoints, g_mainFrame);
+    progress.setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
+    progress.setWindowTitle(title);
+    progress.setModal(true);
+    progress.setAutoClose(false);
+    progress.setValue(0);
+    progress.show();
+
+    QEventLoop loop;
+    QTimer timer;
+    QObject::connect(&timer, &QTimer::timeout, [this, &progress, numPoints](){ progress.setValue(qMin(getProgress(), numPoints)); });
+    QObject::connect(&progress, &QProgressDialog::canceled, [this, &timer](){ cancel(); timer.stop(); });
+    timer.start(100);
+
+    QFutureWatcher<void> watcher;
+    QObject::connect(&watcher, &QFutureWatcher<void>::finished, &loop, &QEventLoop::quit);
+    watcher.setFuture(QtConcurrent::run(sweep));
+
+    loop.exec();
+
+    timer.stop();
+
+    return !isCanceled();
+}
@@ -0,0 +1,52 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef PARALLELSWEEP_H
+#define PARALLELSWEEP_H
+
+#include <QString>
+#include <functional>
+#include <atomic>
+
+// Common part of the parallel steady state parameter sweeps (BEMSweep, DMSSweep). The sweep itself
+// runs in a background thread while the GUI thread polls the progress counter and forwards the
+// cancel request of the progress dialog; the workers never wait for the GUI.
+
+// Number of neighbouring operating points that are solved in sequence by one task, each point is warm
+// started from the previous one. A fixed length (instead of one derived from the thread count) keeps
+// the results independent of the number of threads; 8 points still give enough tasks to balance the
+// threads for the usual sweeps of 20 - 200 points.
+#define SWEEP_SEQUENCELENGTH 8
+
+class ParallelSweep
+{
+public:
+    ParallelSweep();
+    virtual ~ParallelSweep(){}
+
+    void cancel(){ m_canceled = true; }
+    bool isCanceled() const { return m_canceled; }
+    int getProgress() const { return m_progress; }    // number of solved operating points
+
+protected:
+    bool runInBackground(QString title, int numPoints, std::function<void()> sweep);    // returns false if the sweep was canceled
+
+    std::atomic<int> m_progress;
+    std::atomic<bool> m_canceled;
+};
+
+#endif // PARALLELSWEEP_H
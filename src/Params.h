@@ -33,7 +33,7 @@
 #define DARKGREY                0.55
 
 #define MAXRECENTFILES          8
-#define VERSIONNUMBER           310005
+#define VERSIONNUMBER           310012
 #define COMPATIBILITY           310000
 
 #define arraySizeTUB            550
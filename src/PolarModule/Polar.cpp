@@ -20,6 +20,7 @@
 #include <QTextStream>
 #include <QDir>
 #include <QProcess>
+#include <QElapsedTimer>
 #include <QDate>
 #include <QTime>
 
@@ -34,6 +35,7 @@
 #include "src/PolarModule/OperationalPoint.h"
 #include "src/PolarModule/PolarDock.h"
 #include "src/FoilModule/Airfoil.h"
+#include "src/PolarModule/XFoilResultCache.h"
 
 Polar::Polar(QString name, StorableObject *parent)
     : StorableObject (name, parent), ShowAsGraphInterface (true)
@@ -671,88 +673,20 @@ void Polar::onStartXFoilAnalysis(double min, double max, double delta, bool isBa
     if (isBatch){
         for (int i=0;i<num;i++){
 
-            if (!g_polarModule->m_Dock->m_stopRequested){
-
-                QString xfoilBatName = m_folderName+QDir::separator()+QString("xfbat")+QString().number(min+i*delta,'f',2)+QString(".txt");
-                QFile XFile(xfoilBatName);
-
-                if (XFile.exists()){
-
-                    QProcess binaryProcess;
-                    binaryProcess.setStandardInputFile(xfoilBatName);
-                    binaryProcess.start(g_xfoilPath,QStringList());
-                    bool isFinished = binaryProcess.waitForFinished(2000);
-                    QString output(binaryProcess.readAllStandardOutput());
-
-                    if (!isFinished){ //make sure its dead!
-                        binaryProcess.kill();
-                        binaryProcess.waitForFinished();
-                    }
-
-                    double CL = output.mid(output.lastIndexOf("CL = ")+5,10).replace("\r\n","    ").toDouble();
-                    double CD = output.mid(output.lastIndexOf("CD = ")+5,10).replace("\r\n","    ").toDouble();
-                    double CM = output.mid(output.lastIndexOf("Cm = ")+5,10).replace("\r\n","    ").toDouble();
-                    double CDp = output.mid(output.lastIndexOf("CDf = ")+5,10).replace("\r\n","    ").toDouble();
-
-                    if (output.contains("VISCAL:  Convergence failed") || !isFinished){
-                        results[i][0] = 0;
-                    }
-                    else if (isFinished){
-                        results[i][0] = 1;
-                        results[i][1] = min+i*delta;
-                        results[i][2] = CL;
-                        results[i][3] = CD;
-                        results[i][4] = CM;
-                        results[i][5] = CDp;
-                    }
-                }
-
-            }
+            if (!g_polarModule->m_Dock->m_stopRequested)
+                runXFoilAngle(min+i*delta,results[i]);
         }
     }
     else{
         isFinished = true; //already in the store, so delete in no case
-        #pragma omp parallel default (none) shared (delta,num,min,g_applicationDirectory,results,g_polarModule,g_xfoilPath)
+        #pragma omp parallel default (none) shared (delta,num,min,results,g_polarModule)
         {
             #pragma omp for
             for (int i=0;i<num;i++){
 
-                if (!g_polarModule->m_Dock->m_stopRequested){
-
-                    QString xfoilBatName = m_folderName+QDir::separator()+QString("xfbat")+QString().number(min+i*delta,'f',2)+QString(".txt");
-                    QFile XFile(xfoilBatName);
-
-                    if (XFile.exists()){
-
-                        QProcess binaryProcess;
-                        binaryProcess.setStandardInputFile(xfoilBatName);
-                        binaryProcess.start(g_xfoilPath,QStringList());
-                        bool isFinished = binaryProcess.waitForFinished(2000);
-                        QString output(binaryProcess.readAllStandardOutput());
-
-                        if (!isFinished){ //make sure its dead!
-                            binaryProcess.kill();
-                            binaryProcess.waitForFinished();
-                        }
-
-                        double CL = output.mid(output.lastIndexOf("CL = ")+5,10).replace("\r\n","    ").toDouble();
-                        double CD = output.mid(output.lastIndexOf("CD = ")+5,10).replace("\r\n","    ").toDouble();
-                        double CM = output.mid(output.lastIndexOf("Cm = ")+5,10).replace("\r\n","    ").toDouble();
-                        double CDp = output.mid(output.lastIndexOf("CDf = ")+5,10).replace("\r\n","    ").toDouble();
-
-                        if (output.contains("VISCAL:  Convergence failed") || !isFinished){
-                            results[i][0] = 0;
-                        }
-                        else if (isFinished){
-                            results[i][0] = 1;
-                            results[i][1] = min+i*delta;
-                            results[i][2] = CL;
-                            results[i][3] = CD;
-                            results[i][4] = CM;
-                            results[i][5] = CDp;
-                        }
-                    }
-                }
+                if (!g_polarModule->m_Dock->m_stopRequested)
+                    runXFoilAngle(min+i*delta,results[i]);
+
                 emit updateProgress();
             }
         }
@@ -846,4 +780,93 @@ void Polar::onStartXFoilAnalysis(double min, double max, double delta, bool isBa
 
 }
 
+void Polar::runXFoilAngle(double alpha, QVector<double> &result){
+
+    QString xfoilBatName = m_folderName+QDir::separator()+QString("xfbat")+QString().number(alpha,'f',2)+QString(".txt");
+    QFile XFile(xfoilBatName);
+
+    if (!XFile.exists()) return;
+
+    QString BLName = m_folderName+QDir::separator()+QString("BL")+QString().number(alpha,'f',2)+QString(".txt");
+    QString CPName = m_folderName+QDir::separator()+QString("CP")+QString().number(alpha,'f',2)+QString(".txt");
+
+    XFoilResult cached;
+    QString key;
+
+    if (XFoilResultCache::isEnabled()){
+
+        key = XFoilResultCache::getKey(xfoilBatName,m_folderName);
+
+        if (XFoilResultCache::lookup(key,cached)){
+
+            if (cached.converged){
+                result[0] = 1;
+                result[1] = alpha;
+                result[2] = cached.CL;
+                result[3] = cached.CD;
+                result[4] = cached.CM;
+                result[5] = cached.CDp;
+
+                // the dumps are restored to the folder where XFoil would have written them
+
+                QFile BLFile(BLName), CPFile(CPName);
+                if (cached.BLDump.size() && BLFile.open(QIODevice::WriteOnly)){ BLFile.write(cached.BLDump); BLFile.close(); }
+                if (cached.CPDump.size() && CPFile.open(QIODevice::WriteOnly)){ CPFile.write(cached.CPDump); CPFile.close(); }
+            }
+            else{
+                result[0] = 0;
+            }
+            return;
+        }
+    }
+
+    QElapsedTimer runTime;
+    runTime.start();
+
+    QProcess binaryProcess;
+    binaryProcess.setStandardInputFile(xfoilBatName);
+    binaryProcess.start(g_xfoilPath,QStringList());
+    bool isFinished = binaryProcess.waitForFinished(2000);
+    QString output(binaryProcess.readAllStandardOutput());
+
+    if (!isFinished){ //make sure its dead!
+        binaryProcess.kill();
+        binaryProcess.waitForFinished();
+    }
+
+    double CL = output.mid(output.lastIndexOf("CL = ")+5,10).replace("\r\n","    ").toDouble();
+    double CD = output.mid(output.lastIndexOf("CD = ")+5,10).replace("\r\n","    ").toDouble();
+    double CM = output.mid(output.lastIndexOf("Cm = ")+5,10).replace("\r\n","    ").toDouble();
+    double CDp = output.mid(output.lastIndexOf("CDf = ")+5,10).replace("\r\n","    ").toDouble();
+
+    if (output.contains("VISCAL:  Convergence failed") || !isFinished){
+        result[0] = 0;
+    }
+    else if (isFinished){
+        result[0] = 1;
+        result[1] = alpha;
+        result[2] = CL;
+        result[3] = CD;
+        result[4] = CM;
+        result[5] = CDp;
+    }
+
+    // a timeout depends on the machine load and is not cached
+
+    if (!key.isEmpty() && isFinished){
+
+        cached.converged = (result[0] == 1);
+        cached.CL = CL;
+        cached.CD = CD;
+        cached.CM = CM;
+        cached.CDp = CDp;
+
+        QFile BLFile(BLName), CPFile(CPName);
+        if (cached.converged && BLFile.open(QIODevice::ReadOnly)){ cached.BLDump = BLFile.readAll(); BLFile.close(); }
+        if (cached.converged && CPFile.open(QIODevice::ReadOnly)){ cached.CPDump = CPFile.readAll(); CPFile.close(); }
+
+        XFoilResultCache::store(key,cached,runTime.elapsed());
+    }
+}
+
 
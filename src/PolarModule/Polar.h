@@ -43,6 +43,7 @@ public:
     void InitializeOutputVectors();
     void onExportXFoilFiles(double min, double max, double delta, bool isOpPoint, bool isBatch = false, int index = 0);
     void onStartXFoilAnalysis(double min, double max, double delta, bool isBatch);
+    void runXFoilAngle(double alpha, QVector<double> &result);     // result: converged, alpha, CL, CD, CM, CDp
     void AddPoint(double Alpha, double Cd, double Cdp, double Cl, double Cm);
     void Copy(Polar *pPolar);
     void Remove(int i);
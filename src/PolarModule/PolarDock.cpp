@@ -26,6 +26,8 @@
 #include <QProgressDialog>
 #include <QtConcurrent/qtconcurrentrun.h>
 #include <QFutureWatcher>
+#include <QDebug>
+#include <QStatusBar>
 
 #include "src/PolarModule/PolarModule.h"
 #include "src/PolarModule/PolarToolBar.h"
@@ -38,6 +40,8 @@
 #include "BatchFoilDialog.h"
 #include "src/PolarModule/OperationalPoint.h"
 #include "src/ColorManager.h"
+#include "src/PolarModule/XFoilResultCache.h"
+#include "src/MainFrame.h"
 
 PolarDock::PolarDock(const QString & title, QMainWindow * parent, Qt::WindowFlags flags, PolarModule *module)
     : ScrolledDock (title, parent, flags)
@@ -367,6 +371,9 @@ void PolarDock::onXFoilBatchAnalysis(){
 
     m_newPolarList.clear();
 
+    XFoilResultCache::resetStatistics();
+    XFoilResultCache::evict();
+
     for (int i=0;i<foilList.size();i++){
         for (int j=0;j<numre;j++){
 
@@ -448,6 +455,9 @@ void PolarDock::onXFoilAnalysis(){
     m_progress = 0;
     m_newPolarList.clear();
 
+    XFoilResultCache::resetStatistics();
+    XFoilResultCache::evict();
+
     m_analysisButton->setEnabled(false);
 
     double amin = m_start->getValue();
@@ -490,6 +500,8 @@ void PolarDock::onProgressFinished(){
         if (QFile(g_applicationDirectory+QDir::separator()+":00.bl").exists()){
             QFile(g_applicationDirectory+QDir::separator()+":00.bl").remove();
         }
+        if (XFoilResultCache::isEnabled())
+            g_mainFrame->statusBar()->showMessage(XFoilResultCache::getStatistics());
         if (m_newPolarList.size()){
             for (int i=0;i<m_newPolarList.size();i++){
                 if (m_newPolarList.at(i)->isFinished){
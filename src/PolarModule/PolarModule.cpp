@@ -33,6 +33,7 @@
 #include "src/PolarModule/EditPolarDlg.h"
 #include "src/PolarModule/OperationalPoint.h"
 #include "src/ColorManager.h"
+#include "src/PolarModule/XFoilResultCache.h"
 
 PolarModule::PolarModule(QMainWindow *mainWindow, QToolBar *toolbar)
 {
@@ -151,6 +152,16 @@ void PolarModule::createActions(){
     m_Menu->addAction(m_XFoilBatch);
     connect(m_XFoilBatch, SIGNAL(triggered()), m_Dock, SLOT(onXFoilBatchAnalysis()));
 
+    m_XFoilCache = new QAction(tr("Reuse Cached XFoil Results"), this);
+    m_XFoilCache->setCheckable(true);
+    m_XFoilCache->setChecked(XFoilResultCache::isEnabled());
+    m_Menu->addAction(m_XFoilCache);
+    connect(m_XFoilCache, SIGNAL(toggled(bool)), this, SLOT(onXFoilCacheToggled(bool)));
+
+    m_clearXFoilCache = new QAction(tr("Clear XFoil Result Cache"), this);
+    m_Menu->addAction(m_clearXFoilCache);
+    connect(m_clearXFoilCache, SIGNAL(triggered()), this, SLOT(onClearXFoilCache()));
+
     m_Menu->addSeparator();
 
     QMenu *importMenu = m_Menu->addMenu("Import Data");
@@ -437,6 +448,7 @@ void PolarModule::SaveSettings(QSettings *pSettings){
         pSettings->setValue("XF_ITER", m_ITER);
         pSettings->setValue("XF_UXWT", m_UXWT);
         pSettings->setValue("XF_KLAG", m_KLAG);
+        pSettings->setValue("XF_UseCache", XFoilResultCache::isEnabled());
     }
     pSettings->endGroup();
 }
@@ -456,6 +468,7 @@ void PolarModule::LoadSettings(QSettings *pSettings){
         m_ITER = pSettings->value("XF_ITER",100).toDouble();
         m_UXWT = pSettings->value("XF_UXWT",1).toDouble();
         m_KLAG = pSettings->value("XF_KLAG",5.6).toDouble();
+        m_XFoilCache->setChecked(pSettings->value("XF_UseCache",true).toBool());
     }
     pSettings->endGroup();
 
@@ -595,6 +608,20 @@ void PolarModule::onResetXFParameters(){
     m_KLAG = 5.6;
 }
 
+void PolarModule::onXFoilCacheToggled(bool enabled){
+    XFoilResultCache::setEnabled(enabled);
+}
+
+void PolarModule::onClearXFoilCache(){
+
+    if (m_Dock->m_progressDialog){
+        QMessageBox::warning(g_mainFrame, "Warning", "An XFoil analysis is still running!\nWait for it to finish before clearing the result cache...");
+        return;
+    }
+
+    XFoilResultCache::clear();
+}
+
 void PolarModule::onExportAllPolars()
 {
     QString FileName, DirName;
@@ -71,7 +71,8 @@ public:
     double m_VACC, m_KLAG, m_A, m_CTINIK, m_UXWT, m_B, m_CTINIX, m_ITER;
 
     QAction *m_new, *m_delete, *m_edit, *m_rename, *m_importPolar, *m_importXFoilPolar, *m_exportAllPolars, *m_XFoilParameters, *m_deleteCurrent, *m_deleteALL,
-    *m_exportAllPolarsNRELAct, *m_exportCur, *m_exportCurNREL, *m_editPolarPoints, *m_showCurrentOp, *m_showAllOp, *m_XFoilBatch;
+    *m_exportAllPolarsNRELAct, *m_exportCur, *m_exportCurNREL, *m_editPolarPoints, *m_showCurrentOp, *m_showAllOp, *m_XFoilBatch,
+    *m_XFoilCache, *m_clearXFoilCache;
 
 public slots:
     void onHideDocks(bool hide);
@@ -89,6 +90,8 @@ private slots:
     void onEditPolarPoints();
     void onXFoilSettings();
     void onResetXFParameters();
+    void onXFoilCacheToggled(bool enabled);
+    void onClearXFoilCache();
     void onShowAllOpPoints();
     void onShowCurrentOpPoint();
 
@@ -0,0 +1,196 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "XFoilResultCache.h"
+
+#include <QCryptographicHash>
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QStringList>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QThread>
+#include <QDebug>
+#include <QMutex>
+#include <QFile>
+#include <QDir>
+#include <atomic>
+
+#include "src/Globals.h"
+#include "src/GlobalFunctions.h"
+
+#define XFOILCACHE_MAGIC 0x58464331
+#define XFOILCACHE_FORMAT 1
+#define XFOILCACHE_MAXSIZE_MB 1024.0
+
+static std::atomic<bool> s_enabled(true);     // toggled from the GUI thread while the XFoil runs query it
+
+static QMutex s_statisticsMutex;
+static qint64 s_hits = 0, s_misses = 0, s_savedMS = 0;
+
+QString XFoilResultCache::getKey(QString const &batchFileName, QString const &folderName){
+
+    QFile batchFile(batchFileName);
+    if (!batchFile.open(QIODevice::ReadOnly | QIODevice::Text)) return QString();
+    QStringList commands = QString(batchFile.readAll()).split("\n");
+    batchFile.close();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+
+    int format = XFOILCACHE_FORMAT;
+    hash.addData((const char *) &format, sizeof(int));
+
+    for (int i=0;i<commands.size();i++){
+
+        QString command = commands.at(i);
+
+        if (command.startsWith("LOAD ")){
+            // the coordinates enter the key instead of the file name, the first line holds the airfoil name
+            QFile foilFile(command.mid(5).trimmed());
+            if (!foilFile.open(QIODevice::ReadOnly | QIODevice::Text)) return QString();
+            foilFile.readLine();
+            hash.addData(foilFile.readAll());
+            foilFile.close();
+            command = "LOAD";
+        }
+        else{
+            command.remove(folderName);
+        }
+
+        hash.addData(command.toUtf8() + "\n");
+    }
+
+    // a different XFoil binary may give different results
+
+    QFileInfo binary(g_xfoilPath);
+    hash.addData(QString().number(binary.size()).toUtf8());
+    hash.addData(binary.lastModified().toString(Qt::ISODate).toUtf8());
+
+    return QString(hash.result().toHex());
+}
+
+bool XFoilResultCache::lookup(QString const &key, XFoilResult &result){
+
+    if (!s_enabled || key.isEmpty()) return false;
+
+    bool valid = false;
+    qint64 runTimeMS = 0;
+
+    QString fileName = QDir(getCacheDirectory()).absoluteFilePath(key + ".xfr");
+
+    QFile file(fileName);
+    if (file.open(QIODevice::ReadOnly)){
+
+        QDataStream stream(&file);
+        stream.setVersion(QDataStream::Qt_5_0);
+
+        qint32 magic = 0, format = 0;
+        stream >> magic >> format;
+
+        if (magic == XFOILCACHE_MAGIC && format == XFOILCACHE_FORMAT){
+            stream >> result.converged >> result.CL >> result.CD >> result.CM >> result.CDp;
+            stream >> result.BLDump >> result.CPDump >> runTimeMS;
+            valid = (stream.status() == QDataStream::Ok);
+        }
+
+        file.close();
+    }
+
+    if (valid) TouchCacheFile(fileName);
+
+    QMutexLocker locker(&s_statisticsMutex);
+    if (valid){
+        s_hits++;
+        s_savedMS += runTimeMS;
+    }
+    else{
+        s_misses++;
+    }
+
+    return valid;
+}
+
+void XFoilResultCache::store(QString const &key, XFoilResult const &result, qint64 runTimeMS){
+
+    if (!s_enabled || key.isEmpty()) return;
+
+    QDir directory(getCacheDirectory());
+    if (!directory.exists() && !QDir().mkpath(directory.absolutePath())) return;
+
+    // written to a temporary file first, so that concurrent analyses never read a partial entry
+
+    QString fileName = directory.absoluteFilePath(key + ".xfr");
+    QFile tempFile(fileName + "." + QString().number(QCoreApplication::applicationPid()) + "_" + QString().number(quintptr(QThread::currentThreadId())) + ".tmp");
+
+    if (!tempFile.open(QIODevice::WriteOnly)) return;
+
+    QDataStream stream(&tempFile);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    stream << qint32(XFOILCACHE_MAGIC) << qint32(XFOILCACHE_FORMAT);
+    stream << result.converged << result.CL << result.CD << result.CM << result.CDp;
+    stream << result.BLDump << result.CPDump << runTimeMS;
+
+    bool success = (stream.status() == QDataStream::Ok);
+    tempFile.close();
+
+    // if the rename fails the same run has just been stored by another analysis
+
+    if (!success || !tempFile.rename(fileName)) tempFile.remove();
+}
+
+bool XFoilResultCache::isEnabled(){
+    return s_enabled;
+}
+
+void XFoilResultCache::setEnabled(bool enabled){
+    s_enabled = enabled;
+}
+
+void XFoilResultCache::evict(){
+
+    // the stored runs are small, the eviction is only done once before an analysis and not for every stored run
+
+    EvictCacheFiles(getCacheDirectory(), QStringList("*.xfr"), XFOILCACHE_MAXSIZE_MB);
+}
+
+void XFoilResultCache::clear(){
+
+    QDir directory(getCacheDirectory());
+    if (directory.exists()) directory.removeRecursively();
+
+    qDebug().noquote() << "...XFoil result cache cleared";
+}
+
+QString XFoilResultCache::getCacheDirectory(){
+    return GetUserCacheDirectory("XFoilCache");
+}
+
+void XFoilResultCache::resetStatistics(){
+
+    QMutexLocker locker(&s_statisticsMutex);
+    s_hits = 0;
+    s_misses = 0;
+    s_savedMS = 0;
+}
+
+QString XFoilResultCache::getStatistics(){
+
+    QMutexLocker locker(&s_statisticsMutex);
+
+    return QString("XFoil result cache: %1 hits, %2 misses, %3 s of XFoil runtime saved").arg(s_hits).arg(s_misses).arg(s_savedMS / 1000.0,0,'f',1);
+}
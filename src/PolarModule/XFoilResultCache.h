@@ -0,0 +1,55 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef XFOILRESULTCACHE_H
+#define XFOILRESULTCACHE_H
+
+#include <QString>
+#include <QByteArray>
+
+// Persistent, content addressed cache of single XFoil runs. The key of a run is a hash of the airfoil
+// coordinates, the XFoil batch commands (Reynolds and Mach number, NCrit, transition, BL parameters,
+// angle of attack) and the identity of the XFoil binary; the temporary folder names and the airfoil
+// name do not enter the key. Every angle of attack is cached separately, so that a polar that only
+// extends an already computed range reuses the common angles. Runs that did not converge are cached
+// as well, runs that were killed by the timeout are not. The cache is kept in the per-user cache location,
+// the least recently used runs are evicted when it exceeds XFOILCACHE_MAXSIZE_MB.
+
+struct XFoilResult{
+    bool converged;
+    double CL, CD, CM, CDp;
+    QByteArray BLDump, CPDump;     // file contents of the DUMP and CPWR output, empty if not requested
+};
+
+class XFoilResultCache
+{
+public:
+    static QString getKey(QString const &batchFileName, QString const &folderName);   // returns an empty key if the files can't be read
+    static bool lookup(QString const &key, XFoilResult &result);
+    static void store(QString const &key, XFoilResult const &result, qint64 runTimeMS);
+
+    static bool isEnabled();
+    static void setEnabled(bool enabled);       // disabled: all runs are recomputed and nothing is stored
+    static void evict();                        // removes the least recently used runs if the size limit is exceeded
+    static void clear();                        // invalidates all stored runs
+    static QString getCacheDirectory();
+
+    static void resetStatistics();
+    static QString getStatistics();             // hits, misses and the XFoil runtime that was saved
+};
+
+#endif // XFOILRESULTCACHE_H
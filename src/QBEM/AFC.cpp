@@ -37,12 +37,18 @@ AFC* AFC::newBySerialize() {
 
 QList<double> AFC::GetInterpolatedProperties(double AoA, double position, double reynolds, double beta){
 
+    PolarProperties result;
+    GetInterpolatedProperties(AoA, position, reynolds, beta, result);
+    return result.toList();
+}
+
+void AFC::GetInterpolatedProperties(double AoA, double position, double reynolds, double beta, PolarProperties &result){
+
 
     QList<Polar360*> *stateALList = NULL, *stateAHList = NULL, *stateBLList = NULL, *stateBHList = NULL;
 
-    QList<double> setAL, setAH, setBL, setBH;
+    PolarProperties setAH, setBL, setBH;
     double stateAL, stateAH, stateBL, stateBH, pitchAL, pitchAH, pitchBL, pitchBH;
-    QList<double> AList, BList, result;
 
     if (beta <= setA->m_states.at(0)) stateALList = &setA->m_360polars[0];
     else if (beta >= setA->m_states.at(setA->m_states.size()-1)) stateALList = &setA->m_360polars[setA->m_states.size()-1];
@@ -74,30 +80,28 @@ QList<double> AFC::GetInterpolatedProperties(double AoA, double position, double
         }
     }
 
-    setAL = ReynoldsInterpolatePolarList(AoA-pitchAL, reynolds, stateALList);
-    if (stateAHList) setAH = ReynoldsInterpolatePolarList(AoA-pitchAH, reynolds, stateAHList);
+    // the A side is accumulated in result, the B side in setBL
+    ReynoldsInterpolatePolarList(AoA-pitchAL, reynolds, stateALList, result);
+    if (stateAHList) ReynoldsInterpolatePolarList(AoA-pitchAH, reynolds, stateAHList, setAH);
 
-    setBL = ReynoldsInterpolatePolarList(AoA-pitchBL, reynolds, stateBLList);
-    if (stateBHList) setBH = ReynoldsInterpolatePolarList(AoA-pitchBH, reynolds, stateBHList);
+    ReynoldsInterpolatePolarList(AoA-pitchBL, reynolds, stateBLList, setBL);
+    if (stateBHList) ReynoldsInterpolatePolarList(AoA-pitchBH, reynolds, stateBHList, setBH);
 
-    if (!stateAHList) AList = setAL;
-    else{
-        for (int i=0;i<setAL.size();i++){
-            AList.append(setAL.at(i)+(setAH.at(i)-setAL.at(i))*(beta-stateAL)/(stateAH-stateAL));
+    if (stateAHList){
+        for (int i=0;i<result.size();i++){
+            result[i] = result[i]+(setAH[i]-result[i])*(beta-stateAL)/(stateAH-stateAL);
         }
     }
 
-    if (!stateBHList) BList = setBL;
-    else{
+    if (stateBHList){
         for (int i=0;i<setBL.size();i++){
-            BList.append(setBL.at(i)+(setBH.at(i)-setBL.at(i))*(beta-stateBL)/(stateBH-stateBL));
+            setBL[i] = setBL[i]+(setBH[i]-setBL[i])*(beta-stateBL)/(stateBH-stateBL);
         }
     }
 
-    for (int i=0;i<AList.size();i++){
-        result.append(AList.at(i)+(BList.at(i)-AList.at(i))*(position-posA)/(posB-posA));
+    for (int i=0;i<result.size();i++){
+        result[i] = result[i]+(setBL[i]-result[i])*(position-posA)/(posB-posA);
     }
-    return result;
 
 }
 
@@ -19,6 +19,7 @@
 #define AFC_H
 #include "../StorableObject.h"
 #include "src/QBEM/DynPolarSet.h"
+#include "src/QBEM/Polar360.h"
 
 
 
@@ -31,6 +32,7 @@ public:
     void restorePointers();
     void copy(AFC *str, bool temporary = false);
     QList<double> GetInterpolatedProperties(double AoA, double position, double reynolds, double beta);
+    void GetInterpolatedProperties(double AoA, double position, double reynolds, double beta, PolarProperties &result);
     double GetBetaSlope(double AoA, double position, double reynolds, double beta);
     void UpdateState(double newState, double dT);
 
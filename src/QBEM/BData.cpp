@@ -402,7 +402,7 @@ void BData::InitializeTurbine(double pitch, CBlade *pBlade, double inflowspeed){
     m_Turbine->ResetSimulation();
 }
 
-void BData::OnQTurbineBEM(double pitch, CBlade *pBlade, double inflowspeed, double lambda){
+void BData::OnQTurbineBEM(double pitch, CBlade *pBlade, double inflowspeed, double lambda, QVector<Vec3> *induction, bool keepTurbine){
 
     lambda_global = lambda;
     m_lambdaString = QString().number(lambda_global,'f',2);
@@ -415,12 +415,15 @@ void BData::OnQTurbineBEM(double pitch, CBlade *pBlade, double inflowspeed, doub
     inner_radius = pBlade->m_TPos[0];
     length=outer_radius-inner_radius;
 
+    // a turbine that was assigned by the caller only needs the inflow speed, the pitch is part of its geometry
+
     if (!m_Turbine)
         InitializeTurbine(pitch, pBlade, inflowspeed);
+    else
+        m_Turbine->m_steadyBEMVelocity = inflowspeed;
 
-
-    if (m_bPolyBEM) m_Turbine->steadyStateBEMIterationDTU(lambda);
-    else m_Turbine->steadyStateBEMIterationClassic(lambda);
+    if (m_bPolyBEM) m_Turbine->steadyStateBEMIterationDTU(lambda, induction);
+    else m_Turbine->steadyStateBEMIterationClassic(lambda, induction);
 
     for (int i=0;i<m_Turbine->m_BladePanel.size();i++){
         if (m_Turbine->m_BladePanel.at(i)->fromBlade == 1){
@@ -485,7 +488,7 @@ void BData::OnQTurbineBEM(double pitch, CBlade *pBlade, double inflowspeed, doub
 
     //    if (ct < 0) ct = 0;
 
-    delete m_Turbine;
+    if (!keepTurbine) delete m_Turbine;
     m_Turbine = NULL;
 
 }
@@ -548,7 +551,7 @@ void BData::OnPropBEM(double pitch, CBlade *pBlade, double inflowspeed, double a
 
             ConstrainAngle_180_180_Degree(alpha);
 
-            QList<double> ClCd;
+            BladeParameters ClCd;
             RE = pow((pow(windspeed*(1+a_a),2)+pow(windspeed*m_lambda_local.at(i)*(1-a_t),2)),0.5)*m_c_local.at(i)/visc;
 
             ClCd = pBlade->getBladeParameters(m_pos[i], -alpha, m_bInterpolation, RE, m_b3DCorrection, lambda_global);
@@ -791,7 +794,7 @@ void BData::OnBEM(double pitch, CBlade *pBlade, double inflowspeed, double lambd
 
             ConstrainAngle_180_180_Degree(alpha);
 
-            QList<double> ClCd;
+            BladeParameters ClCd;
             RE = pow((pow(windspeed*(1-a_a),2)+pow(windspeed*m_lambda_local.at(i)*(1+a_t),2)),0.5)*m_c_local.at(i)/visc;
 
             ClCd = pBlade->getBladeParameters(m_pos[i], alpha, m_bInterpolation, RE, m_b3DCorrection, lambda_global);
@@ -48,7 +48,7 @@ public:
 	void Init(CBlade *pWing, double lambda);
     void OnBEM(double pitch, CBlade *pBlade, double inflowspeed, double lambda);
     void OnPropBEM(double pitch, CBlade *pBlade, double inflowspeed, double advance);
-    void OnQTurbineBEM(double pitch, CBlade *pBlade, double inflowspeed, double lambda);
+    void OnQTurbineBEM(double pitch, CBlade *pBlade, double inflowspeed, double lambda, QVector<Vec3> *induction = NULL, bool keepTurbine = false);  // keepTurbine: m_Turbine is owned by the caller
     void InitializeTurbine(double pitch, CBlade *pBlade, double inflowspeed);
 
     QString GetTSR();
@@ -1178,6 +1178,7 @@ void QBEM::ComputeDecomposition(){
     }
 
     m_pCur360Polar->m_bisDecomposed = true;
+    m_pCur360Polar->CompileLookupTable();
 
 }
 
@@ -5672,12 +5673,10 @@ void QBEM::OnStartRotorSimulation()
     SimuWidget *pSimuWidget = (SimuWidget *) m_pSimuWidget;
 
     double lstart, lend, ldelta;
-    int times;
 
     lstart  =   pSimuWidget->m_pctrlLSLineEdit->getValue();
     lend    =   pSimuWidget->m_pctrlLELineEdit->getValue();
     ldelta  =   pSimuWidget->m_pctrlLDLineEdit->getValue();
-    times   =   int((lend-lstart)/ldelta);
 
 
     dlg_lambdastart = pSimuWidget->m_pctrlLSLineEdit->getValue();
@@ -5687,34 +5686,18 @@ void QBEM::OnStartRotorSimulation()
 
     m_pBEMData->Clear();
 
-    QProgressDialog progress("", "Abort BEM", 0, times, this);
-    progress.setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
-    progress.setMinimumDuration(1000);
-    progress.setModal(true);
-
-    for (int i=0;i<=times;i++)
-    {
-    if (progress.wasCanceled()) break;
-
-    QString curlambda;
-    curlambda.sprintf("%.1f",lstart+i*ldelta);
-    QString text = "Compute BEM for Lambda " + curlambda;
-    progress.setLabelText(text);
-    progress.setValue(i);
-
-
-	m_pBladeData = new BData (m_pBEMData->getName());
-    m_pBEMData->Compute(m_pBladeData,m_pBlade,lstart+i*ldelta,m_pBEMData->m_windspeed);
+    m_pBEMData->m_tipSpeedFrom = lstart;
+    m_pBEMData->m_tipSpeedTo = lend;
+    m_pBEMData->m_tipSpeedDelta = ldelta;
 
-    m_pBladeData->pen()->setColor(g_colorManager.getColor(m_pBEMData->m_data.size()));
+    m_pBEMData->startSimulation();
 
-	m_pBData = m_pBEMData->m_data[0];
+    m_pBladeData = NULL;
+    m_pBData = m_pBEMData->m_data.size() ? m_pBEMData->m_data[0] : NULL;
 
     selected_lambda = -1;
 
     CreateRotorCurves();
-    }
-
 
     UpdateBlades();
     SetCurveParams();
@@ -5938,10 +5921,10 @@ void QBEM::OnStartCharacteristicSimulation()
     if (!m_pCBEMData) return;
     SimuWidget *pSimuWidget = (SimuWidget *) m_pSimuWidget;
 
-    double vstart, vend, vdelta, windspeed;
-    double rotstart, rotend, rotdelta, rot;
-    double pitchstart, pitchend, pitchdelta, pitch;
-    int vtimes, rottimes, pitchtimes, times;
+    double vstart, vend, vdelta;
+    double rotstart, rotend, rotdelta;
+    double pitchstart, pitchend, pitchdelta;
+    int vtimes, rottimes, pitchtimes;
 
     m_pCBEMData->DeleteArrays(); //// if the simulation was run previously the old arrays are deleted
 
@@ -5976,8 +5959,6 @@ void QBEM::OnStartCharacteristicSimulation()
     if (pSimuWidget->PitchFixed->isChecked()) pitchtimes = 1;
     m_pCBEMData->pitchtimes = pitchtimes;
 
-    times = (rottimes)*(vtimes)*(pitchtimes);
-
     dlg_windstart2  = pSimuWidget->WindStart->getValue();
     dlg_windend2    = pSimuWidget->WindEnd->getValue();
     dlg_winddelta2  = pSimuWidget->WindDelta->getValue();
@@ -5990,41 +5971,11 @@ void QBEM::OnStartCharacteristicSimulation()
     dlg_rotend      = pSimuWidget->RotEnd->getValue();
     dlg_rotdelta    = pSimuWidget->RotDelta->getValue();
 
-    m_pCBEMData->initArrays(vtimes,rottimes,pitchtimes);
+    m_pCBEMData->startSimulation();
 
-    m_bStopRequested = false;
-    m_progressDialog = new QProgressDialog ("Running Multi-Threaded Multi Parameter BEM Simulation ("+QString().number(times)+" Simulations)\nPlease wait...", "Cancel", 0, times,this);
-    m_progressDialog->setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
-    m_progressDialog->setModal(true);
-    m_progressDialog->setValue(0);
-    m_progressDialog->setWindowTitle("Multi Parameter BEM");
-
-    QPushButton *cancelButton = m_progressDialog->findChild<QPushButton *>();
-    cancelButton->disconnect();
-    connect(cancelButton, SIGNAL(clicked(bool)), this, SLOT(OnCancelProgress()));
-    m_progressDialog->show();
-
-    m_pCBEMData->simulated = true;
-    m_progress = 0;
-
-    QThreadPool::globalInstance()->setMaxThreadCount(QThread::idealThreadCount());
-
-    for (int i=0;i<vtimes;i++){
-        windspeed = vstart+vdelta*i;
-
-        for (int j=0;j<rottimes;j++){
-            rot = rotstart+rotdelta*j;
-
-            for (int k=0;k<pitchtimes;k++){
-                pitch = pitchstart+pitchdelta*k;
-
-                    QFuture<void> f = QtConcurrent::run(m_pCBEMData,&CBEMData::Compute,i, j, k);
-                    QFutureWatcher<void> *watch2 = new QFutureWatcher<void>;
-                    watch2->setFuture(f);
-                    connect(watch2,&QFutureWatcher<void>::finished,this,&QBEM::OnUpdateProgress);
-            }
-        }
-    }
+    UpdateCharacteristicsSimulation();
+    SetCurveParams();
+    FillComboBoxes();
 }
 
 void QBEM::OnUpdateProgress(){
@@ -6127,6 +6078,59 @@ void QBEM::OnStartTurbineSimulation()
     }
     /////////////////
 
+    // the windspeeds are first solved in parallel at the initial pitch angle (the prescribed or the fixed
+    // pitch); the pitch control below depends on the pitch of the previous windspeed and stays serial, it
+    // only reuses the results of the parallel sweep if the pitch is still the initial one
+
+    QVector<double> &sweepLambda = m_pTBEMData->m_sweepLambda, &sweepPitch = m_pTBEMData->m_sweepPitch;
+    QVector<BData *> &sweepResult = m_pTBEMData->m_sweepResults;
+
+    m_pTBEMData->m_sweepWindspeed.resize(times+1);
+    sweepLambda.resize(times+1);
+    sweepPitch.resize(times+1);
+
+    for (int i=0;i<=times;i++)
+    {
+        windspeed = vstart+vdelta*i;
+        m_pTBEMData->m_sweepWindspeed[i] = windspeed;
+
+        if (m_pTData->isFixed) rot = m_pTData->Rot1;
+
+        if (m_pTData->is2Step)
+        {
+            if (windspeed < m_pTData->Switch) rot = m_pTData->Rot1;
+            if (windspeed >= m_pTData->Switch) rot = m_pTData->Rot2;
+        }
+
+        if (m_pTData->isVariable)
+        {
+            rot = m_pTData->Lambda0*windspeed*60/2/PI_/m_pTData->OuterRadius;
+            if (rot<m_pTData->Rot1) rot = m_pTData->Rot1;
+            if (rot>m_pTData->Rot2) rot = m_pTData->Rot2;
+        }
+
+        sweepPitch[i] = m_pTData->FixedPitch;
+
+        if (m_pTData->isPrescribedPitch){
+            double dummy;
+            InterpolatePitchRPMData(windspeed,sweepPitch[i],dummy);
+        }
+
+        if (m_pTData->isPrescribedRot){
+            double dummy;
+            InterpolatePitchRPMData(windspeed,dummy,rot);
+        }
+
+        sweepLambda[i] = m_pTData->OuterRadius*2*PI_/60/windspeed*rot;
+    }
+
+    rot = 200;
+
+    if (!m_pTBEMData->startSimulation()) return;
+
+    BEMSweep sweep(pWing, [this](){ return m_pTBEMData->CreateBDataObject(); });
+    BEMSweep::Worker worker(&sweep);
+
     QProgressDialog progress("", "Abort BEM", 0, times, this);
     progress.setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
     progress.setMinimumDuration(1000);
@@ -6135,7 +6139,7 @@ void QBEM::OnStartTurbineSimulation()
     for (int i=0;i<=times;i++)
     {
 
-		m_pBladeData = new BData (m_pTBEMData->getName());
+		m_pBladeData = NULL;
 
         if (progress.wasCanceled()) break;
 
@@ -6184,7 +6188,13 @@ void QBEM::OnStartTurbineSimulation()
         {
 
 
-			m_pTBEMData->Compute(m_pBladeData,pWing,lambda,pitch,windspeed);
+            if (pitch == sweepPitch.at(i)){
+                m_pBladeData = sweepResult.at(i);
+                sweepResult[i] = NULL;
+            }
+            else{
+                m_pBladeData = worker.solve(pitch,windspeed,lambda);
+            }
 
 
 
@@ -6201,9 +6211,8 @@ void QBEM::OnStartTurbineSimulation()
                         while ((1-m_pTData->VariableLosses)*PI_/2*pow(m_pTData->OuterRadius,2)*m_pTBEMData->rho*pow(windspeed,3)*m_pBladeData->cp-m_pTData->m_fixedLosses > m_pTData->Generator)
                             {
                                 if (m_pBladeData) delete m_pBladeData;
-								m_pBladeData= new BData (m_pTBEMData->getName());
                                 pitch = pitch + 0.03;
-                                m_pTBEMData->Compute(m_pBladeData,pWing,lambda,pitch,windspeed);
+                                m_pBladeData = worker.solve(pitch,windspeed,lambda);
                                 oo++;
                                 QString curpitch;
                                 curpitch.sprintf("%.1f",pitch);
@@ -6259,6 +6268,8 @@ void QBEM::OnStartTurbineSimulation()
         }
     }
 
+    m_pTBEMData->clearSweepResults();
+
     UpdateTurbines();
     SetCurveParams();
     FillComboBoxes();
@@ -7318,6 +7329,7 @@ Polar360* QBEM::LoadCylindricalFoil(QString name, double drag, double reynolds){
     pPolar->m_bisDecomposed = true;
     pPolar->pen()->setColor(g_colorManager.getLeastUsedColor(&g_360PolarStore));
     pPolar->reynolds = reynolds;
+    pPolar->CompileLookupTable();
 
     bool found = false;
 
@@ -7853,6 +7865,7 @@ void QBEM::OnEditCur360Polar()
 	if(dlg.exec() == QDialog::Accepted)
     {
         m_pCur360Polar->setDrawPoints(false);
+        m_pCur360Polar->CompileLookupTable();
         if (g_360PolarStore.add(m_pCur360Polar)){
             g_mainFrame->SetSaveState(false);
         }
@@ -9934,6 +9947,7 @@ void QBEM::OnImport360Polar(){
 
                 pPolar->m_Cm[i] = CM_new;
             }
+            pPolar->CalculateParameters();
         }
 
         if (!g_360PolarStore.add(pPolar)){
@@ -26,7 +26,6 @@
 #include "../Graph/NewCurve.h"
 #include "../ColorManager.h"
 #include "../ParameterViewer.h"
-#include <QProgressDialog>
 
 
 BEMData::BEMData(bool isProp)
@@ -215,6 +214,33 @@ void BEMData::Compute(BData *pBData, CBlade *pWing, double lambda, double windsp
 
     pBData->OnQTurbineBEM(m_pitch, pWing, windspeed, lambda);
 
+    AppendResult(pBData, pWing, lambda, windspeed);
+}
+
+BData* BEMData::CreateBDataObject(){
+
+    BData *pBData = new BData(getName());
+
+    pBData->elements = elements;
+    pBData->epsilon = epsilon;
+    pBData->iterations = iterations;
+    pBData->m_bTipLoss = m_bTipLoss;
+    pBData->m_bRootLoss = m_bRootLoss;
+    pBData->m_b3DCorrection = m_b3DCorrection;
+    pBData->m_bInterpolation = m_bInterpolation;
+    pBData->relax = relax;
+    pBData->rho = rho;
+    pBData->visc = visc;
+    pBData->m_bNewRootLoss = m_bNewRootLoss;
+    pBData->m_bNewTipLoss = m_bNewTipLoss;
+    pBData->m_bCdReynolds = m_bCdReynolds;
+    pBData->m_bPolyBEM = m_bPolyBEM;
+
+    return pBData;
+}
+
+void BEMData::AppendResult(BData *pBData, CBlade *pWing, double lambda, double windspeed)
+{
     m_data.append(pBData);
     m_Cp.append(pBData->cp);
     m_Cm.append(pBData->cp/pBData->lambda_global);
@@ -420,26 +446,32 @@ QStringList BEMData::getAvailableVariables(NewGraph::GraphType graphType) {
 void BEMData::startSimulation() {
 	const int times = int((m_tipSpeedTo-m_tipSpeedFrom)/m_tipSpeedDelta);
 
-	QProgressDialog progress("", "Abort BEM", 0, times, g_mainFrame);
-    progress.setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
-	progress.setModal(true);
-
 	CBlade *blade = static_cast<CBlade*>(getParent());
 
-	for (int i = 0; i <= times; ++i) {
-		if (progress.wasCanceled())
-			break;
+    // the tip speed ratios are split into short sequences, every sequence is one task of the sweep
 
-		QString curlambda;
-		curlambda.sprintf("%.2f", m_tipSpeedFrom + i*m_tipSpeedDelta);
-		QString text = "Compute BEM for Lambda " + curlambda;
-		progress.setLabelText(text);
-		progress.setValue(i);
+    const int numTasks = times / SWEEP_SEQUENCELENGTH + 1;
+
+    QVector<BData *> results(times+1);
+    BData **resultData = results.data();
+
+    BEMSweep sweep(blade, [this](){ return CreateBDataObject(); });
+
+    sweep.runWithProgress("Rotor BEM", numTasks, times+1, [this, resultData, times](int task, BEMSweep::Worker &worker){
+        for (int i = task*SWEEP_SEQUENCELENGTH; i <= times && i < (task+1)*SWEEP_SEQUENCELENGTH; ++i){
+            if (worker.isCanceled()) return;
+            resultData[i] = worker.solve(m_pitch, m_windspeed, m_tipSpeedFrom + i*m_tipSpeedDelta);
+        }
+    });
+
+    // the results are stored in order, a canceled sweep keeps the points that were finished
+
+	for (int i = 0; i <= times; ++i) {
+        if (!results.at(i)) continue;
 
-		BData *data = new BData (m_objectName);
-		Compute(data, blade, m_tipSpeedFrom + i*m_tipSpeedDelta, m_windspeed);
+        AppendResult(results.at(i), blade, m_tipSpeedFrom + i*m_tipSpeedDelta, m_windspeed);
 
-        data->pen()->setColor(g_colorManager.getColor(m_data.size()));
+        results.at(i)->pen()->setColor(g_colorManager.getColor(m_data.size()));
 	}
 }
 
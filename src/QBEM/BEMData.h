@@ -23,6 +23,7 @@
 #include <QColor>
 
 #include "BData.h"
+#include "BEMSweep.h"
 #include "../Graph/ShowAsGraphInterface.h"
 template <class ParameterGroup> class ParameterViewer;
 
@@ -36,6 +37,8 @@ class BEMData : public StorableObject, public ShowAsGraphInterface, public Param
 public:
 
     virtual void Compute(BData *pBData, CBlade *pWing, double lambda, double windspeed);
+    void AppendResult(BData *pBData, CBlade *pWing, double lambda, double windspeed);
+    BData* CreateBDataObject();
     void ComputeProp(BData *pBData, CBlade *pWing, double advance, double rpm);
     virtual void Clear();
 	static QStringList prepareMissingObjectMessage();
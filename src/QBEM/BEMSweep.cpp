@@ -0,0 +1,79 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "BEMSweep.h"
+
+#include "BData.h"
+#include "Blade.h"
+#include "../QTurbine/QTurbine.h"
+
+BEMSweep::Worker::Worker(BEMSweep *sweep){
+    m_sweep = sweep;
+    m_turbine = NULL;
+    m_pitch = 0;
+}
+
+BEMSweep::Worker::~Worker(){
+    if (m_turbine) delete m_turbine;
+}
+
+BData *BEMSweep::Worker::solve(double pitch, double windspeed, double lambda){
+
+    BData *pBData = m_sweep->m_createBData();
+
+    if (!m_turbine || pitch != m_pitch){
+        if (m_turbine) delete m_turbine;
+        pBData->InitializeTurbine(pitch, m_sweep->m_blade, windspeed);
+        m_turbine = pBData->m_Turbine;
+        m_pitch = pitch;
+    }
+    else{
+        pBData->m_Turbine = m_turbine;
+    }
+
+    pBData->OnQTurbineBEM(pitch, m_sweep->m_blade, windspeed, lambda, &m_induction, true);
+
+    m_sweep->m_progress++;
+
+    return pBData;
+}
+
+BEMSweep::BEMSweep(CBlade *blade, std::function<BData *()> createBData){
+    m_blade = blade;
+    m_createBData = createBData;
+}
+
+void BEMSweep::run(int numTasks, Task task){
+
+    #pragma omp parallel default (none) shared (numTasks, task)
+    {
+        Worker worker(this);
+
+        #pragma omp for schedule(dynamic)
+        for (int i=0;i<numTasks;i++){
+            if (!isCanceled()){
+                worker.resetWarmStart();
+                task(i, worker);
+            }
+        }
+    }
+}
+
+bool BEMSweep::runWithProgress(QString title, int numTasks, int numPoints, Task task){
+
+    return runInBackground(title, numPoints, [this, numTasks, task](){ run(numTasks, task); });
+}
@@ -0,0 +1,72 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef BEMSWEEP_H
+#define BEMSWEEP_H
+
+#include <QVector>
+#include <QString>
+#include <functional>
+
+#include "../Vec3.h"
+#include "../ParallelSweep.h"
+
+class BData;
+class CBlade;
+class QTurbine;
+
+// Parallel engine for the steady BEM parameter sweeps of the multi parameter, rotor and turbine
+// simulations. A sweep is split into tasks that are distributed dynamically over the OpenMP threads.
+// Every thread owns a Worker that keeps its QTurbine between the operating points and only rebuilds
+// it when the pitch angle changes, since the windspeed and tip speed ratio do not enter the blade
+// geometry. Within a task every point is started from the converged induction factors of the
+// previous point; the warm start is reset at the beginning of each task, so the results do not
+// depend on the distribution of the tasks over the threads.
+
+class BEMSweep : public ParallelSweep
+{
+public:
+    class Worker
+    {
+    public:
+        Worker(BEMSweep *sweep);
+        ~Worker();
+
+        BData *solve(double pitch, double windspeed, double lambda);   // the returned object is owned by the caller
+        void resetWarmStart(){ m_induction.clear(); }
+        bool isCanceled() const { return m_sweep->isCanceled(); }
+
+    private:
+        BEMSweep *m_sweep;
+        QTurbine *m_turbine;
+        double m_pitch;
+        QVector<Vec3> m_induction;
+    };
+
+    typedef std::function<void(int task, Worker &worker)> Task;
+
+    BEMSweep(CBlade *blade, std::function<BData *()> createBData);
+
+    void run(int numTasks, Task task);
+    bool runWithProgress(QString title, int numTasks, int numPoints, Task task);    // returns false if the sweep was canceled
+
+private:
+    CBlade *m_blade;
+    std::function<BData *()> m_createBData;
+};
+
+#endif // BEMSWEEP_H
@@ -461,6 +461,7 @@ void CBlade::restorePointers() {
     for (int i = 0; i < m_PolarAssociatedFoils.size(); ++i) g_serializer.restorePointer(reinterpret_cast<StorableObject**> (&(m_PolarAssociatedFoils[i])));
     for (int i=0;i<m_MultiPolars.size();i++) for (int j=0;j<m_MultiPolars.at(i).size();j++) g_serializer.restorePointer(reinterpret_cast<StorableObject**> (&(m_MultiPolars[i][j])));
 
+    CompileStationPolars();
 }
 
 void CBlade::serialize() {
@@ -729,47 +730,90 @@ QList<Polar360 *> CBlade::getAll360Polars() {
 	return list.toSet().toList();  // transformation removes duplicates
 }
 
-QList<double> CBlade::getStrutParameters(int numStrut, double AoA, double Re, double position){
+static void fillBladeParameters(PolarProperties &props, double chord, double sign, BladeParameters &result){
+
+    // sorts the polar properties into the order of the blade parameters, sign inverts lift and moment of inverted blades
+
+    result[BladeParameters::CL] = props[PolarProperties::CL]*sign;
+    result[BladeParameters::CD] = props[PolarProperties::CD];
+    result[BladeParameters::REYNOLDS] = props[PolarProperties::REYNOLDS];
+    result[BladeParameters::CL_ATT] = props[PolarProperties::CL_ATT];
+    result[BladeParameters::CL_SEP] = props[PolarProperties::CL_SEP];
+    result[BladeParameters::FST] = props[PolarProperties::FST];
+    result[BladeParameters::CHORD] = chord;
+    result[BladeParameters::ALPHA_ZERO] = props[PolarProperties::ALPHA_ZERO];
+    result[BladeParameters::SLOPE] = props[PolarProperties::SLOPE];
+    result[BladeParameters::IS_DECOMPOSED] = props[PolarProperties::IS_DECOMPOSED];
+    result[BladeParameters::CL_MAX] = props[PolarProperties::CL_MAX];
+    result[BladeParameters::CD_ZERO] = props[PolarProperties::CD_ZERO];
+    result[BladeParameters::CL_MIN] = props[PolarProperties::CL_MIN];
+    result[BladeParameters::ALPHA_CL_MAX] = props[PolarProperties::ALPHA_CL_MAX];
+    result[BladeParameters::ALPHA_CL_MIN] = props[PolarProperties::ALPHA_CL_MIN];
+    result[BladeParameters::CM] = props[PolarProperties::CM];
+    result[BladeParameters::DCL_DALPHA] = props[PolarProperties::DCL_DALPHA]*sign;
+    result[BladeParameters::DCD_DALPHA] = props[PolarProperties::DCD_DALPHA];
+    result[BladeParameters::DCM_DALPHA] = props[PolarProperties::DCM_DALPHA];
+}
+
+void CBlade::CompileStationPolars(){
+
+    // the multi polar list of each station is looked up once, instead of searching m_PolarAssociatedFoils on every call
+
+    m_StationPolars.clear();
+
+    if (m_bisSinglePolar) return;
+
+    for (int i=0;i<m_Airfoils.size();i++){
+        int index = -1;
+        for (int j=0;j<m_PolarAssociatedFoils.size();j++){
+            if (m_Airfoils.at(i) == m_PolarAssociatedFoils.at(j)){
+                index = j;
+                break;
+            }
+        }
+        m_StationPolars.append(index);
+    }
+}
 
-    QList<double> params, params2, result;
+QList<Polar360 *> *CBlade::getStationPolars(int station){
+
+    // falls back to the search when the compiled index does not match the current stations
+
+    if (station < m_StationPolars.size()){
+        int j = m_StationPolars.at(station);
+        if (j >= 0 && j < m_PolarAssociatedFoils.size() && j < m_MultiPolars.size() && m_Airfoils.at(station) == m_PolarAssociatedFoils.at(j)) return &m_MultiPolars[j];
+    }
+
+    for (int j=0;j<m_PolarAssociatedFoils.size() && j<m_MultiPolars.size();j++)
+        if (m_Airfoils.at(station) == m_PolarAssociatedFoils.at(j)) return &m_MultiPolars[j];
+
+    return NULL;
+}
+
+BladeParameters CBlade::getStrutParameters(int numStrut, double AoA, double Re, double position){
+
+    PolarProperties params, params2;
+    BladeParameters result;
 
     if (m_StrutList.at(numStrut)->isMulti){
         QVector<Polar360*> pVec= m_StrutList.at(numStrut)->m_MultiPolars;
         for (int j=0;j<pVec.size()-1;j++){
             if (Re < pVec.at(0)->reynolds){
-                params = pVec.at(0)->GetPropertiesAt(AoA);            
+                pVec.at(0)->GetPropertiesAt(AoA, params);            
             }
             else if (Re > pVec.at(pVec.size()-1)->reynolds){
-                params = pVec.at(pVec.size()-1)->GetPropertiesAt(AoA);
+                pVec.at(pVec.size()-1)->GetPropertiesAt(AoA, params);
             }
             else if(pVec.at(j)->reynolds < Re && Re < pVec.at(j+1)->reynolds){
-                params = pVec.at(j)->GetPropertiesAt(AoA);
-                params2 = pVec.at(j+1)->GetPropertiesAt(AoA);
+                pVec.at(j)->GetPropertiesAt(AoA, params);
+                pVec.at(j+1)->GetPropertiesAt(AoA, params2);
                 for (int m=0;m<params.size();m++) params[m] = (params.at(m)+(params2.at(m)-params.at(m))*(Re-pVec.at(j)->reynolds)/(pVec.at(j+1)->reynolds-pVec.at(j)->reynolds));
             }
         }
     }
-    else params = m_StrutList.at(numStrut)->getPolar()->GetPropertiesAt(AoA);
-
-    result.append(params[0]);
-    result.append(params[1]);
-    result.append(params[10]);
-    result.append(params[2]);
-    result.append(params[3]);
-    result.append(params[4]);
-    result.append(m_StrutList.at(numStrut)->getChordAt(position));
-    result.append(params[9]);
-    result.append(params[8]);
-    result.append(params[11]);
-    result.append(params[5]);
-    result.append(params[6]);
-    result.append(params[7]);
-    result.append(params[12]);
-    result.append(params[13]);
-    result.append(params[14]);
-    result.append(params[15]);
-    result.append(params[16]);
-    result.append(params[17]);
+    else m_StrutList.at(numStrut)->getPolar()->GetPropertiesAt(AoA, params);
+
+    fillBladeParameters(params, m_StrutList.at(numStrut)->getChordAt(position), 1.0, result);
 
     return result;
 }
@@ -778,6 +822,8 @@ void CBlade::addAllParents(){
 
     removeAllParents();
 
+    CompileStationPolars();
+
     if (m_bisSinglePolar)
     {
         m_PolarAssociatedFoils.clear();
@@ -834,7 +880,7 @@ double CBlade::GetChordAt(double position){
     return -10;
 }
 
-QList<double> CBlade::getPanelParameters(VortexPanel *panel, double AoA, double beta){
+BladeParameters CBlade::getPanelParameters(VortexPanel *panel, double AoA, double beta){
 
     //this functionality is needed to "override" the panel saved values within the D-S calculation
     if (AoA == 0) AoA = panel->m_AoA75;
@@ -845,29 +891,29 @@ QList<double> CBlade::getPanelParameters(VortexPanel *panel, double AoA, double
     double radius = panel->fromBladelength;
     double Re = panel->Reynolds;
 
-    QList<double> propStation1, propStation2;
-    QList<double> result;
+    PolarProperties propStation1, propStation2;
+    BladeParameters result;
     bool AFC_position = false;
     int pos = -1;
 
     if (panel->m_AFC){
-        propStation1 = panel->m_AFC->GetInterpolatedProperties(AoA, radius, Re,  beta);
+        panel->m_AFC->GetInterpolatedProperties(AoA, radius, Re,  beta, propStation1);
         AFC_position = true;
     }
     if (m_bisSinglePolar && !AFC_position){
         //find polars for interpolation with respect to blade position
         if (radius <= m_TPos[0]){
-                    propStation1=m_Polar[0]->GetPropertiesAt(AoA);
+                    m_Polar[0]->GetPropertiesAt(AoA, propStation1);
         }
         else if (radius >= m_TPos[m_NPanel]){
-                    propStation1=m_Polar[m_NPanel]->GetPropertiesAt(AoA);
+                    m_Polar[m_NPanel]->GetPropertiesAt(AoA, propStation1);
         }
         else{
             for (int i=0;i<m_NPanel;i++){
                 if (radius >= m_TPos[i] && radius <= m_TPos[i+1]){
                     pos = i;
-                    propStation1=m_Polar[i]->GetPropertiesAt(AoA);
-                    propStation2=m_Polar[i+1]->GetPropertiesAt(AoA);
+                    m_Polar[i]->GetPropertiesAt(AoA, propStation1);
+                    m_Polar[i+1]->GetPropertiesAt(AoA, propStation2);
                 }
             }
         }
@@ -875,33 +921,21 @@ QList<double> CBlade::getPanelParameters(VortexPanel *panel, double AoA, double
     else if (!AFC_position){
         // find polars for interpolation with respect to blade position AND reynolds number
         if (radius <= m_TPos[0]){
-            for (int i=0;i<m_PolarAssociatedFoils.size();i++){
-                if (m_Airfoils.at(0) == m_PolarAssociatedFoils.at(i)){
-                    propStation1 = ReynoldsInterpolatePolarList(AoA,Re,&m_MultiPolars[i]);
-                }
-            }
+            QList<Polar360 *> *polars = getStationPolars(0);
+            if (polars) ReynoldsInterpolatePolarList(AoA,Re,polars, propStation1);
         }
         else if (radius >= m_TPos[m_NPanel]){
-            for (int i=0;i<m_PolarAssociatedFoils.size();i++){
-                if (m_Airfoils.at(m_NPanel) == m_PolarAssociatedFoils.at(i)){
-                    propStation1 = ReynoldsInterpolatePolarList(AoA,Re,&m_MultiPolars[i]);
-                }
-            }
+            QList<Polar360 *> *polars = getStationPolars(m_NPanel);
+            if (polars) ReynoldsInterpolatePolarList(AoA,Re,polars, propStation1);
         }
         else{
             for (int i=0;i<m_NPanel;i++){
                 if (radius >= m_TPos[i] && radius <= m_TPos[i+1]){
                     pos = i;
-                    for (int j=0;j<m_PolarAssociatedFoils.size();j++){
-                        if (m_Airfoils.at(i) == m_PolarAssociatedFoils.at(j)){
-                            propStation1 = ReynoldsInterpolatePolarList(AoA,Re,&m_MultiPolars[j]);
-                        }
-                    }
-                    for (int j=0;j<m_PolarAssociatedFoils.size();j++){
-                        if (m_Airfoils.at(i+1) == m_PolarAssociatedFoils.at(j)){
-                            propStation2 = ReynoldsInterpolatePolarList(AoA,Re,&m_MultiPolars[j]);
-                        }
-                    }
+                    QList<Polar360 *> *polars = getStationPolars(i);
+                    if (polars) ReynoldsInterpolatePolarList(AoA,Re,polars, propStation1);
+                    polars = getStationPolars(i+1);
+                    if (polars) ReynoldsInterpolatePolarList(AoA,Re,polars, propStation2);
                 }
             }
         }
@@ -916,34 +950,16 @@ QList<double> CBlade::getPanelParameters(VortexPanel *panel, double AoA, double
 //        propStation1[0] = computeHimmelskamp(propStation1[0],radius,AoA,GetChordAt(radius),TSR*radius/m_TPos[m_NPanel],propStation1[8],propStation1[9]);
 //    }
 
-    result.append(propStation1[0]);
-    result.append(propStation1[1]);
-    result.append(propStation1[10]);
-    result.append(propStation1[2]);
-    result.append(propStation1[3]);
-    result.append(propStation1[4]);
-    result.append(GetChordAt(radius));
-    result.append(propStation1[9]);
-    result.append(propStation1[8]);
-    result.append(propStation1[11]);
-    result.append(propStation1[5]);
-    result.append(propStation1[6]);
-    result.append(propStation1[7]);
-    result.append(propStation1[12]);
-    result.append(propStation1[13]);
-    result.append(propStation1[14]);
-    result.append(propStation1[15]);
-    result.append(propStation1[16]);
-    result.append(propStation1[17]);
+    fillBladeParameters(propStation1, GetChordAt(radius), 1.0, result);
 
     return result;
 }
 
 
-QList<double> CBlade::getBladeParameters(double radius, double AoA, bool interpolate, double Re, bool himmelskamp, double TSR, QList<AFC*> *AFC_list, double beta, int fromBlade){
+BladeParameters CBlade::getBladeParameters(double radius, double AoA, bool interpolate, double Re, bool himmelskamp, double TSR, QList<AFC*> *AFC_list, double beta, int fromBlade){
 
-    QList<double> propStation1, propStation2;
-    QList<double> result;
+    PolarProperties propStation1, propStation2;
+    BladeParameters result;
     bool AFC_position = false;
     bool damage_position = false;
     double posA;
@@ -956,7 +972,7 @@ QList<double> CBlade::getBladeParameters(double radius, double AoA, bool interpo
         for (int i=0;i<AFC_list->size();i++){
             if (radius >= AFC_list->at(i)->posA && radius <= AFC_list->at(i)->posB){
                 if (beta==0) beta = AFC_list->at(i)->state;
-                propStation1 = AFC_list->at(i)->GetInterpolatedProperties(AoA, radius, Re,  beta);
+                AFC_list->at(i)->GetInterpolatedProperties(AoA, radius, Re,  beta, propStation1);
                 AFC_position = true;
             }
         }
@@ -969,12 +985,12 @@ QList<double> CBlade::getBladeParameters(double radius, double AoA, bool interpo
             posB = m_TPos[m_BDamageList[i]->stationB];
             if (radius >= posA && radius <= posB){
                 if (m_BDamageList.at(i)->isMulti){
-                    propStation1 = ReynoldsInterpolatePolarVector(AoA,Re,&m_BDamageList[i]->m_MultiPolarsA);
-                    if (interpolate) propStation2 = ReynoldsInterpolatePolarVector(AoA,Re,&m_BDamageList[i]->m_MultiPolarsB);
+                    ReynoldsInterpolatePolarVector(AoA,Re,&m_BDamageList[i]->m_MultiPolarsA, propStation1);
+                    if (interpolate) ReynoldsInterpolatePolarVector(AoA,Re,&m_BDamageList[i]->m_MultiPolarsB, propStation2);
                 }
                 else{
-                    propStation1 = m_BDamageList[i]->polarA->GetPropertiesAt(AoA);
-                    if (interpolate) propStation2 = m_BDamageList[i]->polarB->GetPropertiesAt(AoA);
+                    m_BDamageList[i]->polarA->GetPropertiesAt(AoA, propStation1);
+                    if (interpolate) m_BDamageList[i]->polarB->GetPropertiesAt(AoA, propStation2);
                 }
                 damage_position = true;
                 qDebug() << "isdamaged";
@@ -985,27 +1001,20 @@ QList<double> CBlade::getBladeParameters(double radius, double AoA, bool interpo
     if (!AFC_position && !damage_position){
         if (radius <= m_TPos[0]){
             if (m_bisSinglePolar){
-                propStation1=m_Polar.at(0)->GetPropertiesAt(AoA);
+                m_Polar.at(0)->GetPropertiesAt(AoA, propStation1);
             }
             else{
-                for (int i=0;i<m_PolarAssociatedFoils.size();i++){
-                    if (m_Airfoils.at(0) == m_PolarAssociatedFoils.at(i)){
-                        propStation1 = ReynoldsInterpolatePolarList(AoA,Re,&m_MultiPolars[i]);
-                    }
-                }
+                QList<Polar360 *> *polars = getStationPolars(0);
+                if (polars) ReynoldsInterpolatePolarList(AoA,Re,polars, propStation1);
             }
         }
         else if (radius >= m_TPos[m_NPanel]){
             if (m_bisSinglePolar){
-                propStation1=m_Polar.at(m_NPanel)->GetPropertiesAt(AoA);
+                m_Polar.at(m_NPanel)->GetPropertiesAt(AoA, propStation1);
             }
             else{
-
-                for (int i=0;i<m_PolarAssociatedFoils.size();i++){
-                    if (m_Airfoils.at(m_NPanel) == m_PolarAssociatedFoils.at(i)){
-                        propStation1 = ReynoldsInterpolatePolarList(AoA,Re,&m_MultiPolars[i]);
-                    }
-                }
+                QList<Polar360 *> *polars = getStationPolars(m_NPanel);
+                if (polars) ReynoldsInterpolatePolarList(AoA,Re,polars, propStation1);
             }
         }
         else{
@@ -1014,20 +1023,14 @@ QList<double> CBlade::getBladeParameters(double radius, double AoA, bool interpo
                     posA = m_TPos[i];
                     posB = m_TPos[i+1];
                     if (m_bisSinglePolar){
-                        propStation1=m_Polar.at(i)->GetPropertiesAt(AoA);
-                        if (interpolate) propStation2=m_Polar.at(i+1)->GetPropertiesAt(AoA);
+                        m_Polar.at(i)->GetPropertiesAt(AoA, propStation1);
+                        if (interpolate) m_Polar.at(i+1)->GetPropertiesAt(AoA, propStation2);
                     }
                     else{
-                        for (int j=0;j<m_PolarAssociatedFoils.size();j++){
-                            if (m_Airfoils.at(i) == m_PolarAssociatedFoils.at(j)){
-                                propStation1 = ReynoldsInterpolatePolarList(AoA,Re,&m_MultiPolars[j]);
-                            }
-                        }
-                        for (int j=0;j<m_PolarAssociatedFoils.size();j++){
-                            if (m_Airfoils.at(i+1) == m_PolarAssociatedFoils.at(j)){
-                                if (interpolate) propStation2 = ReynoldsInterpolatePolarList(AoA,Re,&m_MultiPolars[j]);
-                            }
-                        }
+                        QList<Polar360 *> *polars = getStationPolars(i);
+                        if (polars) ReynoldsInterpolatePolarList(AoA,Re,polars, propStation1);
+                        polars = getStationPolars(i+1);
+                        if (polars && interpolate) ReynoldsInterpolatePolarList(AoA,Re,polars, propStation2);
                     }
                 }
             }
@@ -1046,25 +1049,7 @@ QList<double> CBlade::getBladeParameters(double radius, double AoA, bool interpo
     double sign = 1.0;
     if (m_bIsInverted) sign = -1.0;
 
-    result.append(propStation1[0]*sign);
-    result.append(propStation1[1]);
-    result.append(propStation1[10]);
-    result.append(propStation1[2]);
-    result.append(propStation1[3]);
-    result.append(propStation1[4]);
-    result.append(GetChordAt(radius));
-    result.append(propStation1[9]);
-    result.append(propStation1[8]);
-    result.append(propStation1[11]);
-    result.append(propStation1[5]);
-    result.append(propStation1[6]);
-    result.append(propStation1[7]);
-    result.append(propStation1[12]);
-    result.append(propStation1[13]);
-    result.append(propStation1[14]);
-    result.append(propStation1[15]*sign);
-    result.append(propStation1[16]);
-    result.append(propStation1[17]);
+    fillBladeParameters(propStation1, GetChordAt(radius), sign, result);
 
     return result;
 }
@@ -2156,6 +2141,7 @@ void CBlade::Duplicate(CBlade *pWing, bool temporaryCopy, bool isVawt) {
     m_MultiPolars           = pWing->m_MultiPolars;
     m_PolarAssociatedFoils  = pWing->m_PolarAssociatedFoils;
     m_MinMaxReynolds        = pWing->m_MinMaxReynolds;
+    m_StationPolars         = pWing->m_StationPolars;
     m_bisSinglePolar        = pWing->m_bisSinglePolar;
     m_bIsInverted           = pWing->m_bIsInverted;
     m_blades                = pWing->m_blades;
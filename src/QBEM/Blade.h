@@ -34,6 +34,23 @@
 class Polar360;
 class Airfoil;
 class QDataStream;
+struct PolarProperties;
+
+/* Result of CBlade::getBladeParameters(), getPanelParameters() and getStrutParameters(), a plain struct that is returned
+ * by value without a heap allocation. The entries are stored in the order of the former QList<double> result, so that
+ * the index based code of the solvers is unchanged.
+ * */
+struct BladeParameters
+{
+    enum {CL, CD, REYNOLDS, CL_ATT, CL_SEP, FST, CHORD, ALPHA_ZERO, SLOPE, IS_DECOMPOSED, CL_MAX, CD_ZERO, CL_MIN,
+          ALPHA_CL_MAX, ALPHA_CL_MIN, CM, DCL_DALPHA, DCD_DALPHA, DCM_DALPHA, NUM_VALUES};
+
+    double value[NUM_VALUES];
+
+    int size() const { return NUM_VALUES; }
+    double &operator[] (int i) { return value[i]; }
+    double at (int i) const { return value[i]; }
+};
 
 class CBlade : public StorableObject, public ShowAsGraphInterface
 {
@@ -112,7 +129,7 @@ public:
     void CalculateSweptArea(bool isVawt);
     void GLCreateGeom(BladeDiscretization &bladeDisc, int List, bool selected, bool showSurf, bool showOut, bool showPanels, bool showAirfoils = false, bool showSurfaces = false);
     void CreateWingLLTPanels(int numPanels, int discType, BladeDiscretization &bladeDisc);
-    QList<double> getPanelParameters(VortexPanel *panel, double aoa = 0, double beta = 0);
+    BladeParameters getPanelParameters(VortexPanel *panel, double aoa = 0, double beta = 0);
     void ComputeWingGeometry(BladeDiscretization &bladeDisc);
 
     Vec3 rotations, translations;
@@ -135,8 +152,10 @@ public:
     void ScaleChord(double NewChord);
     double computeHimmelskamp(double Cl, double radius, double AoA, double chord, double TSR, double slope, double alpha_zero);
 
-    QList<double> getBladeParameters(double radius, double AoA, bool interpolate = true, double Re = 0, bool himmelskamp = false, double TSR = 0, QList<AFC *> *AFC_list = NULL, double beta = 0, int fromBlade = 0);
-    QList<double> getStrutParameters(int numStrut, double AoA, double Re, double position);
+    BladeParameters getBladeParameters(double radius, double AoA, bool interpolate = true, double Re = 0, bool himmelskamp = false, double TSR = 0, QList<AFC *> *AFC_list = NULL, double beta = 0, int fromBlade = 0);
+    BladeParameters getStrutParameters(int numStrut, double AoA, double Re, double position);
+    void CompileStationPolars();
+    QList<Polar360 *> *getStationPolars(int station);
     double GetChordAt(double position);
     void addAllParents();
 
@@ -148,6 +167,7 @@ public:
     QList< QList<Polar360 *> > m_MultiPolars;  // NM holds which polars are selected for each foil in m_PolAssFoils for multipolar
     QList<Airfoil *> m_PolarAssociatedFoils;  // NM holds all foils that are used for this blade
 	QStringList m_MinMaxReynolds;  // NM holds the string that is copied into m_Range at some point
+    QVector<int> m_StationPolars;  // index into m_MultiPolars for each station, rebuilt by CompileStationPolars() when the blade changes
 
 	QColor m_WingColor, m_OutlineColor;
 
@@ -19,7 +19,6 @@
 
 #include <QString>
 #include <QList>
-#include <QProgressDialog>
 #include <QDebug>
 
 #include "../Globals.h"
@@ -118,41 +117,21 @@ QStringList CBEMData::prepareMissingObjectMessage() {
 }
 
 void CBEMData::startSimulation() {
-	QProgressDialog progress("", "Abort BEM", 0, rottimes * windtimes * pitchtimes, g_mainFrame);
-    progress.setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
-	progress.setWindowTitle("Simulating...");
-	progress.setModal(true);
 
 	initArrays(windtimes, rottimes, pitchtimes);
 
-    int count = 0;
-	for (int i = 0; i < windtimes; ++i) {
-		const double windspeed = windstart + winddelta*i;
+    // one task per windspeed and pitch angle, the rotational speeds are solved in sequence; the pitch is
+    // the outer index so that consecutive tasks of a thread mostly share the pitch and thus the turbine
 
-		for (int j = 0; j < rottimes; ++j) {
-			const double rot = rotstart + rotdelta*j;
+    BEMSweep sweep((CBlade*) getParent(), [this](){ return CreateBDataObject(); });
 
-			for (int k = 0; k < pitchtimes; ++k) {
-				const double pitch = pitchstart + pitchdelta*k;
+    simulated = sweep.runWithProgress("Multi Parameter BEM", windtimes * pitchtimes, windtimes * rottimes * pitchtimes, [this](int task, BEMSweep::Worker &worker){
+        Compute(task % windtimes, task / windtimes, worker);
+    });
 
-				if (progress.wasCanceled()) {
-					simulated = false;
-					DeleteArrays();
-					return;
-				}
+    // a canceled sweep leaves partially filled arrays, they are released as before the parallelization
 
-				QString text = QString("Windspeed: %1 m/s\nRotational Speed: %2 1/min\nPitch Angle: %3 deg"
-									   ).arg(windspeed).arg(rot).arg(pitch);
-				progress.setLabelText(text);
-				count++;
-				progress.setValue(count);
-
-                Compute(i, j, k);
-			}
-		}
-	}
-
-	simulated = true;
+    if (!simulated) DeleteArrays();
 }
 
 NewCurve *CBEMData::newCurve(QString xAxis, QString yAxis, int windIndex, int rotIndex, int pitchIndex) {
@@ -356,10 +335,9 @@ QVariant CBEMData::accessParameter(Parameter::CBEMData::Key key, QVariant value)
 	return (set ? QVariant() : value);
 }
 
-BData* CBEMData::CreateBDataObject(double pitch, double inflowspeed){
+BData* CBEMData::CreateBDataObject(){
 
     BData *pBData = new BData(getName());
-    CBlade *pBlade = (CBlade*) getParent();
 
     pBData->elements = elements;
     pBData->epsilon = epsilon;
@@ -375,60 +353,61 @@ BData* CBEMData::CreateBDataObject(double pitch, double inflowspeed){
     pBData->m_bNewTipLoss = m_bNewTipLoss;
     pBData->m_bCdReynolds = m_bCdReynolds;
     pBData->m_bPolyBEM = m_bPolyBEM;
-    pBData->InitializeTurbine(pitch,pBlade,inflowspeed);
 
     return pBData;
 
 }
 
-void CBEMData::Compute(int i, int j, int k)
+void CBEMData::Compute(int i, int k, BEMSweep::Worker &worker)
 {
 
-    if (g_qbem->m_bStopRequested) return;
-
     CBlade *pWing = dynamic_cast<CBlade*> (this->getParent());
 
     double windspeed = windstart + i * winddelta;
-    double rot = rotstart + j * rotdelta;
     double pitch = pitchstart + k * pitchdelta;
 
-    double lambda = pWing->m_TPos[pWing->m_NPanel]*2*PI_/60/windspeed * rot;
+    for (int j=0;j<rottimes;j++){
 
-    BData* pBData = CreateBDataObject(pitch,windspeed);
+        if (worker.isCanceled()) return;
 
-    pBData->OnQTurbineBEM(pitch, pWing, windspeed, lambda);
+        double rot = rotstart + j * rotdelta;
 
-    m_Omega[i][j][k]=(rot);
-    m_V[i][j][k]=(windspeed);
-    m_Torque[i][j][k]=(PI_/2*pow(pWing->m_TPos[pWing->m_NPanel],2)*rho*pow(windspeed,3)*pBData->cp/(rot/60*2*PI_));
-    m_Ct[i][j][k]=(pBData->ct);
-    m_Lambda[i][j][k]=(lambda);
-    m_S[i][j][k]=(pow(pWing->m_TPos[pWing->m_NPanel],2)*PI_*rho/2*pow(windspeed,2)*pBData->ct);
-    m_Pitch[i][j][k]=(pitch);
-    m_Cp[i][j][k]=(pBData->cp);
-    m_Cm[i][j][k]=(pBData->cp/lambda);
-    m_P[i][j][k]=(PI_/2*pow(pWing->m_TPos[pWing->m_NPanel],2)*rho*pow(windspeed,3)*pBData->cp/1000.0);
+        double lambda = pWing->m_TPos[pWing->m_NPanel]*2*PI_/60/windspeed * rot;
 
-    double bending = 0;
-    for (int d=0;d<pBData->m_Reynolds.size();d++)
-        bending = bending + pow(pow((pow(windspeed*(1-pBData->m_a_axial.at(d)),2)+pow(windspeed*pBData->m_lambda_local.at(d)*
-                                                                                      (1+pBData->m_a_tangential.at(d)),2)),0.5),2)*rho*0.5*pBData->m_c_local[d]*pBData->m_Cn[d]*pBData->deltas.at(d)*pBData->m_pos.at(d);
+        BData* pBData = worker.solve(pitch,windspeed,lambda);
 
-    m_Bending[i][j][k]= bending;
+        m_Omega[i][j][k]=(rot);
+        m_V[i][j][k]=(windspeed);
+        m_Torque[i][j][k]=(PI_/2*pow(pWing->m_TPos[pWing->m_NPanel],2)*rho*pow(windspeed,3)*pBData->cp/(rot/60*2*PI_));
+        m_Ct[i][j][k]=(pBData->ct);
+        m_Lambda[i][j][k]=(lambda);
+        m_S[i][j][k]=(pow(pWing->m_TPos[pWing->m_NPanel],2)*PI_*rho/2*pow(windspeed,2)*pBData->ct);
+        m_Pitch[i][j][k]=(pitch);
+        m_Cp[i][j][k]=(pBData->cp);
+        m_Cm[i][j][k]=(pBData->cp/lambda);
+        m_P[i][j][k]=(PI_/2*pow(pWing->m_TPos[pWing->m_NPanel],2)*rho*pow(windspeed,3)*pBData->cp/1000.0);
 
-    double pitching = 0;
-    for (int d=0;d<pBData->m_p_moment.size();d++)
-    {
-        pitching = pitching + pBData->m_p_moment.at(d)*pBData->deltas.at(d);
-    }
-    m_Pitching[i][j][k] = pitching;
+        double bending = 0;
+        for (int d=0;d<pBData->m_Reynolds.size();d++)
+            bending = bending + pow(pow((pow(windspeed*(1-pBData->m_a_axial.at(d)),2)+pow(windspeed*pBData->m_lambda_local.at(d)*
+                                                                                          (1+pBData->m_a_tangential.at(d)),2)),0.5),2)*rho*0.5*pBData->m_c_local[d]*pBData->m_Cn[d]*pBData->deltas.at(d)*pBData->m_pos.at(d);
 
-    m_CpProp[i][j][k]= pBData->cp_prop;
-    m_CtProp[i][j][k]= pBData->ct_prop;
-    m_AdvanceRatio[i][j][k]= pBData->advance_ratio;
-    m_Eta[i][j][k]= pBData->eta;
+        m_Bending[i][j][k]= bending;
 
-    delete pBData;
+        double pitching = 0;
+        for (int d=0;d<pBData->m_p_moment.size();d++)
+        {
+            pitching = pitching + pBData->m_p_moment.at(d)*pBData->deltas.at(d);
+        }
+        m_Pitching[i][j][k] = pitching;
+
+        m_CpProp[i][j][k]= pBData->cp_prop;
+        m_CtProp[i][j][k]= pBData->ct_prop;
+        m_AdvanceRatio[i][j][k]= pBData->advance_ratio;
+        m_Eta[i][j][k]= pBData->eta;
+
+        delete pBData;
+    }
 }
 
 void CBEMData::ComputeProp(int i, int j, int k)
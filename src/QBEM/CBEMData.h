@@ -25,6 +25,7 @@
 #include "../ParameterObject.h"
 #include "../Graph/ShowAsGraphInterface.h"
 #include "BData.h"
+#include "BEMSweep.h"
 template <class P> class ParameterViewer;
 
 
@@ -48,9 +49,9 @@ public:
 	NewCurve* newCurve (QString xAxis, QString yAxis, int windIndex, int rotIndex, int pitchIndex);
 	static QStringList getAvailableVariables (NewGraph::GraphType graphType = NewGraph::None, bool xAxis = true);
 	QString getObjectName () { return m_objectName; }
-    void Compute(int i, int j, int k);
+    void Compute(int i, int k, BEMSweep::Worker &worker);   // all rotational speeds of windspeed i and pitch k
     void ComputeProp(int i, int j, int k);
-    BData* CreateBDataObject(double pitch, double inflowspeed);
+    BData* CreateBDataObject();
 
 	void serialize ();  // override from StorableObject
     void initArrays(int wtimes, int rtimes, int ptimes);
@@ -18,6 +18,7 @@
 #include "Polar360.h"
 
 #include <QDebug>
+#include <QElapsedTimer>
 
 #include "../Globals.h"
 #include "../Serializer.h"
@@ -52,6 +53,9 @@ Polar360::Polar360(QString name, StorableObject *parent)
     reynolds = 0;
 
     m_bisDecomposed = false;
+
+    m_bTableCompiled = false;
+    m_tabSize = 0;
 }
 
 void Polar360::serialize() {
@@ -148,7 +152,73 @@ Airfoil* Polar360::GetAirfoil(){
 }
 
 QList<double> Polar360::GetPropertiesAt(double AoA) {
-    QList<double> results;
+    PolarProperties props;
+    GetPropertiesAt(AoA, props);
+    return props.toList();
+}
+
+void Polar360::GetPropertiesAt(double AoA, PolarProperties &props) {
+
+    // the linear scan is used as long as the table is not compiled or does not match the data anymore
+    if (!m_bTableCompiled || m_tabSize != m_Alpha.size()){
+        GetPropertiesAtByScan(AoA, props);
+        return;
+    }
+
+    props.valid = false;
+    if (AoA != AoA) return;  // NaN, no segment is found
+
+    props.valid = true;
+    props[PolarProperties::CL_MAX] = m_tabClMax;
+    props[PolarProperties::CD_ZERO] = (alpha_zero == m_tabAlphaZero) ? m_tabCdZero : getCdAtAlphaZero();
+    props[PolarProperties::CL_MIN] = m_tabClMin;
+    props[PolarProperties::SLOPE] = slope;
+    props[PolarProperties::ALPHA_ZERO] = alpha_zero;
+    props[PolarProperties::REYNOLDS] = reynolds;
+    props[PolarProperties::IS_DECOMPOSED] = m_bisDecomposed;
+    props[PolarProperties::ALPHA_CL_MAX] = m_tabAlphaClMax;
+    props[PolarProperties::ALPHA_CL_MIN] = m_tabAlphaClMin;
+
+    if (AoA < m_tabAlpha[0] || AoA > m_tabAlpha[m_tabSize-1]){
+        props[PolarProperties::CL] = m_tabCl[0];
+        props[PolarProperties::CD] = m_tabCd[0];
+        props[PolarProperties::CL_ATT] = m_tabCl_att[0];
+        props[PolarProperties::CL_SEP] = m_tabCl_sep[0];
+        props[PolarProperties::FST] = m_tabFst[0];
+        props[PolarProperties::CM] = m_tabCm[0];
+        props[PolarProperties::DCL_DALPHA] = 0;
+        props[PolarProperties::DCD_DALPHA] = 0;
+        props[PolarProperties::DCM_DALPHA] = 0;
+        return;
+    }
+
+    // the bucket gives a first guess, the segment is then corrected to the first i with alpha[i+1] >= AoA
+    // which is the segment that the linear scan would have found
+    int b = int((AoA-m_tabAlpha[0])*m_tabBucketScale);
+    if (b < 0) b = 0;
+    if (b > m_tabBucket.size()-1) b = m_tabBucket.size()-1;
+
+    int i = m_tabBucket[b];
+    while (i > 0 && m_tabAlpha[i] >= AoA) i--;
+    while (i < m_tabSize-2 && m_tabAlpha[i+1] < AoA) i++;
+
+    // the increments are stored in float to reproduce the results of the scan exactly
+    const double frac = (AoA-m_tabAlpha[i])/m_tabDAlpha[i];
+    props[PolarProperties::CL] = m_tabCl[i]+frac*m_tabDCl[i];
+    props[PolarProperties::CD] = m_tabCd[i]+frac*m_tabDCd[i];
+    props[PolarProperties::CL_ATT] = m_tabCl_att[i]+frac*m_tabDCl_att[i];
+    props[PolarProperties::CL_SEP] = m_tabCl_sep[i]+frac*m_tabDCl_sep[i];
+    props[PolarProperties::FST] = m_tabFst[i]+frac*m_tabDFst[i];
+    props[PolarProperties::CM] = m_tabCm[i]+frac*m_tabDCm[i];
+    props[PolarProperties::DCL_DALPHA] = m_tabDCl[i]/m_tabDAlpha[i];
+    props[PolarProperties::DCD_DALPHA] = m_tabDCd[i]/m_tabDAlpha[i];
+    props[PolarProperties::DCM_DALPHA] = m_tabDCm[i]/m_tabDAlpha[i];
+}
+
+void Polar360::GetPropertiesAtByScan(double AoA, PolarProperties &props) {
+
+    props.valid = false;
+
     double clMax, CdZero, clMin, alpha_cl_max, alpha_cl_min;
     clMax = getClMaximum();
     clMin = getClMinimum();
@@ -156,51 +226,158 @@ QList<double> Polar360::GetPropertiesAt(double AoA) {
     alpha_cl_min = getAlphaClMin();
     CdZero = getCdAtAlphaZero();
 
+    props[PolarProperties::CL_MAX] = clMax;
+    props[PolarProperties::CD_ZERO] = CdZero;
+    props[PolarProperties::CL_MIN] = clMin;
+    props[PolarProperties::SLOPE] = slope;
+    props[PolarProperties::ALPHA_ZERO] = alpha_zero;
+    props[PolarProperties::REYNOLDS] = reynolds;
+    props[PolarProperties::IS_DECOMPOSED] = m_bisDecomposed;
+    props[PolarProperties::ALPHA_CL_MAX] = alpha_cl_max;
+    props[PolarProperties::ALPHA_CL_MIN] = alpha_cl_min;
+
     for (int i=0;i<m_Alpha.size()-1;i++){
         if (AoA >= m_Alpha.at(i) && AoA <= m_Alpha.at(i+1)){
-            results.append(m_Cl.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cl.at(i+1)-m_Cl.at(i)));
-            results.append(m_Cd.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cd.at(i+1)-m_Cd.at(i)));
-            results.append(m_Cl_att.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cl_att.at(i+1)-m_Cl_att.at(i)));
-            results.append(m_Cl_sep.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cl_sep.at(i+1)-m_Cl_sep.at(i)));
-            results.append(m_fst.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_fst.at(i+1)-m_fst.at(i)));
-            results.append(clMax);
-            results.append(CdZero);
-            results.append(clMin);
-            results.append(slope);
-            results.append(alpha_zero);
-            results.append(reynolds);
-            results.append(m_bisDecomposed);
-            results.append(alpha_cl_max);
-            results.append(alpha_cl_min);
-            results.append(m_Cm.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cm.at(i+1)-m_Cm.at(i)));
-            results.append((m_Cl.at(i+1)-m_Cl.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i)));
-            results.append((m_Cd.at(i+1)-m_Cd.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i)));
-            results.append((m_Cm.at(i+1)-m_Cm.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i)));
+            props[PolarProperties::CL] = m_Cl.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cl.at(i+1)-m_Cl.at(i));
+            props[PolarProperties::CD] = m_Cd.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cd.at(i+1)-m_Cd.at(i));
+            props[PolarProperties::CL_ATT] = m_Cl_att.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cl_att.at(i+1)-m_Cl_att.at(i));
+            props[PolarProperties::CL_SEP] = m_Cl_sep.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cl_sep.at(i+1)-m_Cl_sep.at(i));
+            props[PolarProperties::FST] = m_fst.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_fst.at(i+1)-m_fst.at(i));
+            props[PolarProperties::CM] = m_Cm.at(i)+(AoA-m_Alpha.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i))*(m_Cm.at(i+1)-m_Cm.at(i));
+            props[PolarProperties::DCL_DALPHA] = (m_Cl.at(i+1)-m_Cl.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i));
+            props[PolarProperties::DCD_DALPHA] = (m_Cd.at(i+1)-m_Cd.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i));
+            props[PolarProperties::DCM_DALPHA] = (m_Cm.at(i+1)-m_Cm.at(i))/(m_Alpha.at(i+1)-m_Alpha.at(i));
+            props.valid = true;
             break;
         }
     }
     if (AoA < m_Alpha.at(0) || AoA > m_Alpha.at(m_Alpha.size()-1)){
-        results.append(m_Cl.at(0));
-        results.append(m_Cd.at(0));
-        results.append(m_Cl_att.at(0));
-        results.append(m_Cl_sep.at(0));
-        results.append(m_fst.at(0));
-        results.append(clMax);
-        results.append(CdZero);
-        results.append(clMin);
-        results.append(slope);
-        results.append(alpha_zero);
-        results.append(reynolds);
-        results.append(m_bisDecomposed);
-        results.append(alpha_cl_max);
-        results.append(alpha_cl_min);
-        results.append(m_Cm.at(0));
-        results.append(0);
-        results.append(0);
-        results.append(0);
-    }
-
-    return results;
+        props[PolarProperties::CL] = m_Cl.at(0);
+        props[PolarProperties::CD] = m_Cd.at(0);
+        props[PolarProperties::CL_ATT] = m_Cl_att.at(0);
+        props[PolarProperties::CL_SEP] = m_Cl_sep.at(0);
+        props[PolarProperties::FST] = m_fst.at(0);
+        props[PolarProperties::CM] = m_Cm.at(0);
+        props[PolarProperties::DCL_DALPHA] = 0;
+        props[PolarProperties::DCD_DALPHA] = 0;
+        props[PolarProperties::DCM_DALPHA] = 0;
+        props.valid = true;
+    }
+}
+
+void Polar360::CompileLookupTable() {
+
+    /* Compiles the polar into a lookup table with O(1) access. The original alpha nodes are kept, so the results
+     * are identical to the linear scan, a uniform alpha grid stores for each bucket the first segment that can
+     * contain an angle of this bucket. Needs to be called whenever the polar data has been changed.
+     * */
+
+    m_bTableCompiled = false;
+    m_tabSize = m_Alpha.size();
+
+    if (m_tabSize < 2) return;
+    if (m_Cl.size() != m_tabSize || m_Cd.size() != m_tabSize || m_Cm.size() != m_tabSize || m_Cl_att.size() != m_tabSize ||
+        m_Cl_sep.size() != m_tabSize || m_fst.size() != m_tabSize) return;
+
+    // only monotonic polars can be compiled, all others use the scan
+    for (int i=0;i<m_tabSize-1;i++)
+        if (!(m_Alpha.at(i+1) >= m_Alpha.at(i))) return;
+    if (!(m_Alpha.at(m_tabSize-1) > m_Alpha.at(0))) return;
+
+    m_tabAlpha = m_Alpha;
+    m_tabCl = m_Cl;
+    m_tabCd = m_Cd;
+    m_tabCl_att = m_Cl_att;
+    m_tabCl_sep = m_Cl_sep;
+    m_tabFst = m_fst;
+    m_tabCm = m_Cm;
+
+    m_tabDAlpha.resize(m_tabSize-1);
+    m_tabDCl.resize(m_tabSize-1);
+    m_tabDCd.resize(m_tabSize-1);
+    m_tabDCl_att.resize(m_tabSize-1);
+    m_tabDCl_sep.resize(m_tabSize-1);
+    m_tabDFst.resize(m_tabSize-1);
+    m_tabDCm.resize(m_tabSize-1);
+
+    for (int i=0;i<m_tabSize-1;i++){
+        m_tabDAlpha[i] = m_Alpha.at(i+1)-m_Alpha.at(i);
+        m_tabDCl[i] = m_Cl.at(i+1)-m_Cl.at(i);
+        m_tabDCd[i] = m_Cd.at(i+1)-m_Cd.at(i);
+        m_tabDCl_att[i] = m_Cl_att.at(i+1)-m_Cl_att.at(i);
+        m_tabDCl_sep[i] = m_Cl_sep.at(i+1)-m_Cl_sep.at(i);
+        m_tabDFst[i] = m_fst.at(i+1)-m_fst.at(i);
+        m_tabDCm[i] = m_Cm.at(i+1)-m_Cm.at(i);
+    }
+
+    // two buckets per segment on average
+    const int numBuckets = 2*(m_tabSize-1);
+    const double range = double(m_tabAlpha[m_tabSize-1])-double(m_tabAlpha[0]);
+    m_tabBucketScale = numBuckets/range;
+    m_tabBucket.resize(numBuckets);
+
+    int seg = 0;
+    for (int b=0;b<numBuckets;b++){
+        const double bucketStart = m_tabAlpha[0]+b/m_tabBucketScale;
+        while (seg < m_tabSize-2 && m_tabAlpha[seg+1] < bucketStart) seg++;
+        m_tabBucket[b] = seg;
+    }
+
+    m_tabClMax = getClMaximum();
+    m_tabClMin = getClMinimum();
+    m_tabAlphaClMax = getAlphaClMax();
+    m_tabAlphaClMin = getAlphaClMin();
+    m_tabAlphaZero = alpha_zero;
+    m_tabCdZero = getCdAtAlphaZero();
+
+    m_bTableCompiled = true;
+}
+
+QString Polar360::BenchmarkLookup(Polar360 *polar, int numLookups) {
+
+    /* Micro benchmark of the polar lookup: the linear scan with the QList result (the former implementation) is
+     * compared to the compiled table. The maximum deviation between both results is reported as well.
+     * */
+
+    if (!polar || polar->m_Alpha.size() < 2 || numLookups < 1) return QString();
+
+    if (!polar->m_bTableCompiled) polar->CompileLookupTable();
+
+    // angles are scattered over the full range, so that no branch prediction or caching favours a method
+    QVector<double> angles(numLookups);
+    for (int i=0;i<numLookups;i++)
+        angles[i] = -180.0+360.0*double((qint64(i)*7919) % numLookups)/numLookups;
+
+    QElapsedTimer timer;
+    PolarProperties props, scanProps;
+    double checksum = 0, maxDeviation = 0;
+
+    timer.start();
+    for (int i=0;i<numLookups;i++){
+        polar->GetPropertiesAtByScan(angles[i], scanProps);
+        QList<double> list = scanProps.toList();
+        checksum += list.at(0);
+    }
+    const double scanTime = std::max(timer.nsecsElapsed()*1e-9, 1e-9);
+
+    timer.restart();
+    for (int i=0;i<numLookups;i++){
+        polar->GetPropertiesAt(angles[i], props);
+        checksum += props[PolarProperties::CL];
+    }
+    const double tableTime = std::max(timer.nsecsElapsed()*1e-9, 1e-9);
+
+    for (int i=0;i<numLookups;i+=std::max(1,numLookups/10000)){
+        polar->GetPropertiesAtByScan(angles[i], scanProps);
+        polar->GetPropertiesAt(angles[i], props);
+        for (int j=0;j<PolarProperties::NUM_VALUES;j++)
+            maxDeviation = std::max(maxDeviation, fabs(props[j]-scanProps[j]));
+    }
+
+    return QString("Polar \"%1\" (%2 nodes, table %3): scan %4 lookups/s, compiled %5 lookups/s, speedup %6, max. deviation %7 (checksum %8)")
+            .arg(polar->getName()).arg(polar->m_Alpha.size()).arg(polar->m_bTableCompiled ? "compiled" : "not compiled")
+            .arg(numLookups/scanTime, 0, 'e', 3).arg(numLookups/tableTime, 0, 'e', 3).arg(scanTime/tableTime, 0, 'f', 1)
+            .arg(maxDeviation, 0, 'e', 2).arg(checksum, 0, 'e', 3);
 }
 
 NewCurve* Polar360::newCurve (QString xAxis, QString yAxis, NewGraph::GraphType graphType){
@@ -376,6 +553,7 @@ void Polar360::CalculateParameters(){
         posalphamax = 0;
         CLzero = 0;
         CMzero = 0;
+        CompileLookupTable();
         return;
     }
 
@@ -445,6 +623,8 @@ void Polar360::CalculateParameters(){
     CLzero = clzero;
     CMzero = cmzero;
 
+    CompileLookupTable();
+
 }
 
 double Polar360::GetZeroLiftAngle()
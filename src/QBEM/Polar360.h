@@ -27,6 +27,33 @@
 #include "../StorableObject.h"
 class Airfoil;
 
+/* Result of a polar lookup, a plain struct that avoids the heap allocation of a QList. The entries are stored
+ * in the same order as in the list returned by Polar360::GetPropertiesAt(double), so that index based code can
+ * be used with both types.
+ * */
+struct PolarProperties
+{
+    enum {CL, CD, CL_ATT, CL_SEP, FST, CL_MAX, CD_ZERO, CL_MIN, SLOPE, ALPHA_ZERO, REYNOLDS, IS_DECOMPOSED,
+          ALPHA_CL_MAX, ALPHA_CL_MIN, CM, DCL_DALPHA, DCD_DALPHA, DCM_DALPHA, NUM_VALUES};
+
+    double value[NUM_VALUES];
+    bool valid;
+
+    PolarProperties() : valid(false) {}
+
+    int size() const { return valid ? NUM_VALUES : 0; }
+    double &operator[] (int i) { return value[i]; }
+    double at (int i) const { return value[i]; }
+
+    QList<double> toList() const {
+        QList<double> list;
+        if (!valid) return list;
+        list.reserve(NUM_VALUES);
+        for (int i=0;i<NUM_VALUES;i++) list.append(value[i]);
+        return list;
+    }
+};
+
 
 class Polar360 : public StorableObject, public ShowAsGraphInterface
 {
@@ -59,6 +86,9 @@ public:
     void CalculateParameters();
     void GetCnAtStallAngles(double &cnPosStallAlpha, double &cnNegStallAlpha);
     QList<double> GetPropertiesAt(double AoA);
+    void GetPropertiesAt(double AoA, PolarProperties &props);
+    void CompileLookupTable();
+    static QString BenchmarkLookup(Polar360 *polar, int numLookups = 1000000);
     Airfoil* GetAirfoil();
 	
     double alpha_zero;
@@ -84,6 +114,20 @@ public:
     QStringList m_availableVariables;
     QVector< QVector < float > *> m_Data;
 
+private:
+    void GetPropertiesAtByScan(double AoA, PolarProperties &props);
+
+    /* compiled lookup table, see CompileLookupTable(). The polar data is held as structure of arrays together with
+     * the per segment increments, a uniform alpha grid maps each angle in O(1) onto the first candidate segment.
+     * */
+    bool m_bTableCompiled;
+    int m_tabSize;
+    QVector<float> m_tabAlpha, m_tabCl, m_tabCd, m_tabCl_att, m_tabCl_sep, m_tabFst, m_tabCm;
+    QVector<float> m_tabDAlpha, m_tabDCl, m_tabDCd, m_tabDCl_att, m_tabDCl_sep, m_tabDFst, m_tabDCm;
+    QVector<int> m_tabBucket;
+    double m_tabBucketScale;
+    double m_tabClMax, m_tabClMin, m_tabAlphaClMax, m_tabAlphaClMin, m_tabCdZero, m_tabAlphaZero;
+
 };
 
 #endif // C360POLAR_H
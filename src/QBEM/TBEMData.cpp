@@ -21,6 +21,7 @@
 #include "../Store.h"
 #include "../Serializer.h"
 #include "../Graph/NewCurve.h"
+#include "Blade.h"
 
 TBEMData::TBEMData()
     : BEMData()
@@ -140,8 +141,48 @@ QStringList TBEMData::prepareMissingObjectMessage() {
 	}
 }
 
-void TBEMData::startSimulation() {
-	// TODO
+bool TBEMData::startSimulation() {
+
+    clearSweepResults();
+
+    TData *pTData = static_cast<TData*>(getParent());
+    if (!pTData) return false;
+
+    CBlade *pWing = NULL;
+    for (int i=0;i<g_rotorStore.size();i++)
+        if (g_rotorStore.at(i)->getName() == pTData->m_WingName) pWing = g_rotorStore.at(i);
+    if (!pWing) return false;
+
+    // the windspeeds are split into sequences of neighbouring points, every point of a sequence is warm
+    // started from the induction of the previous one, as in the multi parameter and rotor sweeps
+
+    const int times = m_sweepWindspeed.size();
+    const int numTasks = (times + SWEEP_SEQUENCELENGTH - 1) / SWEEP_SEQUENCELENGTH;
+    const double cutIn = pTData->CutIn, cutOut = pTData->CutOut;
+
+    m_sweepResults.fill(NULL, times);
+    BData **resultData = m_sweepResults.data();
+
+    BEMSweep sweep(pWing, [this](){ return CreateBDataObject(); });
+
+    bool finished = sweep.runWithProgress("Turbine BEM", numTasks, times, [this, resultData, times, cutIn, cutOut](int task, BEMSweep::Worker &worker){
+        for (int i = task*SWEEP_SEQUENCELENGTH; i < times && i < (task+1)*SWEEP_SEQUENCELENGTH; ++i){
+            if (worker.isCanceled()) return;
+            const double wind = m_sweepWindspeed.at(i);
+            if (wind>=cutIn && wind<=cutOut)
+                resultData[i] = worker.solve(m_sweepPitch.at(i),wind,m_sweepLambda.at(i));
+        }
+    });
+
+    if (!finished) clearSweepResults();
+
+    return finished;
+}
+
+void TBEMData::clearSweepResults() {
+
+    for (int i=0;i<m_sweepResults.size();i++) if (m_sweepResults.at(i)) delete m_sweepResults.at(i);
+    m_sweepResults.clear();
 }
 
 NewCurve *TBEMData::newCurve(QString xAxis, QString yAxis, NewGraph::GraphType graphType) {
@@ -40,7 +40,8 @@ public:
 	static QStringList prepareMissingObjectMessage();
     void initializeOutputVectors();
 
-	void startSimulation ();
+	bool startSimulation ();   // returns false if the sweep was canceled
+    void clearSweepResults();
     NewCurve* newCurve (QString xAxis, QString yAxis, NewGraph::GraphType graphType);  // returns NULL if var n.a.
 	static QStringList getAvailableVariables (NewGraph::GraphType graphType, bool xAxis);
 	QString getObjectName () { return m_objectName; }
@@ -55,6 +56,11 @@ private:
 
     QVector <float> m_Pitch;                 //pitch angle
 
+    // operating points at the initial pitch angle, defined by QBEM::OnStartTurbineSimulation(); the
+    // results are taken over by the serial pitch control, points outside of cut-in and cut-out are NULL
+    QVector<double> m_sweepWindspeed, m_sweepPitch, m_sweepLambda;
+    QVector<BData *> m_sweepResults;
+
     double OuterRadius;
 
 private:
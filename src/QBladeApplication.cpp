@@ -42,11 +42,7 @@ QBladeApplication::QBladeApplication(int &argc, char** argv) : QApplication(argc
 
     new MainFrame();
 
-    g_applicationDirectory = QApplication::applicationDirPath();
-    g_xfoilPath = QString(g_applicationDirectory + QDir::separator() + "Binaries" + QDir::separator() + "XFoil");
-    g_turbsimPath = QString(g_applicationDirectory + QDir::separator() + "Binaries" + QDir::separator() + "TurbSim64");
-    g_controllerPath = QString(g_applicationDirectory + QDir::separator() + "ControllerFiles");
-    g_tempPath = QString("Temp");
+    setGlobalPaths();
 
     g_mainFrame->setWindowTitle(g_VersionName);
 
@@ -146,6 +142,14 @@ QBladeApplication::~QBladeApplication() {
 	delete g_mainFrame;
 }
 
+void QBladeApplication::setGlobalPaths() {
+    g_applicationDirectory = QApplication::applicationDirPath();
+    g_xfoilPath = QString(g_applicationDirectory + QDir::separator() + "Binaries" + QDir::separator() + "XFoil");
+    g_turbsimPath = QString(g_applicationDirectory + QDir::separator() + "Binaries" + QDir::separator() + "TurbSim64");
+    g_controllerPath = QString(g_applicationDirectory + QDir::separator() + "ControllerFiles");
+    g_tempPath = QString("Temp");
+}
+
 void QBladeApplication::setApplicationStyle (QString style) {
 	m_styleName = style;
 	setStyle(style);
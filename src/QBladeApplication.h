@@ -28,6 +28,8 @@ class QBladeApplication : public QApplication
 public:
 	QBladeApplication(int&, char**);
 	~QBladeApplication ();
+
+    static void setGlobalPaths ();  // also used by the headless batch mode
 	
 	void setApplicationStyle (QString style);
 	QString getApplicationStyle ();
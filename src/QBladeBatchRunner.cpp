@@ -0,0 +1,343 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "QBladeBatchRunner.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QProcess>
+#include <QScopedPointer>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QElapsedTimer>
+#include <omp.h>
+
+#include "src/QSimulation/QSimulation.h"
+#include "src/ImportExport.h"
+#include "src/GlobalFunctions.h"
+#include "src/Globals.h"
+#include "src/VortexObjects/BiotSavartKernels.h"
+
+QBladeBatchRunner::QBladeBatchRunner(){
+
+    m_numProcesses = 1;
+    m_numThreads = 0;
+    m_hawc2bin = false;
+    m_hawc2ascii = false;
+    m_ascii = false;
+    m_skip = false;
+    m_checkKernels = false;
+    m_isChildProcess = false;
+}
+
+bool QBladeBatchRunner::isBatchMode(int argc, char *argv[]){
+
+    for (int i=1;i<argc;i++)
+        if (QString(argv[i]) == "-batch") return true;
+
+    return false;
+}
+
+void QBladeBatchRunner::printUsage(){
+
+    qDebug().noquote() << "usage: QBlade -batch [options] <.sim files or folders containing .sim files>";
+    qDebug().noquote() << "  -dlc <file>     evaluate the cases of a DLC table, the first column is the .sim file name (relative to the table)";
+    qDebug().noquote() << "  -out <folder>   output folder, default is the folder of each .sim file";
+    qDebug().noquote() << "  -procs <n>      number of simulations that are evaluated concurrently in separate processes (default 1)";
+    qDebug().noquote() << "  -threads <n>    number of OpenMP threads per simulation (default: cores / procs)";
+    qDebug().noquote() << "  -hawc2bin       export HAWC2 binary results (default if no format is given)";
+    qDebug().noquote() << "  -hawc2ascii     export HAWC2 ASCII results";
+    qDebug().noquote() << "  -ascii          export ASCII text results";
+    qDebug().noquote() << "  -skip           skip simulations whose results already exist in the output folder";
+    qDebug().noquote() << "  -checkkernels   compare the SIMD Biot-Savart kernels to the scalar kernels, no simulation files needed";
+}
+
+int QBladeBatchRunner::run(QStringList arguments){
+
+    if (!parseArguments(arguments)){
+        printUsage();
+        return 1;
+    }
+
+    if (m_checkKernels) return runKernelCheck();
+
+    if (!m_simFiles.size()){
+        qDebug().noquote() << "...no simulation files found";
+        printUsage();
+        return 1;
+    }
+
+    if (m_outFolder.size() && !QDir(m_outFolder).exists() && !QDir().mkpath(m_outFolder)){
+        qDebug().noquote() << "...could not create the output folder" << m_outFolder;
+        return 1;
+    }
+
+    if (!m_hawc2bin && !m_hawc2ascii && !m_ascii) m_hawc2bin = true;
+
+    m_numProcesses = qMin(qMax(m_numProcesses,1),m_simFiles.size());
+    if (m_numThreads < 1) m_numThreads = qMax(QThread::idealThreadCount()/m_numProcesses,1);
+
+    omp_set_num_threads(m_numThreads);
+
+    // the temporary controller copies of this run (and of its child processes) are placed in a folder of its own
+    // inside the temp folder; only this folder is removed at the end, the temp folder is shared with other
+    // QBlade instances that run from the same application directory
+
+    QScopedPointer<QTemporaryDir> tempDir;
+
+    if (m_tempFolder.size()) g_tempPath = m_tempFolder;
+    else{
+        QDir().mkpath(g_applicationDirectory+QDir::separator()+g_tempPath);
+        tempDir.reset(new QTemporaryDir(g_applicationDirectory+QDir::separator()+g_tempPath+QDir::separator()+"batch_XXXXXX"));
+
+        if (!tempDir->isValid()){
+            qDebug().noquote() << "...could not create a temporary folder in" << g_applicationDirectory+QDir::separator()+g_tempPath;
+            return 1;
+        }
+
+        g_tempPath = m_tempFolder = QDir(g_applicationDirectory).relativeFilePath(tempDir->path());
+    }
+
+    int exitCode;
+    if (m_numProcesses > 1) exitCode = runProcessPool();
+    else exitCode = runSequential();
+
+    return exitCode;
+}
+
+int QBladeBatchRunner::runKernelCheck(){
+
+    // exits with 1 if any instruction set deviates from the scalar kernels, so that the check can run in a build pipeline
+
+    qDebug().noquote() << "...maximum supported Biot-Savart instruction set:" << getBiotSavartISAName(getMaxSupportedBiotSavartISA());
+
+    QString result = checkBiotSavartKernels();
+    qDebug().noquote() << result;
+
+    return result.contains("FAILED") ? 1 : 0;
+}
+
+bool QBladeBatchRunner::parseArguments(QStringList arguments){
+
+    for (int i=1;i<arguments.size();i++){
+
+        QString arg = arguments.at(i);
+
+        if (arg == "-batch") continue;
+        else if (arg == "-child") m_isChildProcess = true;
+        else if (arg == "-hawc2bin") m_hawc2bin = true;
+        else if (arg == "-hawc2ascii") m_hawc2ascii = true;
+        else if (arg == "-ascii") m_ascii = true;
+        else if (arg == "-skip") m_skip = true;
+        else if (arg == "-checkkernels") m_checkKernels = true;
+        else if (arg == "-out" || arg == "-procs" || arg == "-threads" || arg == "-dlc" || arg == "-tempdir"){
+
+            if (i+1 >= arguments.size()){
+                qDebug().noquote() << "...missing value for option" << arg;
+                return false;
+            }
+
+            QString value = arguments.at(++i);
+            bool converted = true;
+
+            if (arg == "-out") m_outFolder = value;
+            else if (arg == "-procs") m_numProcesses = value.toInt(&converted);
+            else if (arg == "-threads") m_numThreads = value.toInt(&converted);
+            else if (arg == "-dlc") addDlcTable(value);
+            else if (arg == "-tempdir") m_tempFolder = value;
+
+            if (!converted){
+                qDebug().noquote() << "...could not convert the value of option" << arg << ":" << value;
+                return false;
+            }
+        }
+        else if (arg.startsWith("-")){
+            qDebug().noquote() << "...unknown option" << arg;
+            return false;
+        }
+        else addSimulationFiles(arg);
+    }
+
+    return true;
+}
+
+void QBladeBatchRunner::addSimulationFiles(QString path){
+
+    QFileInfo info(path);
+
+    if (info.isDir()){
+        QStringList files = QDir(path).entryList(QStringList("*.sim"), QDir::Files, QDir::Name);
+        for (int i=0;i<files.size();i++)
+            m_simFiles.append(QDir(path).absoluteFilePath(files.at(i)));
+    }
+    else if (info.exists()) m_simFiles.append(info.absoluteFilePath());
+    else qDebug().noquote() << "...could not find" << path;
+}
+
+void QBladeBatchRunner::addDlcTable(QString tableName){
+
+    QString error_msg;
+
+    QList<QStringList> table = FindDlcTableInFile(32, FileContentToQStringList(tableName), true, &error_msg, tableName);
+
+    if (error_msg.size()) qDebug().noquote() << error_msg;
+
+    QDir tableDir = QFileInfo(tableName).absoluteDir();
+
+    for (int i=0;i<table.size();i++){
+
+        QString caseName = table.at(i).at(0);
+        if (!caseName.endsWith(".sim")) caseName += ".sim";
+
+        addSimulationFiles(tableDir.absoluteFilePath(caseName));
+    }
+}
+
+QString QBladeBatchRunner::outputFolder(QString fileName){
+
+    if (m_outFolder.size()) return m_outFolder;
+    return QFileInfo(fileName).absolutePath();
+}
+
+bool QBladeBatchRunner::resultsExist(QString fileName){
+
+    // same naming as ExportQBladeResults(), the simulation is named after the .sim file
+
+    QString base = outputFolder(fileName) + QDir::separator() + QFileInfo(fileName).completeBaseName().replace(" ","_");
+
+    if (m_hawc2bin && !QFile(base+"_binary.sel").exists()) return false;
+    if (m_hawc2ascii && !QFile(base+"_ascii.sel").exists()) return false;
+    if (m_ascii && !QFile(base+".txt").exists()) return false;
+
+    return true;
+}
+
+bool QBladeBatchRunner::runSimulation(QString fileName){
+
+    if (m_skip && resultsExist(fileName)){
+        qDebug().noquote() << "...skipping" << fileName << "as the results already exist";
+        return true;
+    }
+
+    qDebug().noquote() << "...starting" << fileName;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    UnloadQBladeProjectNoGUI();
+
+    QSimulation *simulation = ImportSimulationDefinition(fileName, false, true, false, QFileInfo(fileName).completeBaseName());
+
+    if (!simulation){
+        qDebug().noquote() << "...could not import" << fileName;
+        return false;
+    }
+
+    simulation->resetSimulation();
+
+    bool success = false;
+
+    if (simulation->initializeControllerInstances()){
+
+        simulation->onStartAnalysis();
+
+        success = simulation->m_bFinished && !simulation->m_bAbort;
+
+        if (success) ExportQBladeResults(outputFolder(fileName), m_hawc2bin, m_hawc2ascii, m_ascii);
+        else qDebug().noquote() << "...simulation" << fileName << "aborted:" << simulation->m_AbortInfo;
+    }
+    else qDebug().noquote() << "...could not initialize the controllers of" << fileName;
+
+    unloadAllControllers();
+    UnloadQBladeProjectNoGUI();
+
+    qDebug().noquote() << "...finished" << fileName << "in" << QString().number(timer.elapsed()/1000.0,'f',1) << "s";
+
+    return success;
+}
+
+int QBladeBatchRunner::runSequential(){
+
+    QStringList failed;
+
+    for (int i=0;i<m_simFiles.size();i++)
+        if (!runSimulation(m_simFiles.at(i))) failed.append(m_simFiles.at(i));
+
+    if (!m_isChildProcess){
+        qDebug().noquote() << "...batch finished:" << m_simFiles.size()-failed.size() << "of" << m_simFiles.size() << "simulations succeeded";
+        for (int i=0;i<failed.size();i++) qDebug().noquote() << "...failed:" << failed.at(i);
+    }
+
+    return failed.size() ? 1 : 0;
+}
+
+int QBladeBatchRunner::runProcessPool(){
+
+    // every simulation is evaluated in its own child process, so that the global stores and the
+    // controller dll's of concurrent simulations do not interfere
+
+    QStringList options("-batch");
+    options << "-child" << "-threads" << QString().number(m_numThreads) << "-tempdir" << m_tempFolder;
+    if (m_outFolder.size()) options << "-out" << m_outFolder;
+    if (m_hawc2bin) options << "-hawc2bin";
+    if (m_hawc2ascii) options << "-hawc2ascii";
+    if (m_ascii) options << "-ascii";
+    if (m_skip) options << "-skip";
+
+    qDebug().noquote() << "...evaluating" << m_simFiles.size() << "simulations in" << m_numProcesses << "processes with" << m_numThreads << "threads each";
+
+    QList<QProcess*> running;
+    QStringList runningFiles, failed;
+    int next = 0;
+
+    while (next < m_simFiles.size() || running.size()){
+
+        while (running.size() < m_numProcesses && next < m_simFiles.size()){
+
+            QProcess *process = new QProcess();
+            process->setProcessChannelMode(QProcess::ForwardedChannels);
+            process->start(QCoreApplication::applicationFilePath(), QStringList(options) << m_simFiles.at(next));
+
+            if (process->waitForStarted()){
+                running.append(process);
+                runningFiles.append(m_simFiles.at(next));
+            }
+            else{
+                qDebug().noquote() << "...could not start a process for" << m_simFiles.at(next);
+                failed.append(m_simFiles.at(next));
+                delete process;
+            }
+            next++;
+        }
+
+        for (int i=running.size()-1;i>=0;i--){
+            if (running.at(i)->state() == QProcess::NotRunning || running.at(i)->waitForFinished(100)){
+                if (running.at(i)->exitStatus() != QProcess::NormalExit || running.at(i)->exitCode() != 0)
+                    failed.append(runningFiles.at(i));
+                delete running.takeAt(i);
+                runningFiles.removeAt(i);
+            }
+        }
+    }
+
+    qDebug().noquote() << "...batch finished:" << m_simFiles.size()-failed.size() << "of" << m_simFiles.size() << "simulations succeeded";
+    for (int i=0;i<failed.size();i++) qDebug().noquote() << "...failed:" << failed.at(i);
+
+    return failed.size() ? 1 : 0;
+}
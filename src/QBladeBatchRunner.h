@@ -0,0 +1,65 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef QBLADEBATCHRUNNER_H
+#define QBLADEBATCHRUNNER_H
+
+#include <QStringList>
+
+// Headless batch mode for load case campaigns, QBlade is started without MainFrame, modules or
+// OpenGL and evaluates a list of .sim files (or the cases of a DLC table) one after another, or
+// concurrently in a pool of child processes. The results of every simulation are exported to
+// HAWC2 binary/ASCII or plain ASCII files and the project is cleared before the next case.
+//
+// QBlade -batch [-out <dir>] [-procs <n>] [-threads <n>] [-dlc <table>] [-hawc2bin] [-hawc2ascii] [-ascii] [-skip] <.sim files or folders>
+// QBlade -batch -checkkernels     (compares the SIMD Biot-Savart kernels to the scalar kernels)
+
+class QBladeBatchRunner
+{
+public:
+    QBladeBatchRunner();
+
+    static bool isBatchMode(int argc, char *argv[]);
+    static void printUsage();
+
+    int run(QStringList arguments);     // returns the exit code of the application
+
+private:
+    bool parseArguments(QStringList arguments);
+    void addSimulationFiles(QString path);
+    void addDlcTable(QString tableName);
+
+    int runKernelCheck();
+    int runSequential();
+    int runProcessPool();
+    bool runSimulation(QString fileName);
+
+    QString outputFolder(QString fileName);
+    bool resultsExist(QString fileName);
+
+    QStringList m_simFiles;
+    QString m_outFolder;
+    QString m_tempFolder;   // temp folder of this run relative to the application directory, passed on to the child processes
+    int m_numProcesses;
+    int m_numThreads;
+    bool m_hawc2bin, m_hawc2ascii, m_ascii;
+    bool m_skip;
+    bool m_checkKernels;
+    bool m_isChildProcess;
+};
+
+#endif // QBLADEBATCHRUNNER_H
@@ -19,7 +19,6 @@
 
 #include <QString>
 #include <QList>
-#include <QProgressDialog>
 
 #include "../Store.h"
 #include "../Serializer.h"
@@ -201,42 +200,17 @@ void CDMSData::DeleteArrays()
 }
 
 void CDMSData::startSimulation() {
-	QProgressDialog progress("", "Abort DMS", 0, rottimes * windtimes * pitchtimes, g_mainFrame);
-    progress.setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
-	progress.setWindowTitle("Simulating...");
-	progress.setModal(true);
-	
+
 	initArrays(windtimes, rottimes, pitchtimes);
-	
-	int count = 0;
-	for (int i = 0; i < windtimes; ++i) {
-		const double windspeed = windstart + winddelta*i;
-		
-		for (int j = 0; j < rottimes; ++j) {
-			const double rot = rotstart + rotdelta*j;
-			
-			for (int k = 0; k < pitchtimes; ++k) {
-				const double pitch = pitchstart + pitchdelta*k;
-				
-				if (progress.wasCanceled()) {
-					simulated = false;
-					DeleteArrays();
-					return;
-				}
-				
-				QString text = QString("Windspeed: %1 m/s\nRotational Speed: %2 1/min\nPitch Angle: %3 deg"
-									   ).arg(windspeed).arg(rot).arg(pitch);
-				progress.setLabelText(text);
-				count++;
-				progress.setValue(count);
-								
-                Compute(i,j,k);
-				
-			}
-		}
-	}
-	
-	simulated = true;
+
+    // one task per windspeed and pitch angle, the rotational speeds of a task are solved in sequence
+    // so that every point starts from the interference factors of the previous one
+
+    DMSSweep sweep((CBlade*) getParent(), [this](){ return CreateDDataObject(); });
+
+    simulated = sweep.runWithProgress("Multi Parameter DMS", windtimes * pitchtimes, windtimes * rottimes * pitchtimes, [this](int task, DMSSweep::Worker &worker){
+        Compute(task % windtimes, task / windtimes, worker);
+    });
 }
 
 NewCurve *CDMSData::newCurve(QString xAxis, QString yAxis, int windIndex, int rotIndex, int pitchIndex) {
@@ -395,17 +369,9 @@ void CDMSData::initArrays(int wtimes, int rtimes, int ptimes)
 
 }
 
-void CDMSData::Compute(int i, int j, int k) {
-
-    if (g_qdms->m_bStopRequested) return;
+DData* CDMSData::CreateDDataObject() {
 
     DData *pDData = new DData (getName());
-    CBlade *pWing = (CBlade *) getParent();
-
-    double windspeed = windstart + i * winddelta;
-    double rot = rotstart + j * rotdelta;
-    double pitch = pitchstart + k * pitchdelta;
-    double lambda = (rot * pWing->m_MaxRadius / 60 * 2 * PI_) / windspeed;
 
 	pDData->elements = elements;
 	pDData->epsilon = epsilon;
@@ -421,40 +387,56 @@ void CDMSData::Compute(int i, int j, int k) {
 	pDData->bLogarithmic = m_bLogarithmic;
 	pDData->exponent = exponent;
 	pDData->roughness = roughness;
-	pDData->windspeed = windspeed;
-	
+
 	pDData->Toff = 0;
-	
-	pDData->Init(pWing, lambda, pitch);
-	pDData->OnDMS(pWing);
 
-    if (!pDData->m_bBackflow)
-    {
-        m_P[i][j][k]=0.5*rho*pow(windspeed,3)*pDData->sweptArea*pDData->cp;
-        m_Torque[i][j][k]=0.5*rho*pow(windspeed,3)*pDData->sweptArea*pDData->cp/(rot/60*2*PI_);
-        m_Thrust[i][j][k]=0.5*rho*pow(windspeed,2)*pDData->sweptArea*pDData->ct;;
+    return pDData;
+}
 
-        m_Lambda[i][j][k]=(lambda);
-        m_one_over_Lambda[i][j][k]=(1/lambda);
+void CDMSData::Compute(int i, int k, DMSSweep::Worker &worker) {
 
-        m_V[i][j][k]=(windspeed);
-        m_w[i][j][k]=(rot);
-        m_Pitch[i][j][k]=(pitch);
+    CBlade *pWing = (CBlade *) getParent();
 
-        m_Cp[i][j][k]=(pDData->cp);
-        m_Cp1[i][j][k]=(pDData->cp1);
-        m_Cp2[i][j][k]=(pDData->cp2);
+    double windspeed = windstart + i * winddelta;
+    double pitch = pitchstart + k * pitchdelta;
 
-        m_Cm[i][j][k]=(pDData->cm);
-        m_Cm1[i][j][k]=(pDData->cm1);
-        m_Cm2[i][j][k]=(pDData->cm2);
+    for (int j=0;j<rottimes;j++){
 
-        m_Ct[i][j][k]=(pDData->ct);
-        m_Ct1[i][j][k]=(pDData->ct1);
-        m_Ct2[i][j][k]=(pDData->ct2);
-    }
+        if (worker.isCanceled()) return;
+
+        double rot = rotstart + j * rotdelta;
+        double lambda = (rot * pWing->m_MaxRadius / 60 * 2 * PI_) / windspeed;
+
+        DData *pDData = worker.solve(lambda, pitch, windspeed);
 
-    delete pDData;
+        if (!pDData->m_bBackflow)
+        {
+            m_P[i][j][k]=0.5*rho*pow(windspeed,3)*pDData->sweptArea*pDData->cp;
+            m_Torque[i][j][k]=0.5*rho*pow(windspeed,3)*pDData->sweptArea*pDData->cp/(rot/60*2*PI_);
+            m_Thrust[i][j][k]=0.5*rho*pow(windspeed,2)*pDData->sweptArea*pDData->ct;;
+
+            m_Lambda[i][j][k]=(lambda);
+            m_one_over_Lambda[i][j][k]=(1/lambda);
+
+            m_V[i][j][k]=(windspeed);
+            m_w[i][j][k]=(rot);
+            m_Pitch[i][j][k]=(pitch);
+
+            m_Cp[i][j][k]=(pDData->cp);
+            m_Cp1[i][j][k]=(pDData->cp1);
+            m_Cp2[i][j][k]=(pDData->cp2);
+
+            m_Cm[i][j][k]=(pDData->cm);
+            m_Cm1[i][j][k]=(pDData->cm1);
+            m_Cm2[i][j][k]=(pDData->cm2);
+
+            m_Ct[i][j][k]=(pDData->ct);
+            m_Ct1[i][j][k]=(pDData->ct1);
+            m_Ct2[i][j][k]=(pDData->ct2);
+        }
+
+        delete pDData;
+    }
 }
 
 void CDMSData::serialize() {
@@ -23,6 +23,7 @@
 #include <QColor>
 
 #include "DData.h"
+#include "DMSSweep.h"
 #include "../ParameterObject.h"
 template <class ParameterGroup> class ParameterViewer;
 
@@ -38,7 +39,8 @@ public:
 
 public:
     void initializeOutputVectors();
-    void Compute(int i, int j, int k);
+    void Compute(int i, int k, DMSSweep::Worker &worker);
+    DData* CreateDDataObject();
 	void serialize();  // override from StorableObject
     void initArrays(int wtimes, int rtimes, int ptimes);
     void DeleteArrays();
@@ -17,6 +17,7 @@
 
 #include "DData.h"
 #include <math.h>
+#include <QElapsedTimer>
 #include "QDebug"
 
 #include "src/PolarModule/Polar.h"
@@ -190,6 +191,8 @@ DData::DData(QString dmsName)
 {
 
     m_bBackflow     =   false;
+    m_totalIterations = 0;
+    m_computeTime = 0;
 
     m_bTipLoss = false;
     m_bVariable = false;
@@ -435,8 +438,11 @@ void DData::Init(CBlade *pWing, double lambda, double pitch)
 }
 
 
-void DData::OnDMS(CBlade *pBlade)
+void DData::OnDMS(CBlade *pBlade, QVector<float> *interference)
 {
+    QElapsedTimer timer;
+    timer.start();
+
     double alpha = 0, alpha_deg, delta, theta, F, RE = 0, REBlade = 0;
     double u, u_old, u2, u2_old, delta_u;
     double omega, X, V, W = 0, CL = 0, CD = 0, CM = 0;
@@ -502,6 +508,13 @@ void DData::OnDMS(CBlade *pBlade)
     // tower height
 //    h_tower = m_pos.at(elements-1) - height;
 
+    // the converged interference factors are stored per element, for every azimuthal position if the
+    // interference factors are variable or once for the upwind and downwind half otherwise. When the
+    // factors of a neighbouring operating point are passed they are used as the initial guess
+    const int numFactors = m_bVariable ? 72 : 2;
+    const bool warmStart = interference && interference->size() == int(elements)*numFactors;
+    if (interference && !warmStart) interference->resize(int(elements)*numFactors);
+
 
     // variable interference factors
     if (m_bVariable)
@@ -530,6 +543,7 @@ void DData::OnDMS(CBlade *pBlade)
 
                 // upwind interference factor
 				u = 0;
+                if (warmStart) u = interference->at(i*72+l);
                 delta_u = 10000;
                 u_old=u;
 //                u_older=u;
@@ -608,7 +622,7 @@ void DData::OnDMS(CBlade *pBlade)
                     alpha_corrected = alpha_deg;
                     ConstrainAngle_180_180_Degree(alpha_corrected);
 
-                    QList<double> ClCd;
+                    BladeParameters ClCd;
 
                     //getting lift and drag coefficients
 
@@ -671,6 +685,8 @@ void DData::OnDMS(CBlade *pBlade)
 
 				}// convergence
 
+                if (interference) (*interference)[i*72+l] = u;
+
 				u = (1-u);
 
                 // save final azi results
@@ -777,6 +793,7 @@ void DData::OnDMS(CBlade *pBlade)
 
                 // up and downwind interference factor
 				u2 = 0;
+                if (warmStart) u2 = interference->at(i*72+l);
                 delta_u = 10000;
                 u2_old=u2;
 //                u2_older=u2;
@@ -848,7 +865,7 @@ void DData::OnDMS(CBlade *pBlade)
                     ConstrainAngle_180_180_Degree(alpha_corrected);
 
 
-                    QList<double> ClCd;
+                    BladeParameters ClCd;
 
                     //getting lift and drag coefficients
 
@@ -901,6 +918,9 @@ void DData::OnDMS(CBlade *pBlade)
                     }
 
                 }// convergence
+
+                if (interference) (*interference)[i*72+l] = u2;
+
 				u2 = 1-u2;
 
                 // save final azi results
@@ -1003,6 +1023,7 @@ void DData::OnDMS(CBlade *pBlade)
 
             // upwind interference factor
             u = 1;
+            if (warmStart) u = interference->at(i*2);
             delta_u = 10000;
             u_old=u;
 //            u_older=u;
@@ -1091,7 +1112,7 @@ void DData::OnDMS(CBlade *pBlade)
                     alpha_corrected = alpha_deg;
                     ConstrainAngle_180_180_Degree(alpha_corrected);
 
-                    QList<double> ClCd;
+                    BladeParameters ClCd;
 
                     //getting lift and drag coefficients
 
@@ -1186,6 +1207,8 @@ void DData::OnDMS(CBlade *pBlade)
 
             }// convergence
 
+            if (interference) (*interference)[i*2] = u;
+
             // load distribution
             tempCFNlist.append(tempCFN);
             tempCFTlist.append(tempCFT);
@@ -1239,6 +1262,7 @@ void DData::OnDMS(CBlade *pBlade)
 
             // downwind interference factors
             u2 = 1;
+            if (warmStart) u2 = interference->at(i*2+1);
             delta_u = 10000;
             u2_old=u2;
             // iterations counter
@@ -1323,7 +1347,7 @@ void DData::OnDMS(CBlade *pBlade)
                     alpha_corrected = alpha_deg;
                     ConstrainAngle_180_180_Degree(alpha_corrected);
 
-                    QList<double> ClCd;
+                    BladeParameters ClCd;
 
                     //getting lift and drag coefficients
 
@@ -1404,6 +1428,8 @@ void DData::OnDMS(CBlade *pBlade)
 
             }// convergence
 
+            if (interference) (*interference)[i*2+1] = u2;
+
             // load distribution
             tempCFNlist[i] = tempCFN;
             tempCFTlist[i] = tempCFT;
@@ -1628,6 +1654,12 @@ void DData::OnDMS(CBlade *pBlade)
         }
     }
 
+    // convergence statistics, the iterations are stored as averages over the azimuthal positions for variable interference factors
+    double it = 0;
+    for (int i=0;i<m_it_up.size() && i<m_it_dw.size();i++) it += m_it_up.at(i) + m_it_dw.at(i);
+    m_totalIterations = qRound((m_bVariable ? 36 : 1) * it);
+    m_computeTime = timer.nsecsElapsed() / 1.0e6;
+
 }
 
 void DData::serialize(){
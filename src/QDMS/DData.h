@@ -67,7 +67,7 @@ public:
 	void serialize();
 	static DData* newBySerialize();
 	void Init(CBlade *pWing, double lambda, double pitch);
-    void OnDMS(CBlade *pBlade);
+    void OnDMS(CBlade *pBlade, QVector<float> *interference = NULL);  // interference: converged interference factors, used as initial guess if the size matches
 
 //private:
     QString m_WingName;
@@ -168,6 +168,10 @@ public:
 
     bool m_bBackflow;
 
+    // convergence statistics of the last OnDMS call, not serialized
+    int m_totalIterations;           //sum of the iterations over all streamtubes
+    double m_computeTime;            //time spent in OnDMS in ms
+
     QStringList m_availableBladeVariables, m_availableAziVariables;
 
 
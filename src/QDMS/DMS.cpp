@@ -23,6 +23,7 @@
 #include "OptimizeDlgVAWT.h"
 #include "BladeScaleDlgVAWT.h"
 #include "CreateDMSDlg.h"
+#include "DMSSweep.h"
 #include "src/Globals.h"
 #include "src/QBEM/PrescribedValuesDlg.h"
 #include "src/StoreAssociatedComboBox.h"
@@ -4128,12 +4129,10 @@ void QDMS::OnStartRotorSimulation()
 	SimuWidgetDMS *pSimuWidgetDMS = (SimuWidgetDMS *) m_pSimuWidgetDMS;
 
     double lstart, lend, ldelta;
-    int times;
 
 	lstart  =   pSimuWidgetDMS->m_pctrlLSLineEdit->getValue();
 	lend    =   pSimuWidgetDMS->m_pctrlLELineEdit->getValue();
 	ldelta  =   pSimuWidgetDMS->m_pctrlLDLineEdit->getValue();
-    times   =   int((lend-lstart)/ldelta);
 
 	dlg_lambdastart = pSimuWidgetDMS->m_pctrlLSLineEdit->getValue();
 	dlg_lambdaend   = pSimuWidgetDMS->m_pctrlLELineEdit->getValue();
@@ -4141,40 +4140,17 @@ void QDMS::OnStartRotorSimulation()
 
     m_pDMSData->Clear();
 
-    QProgressDialog progress("", "Abort DMS", 0, times, this);
-    progress.setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
-    progress.setMinimumDuration(1000);
-    progress.setModal(true);
+    m_pDMSData->m_tipSpeedFrom = lstart;
+    m_pDMSData->m_tipSpeedTo = lend;
+    m_pDMSData->m_tipSpeedDelta = ldelta;
 
-    for (int i=0;i<=times;i++)
-    {
-    if (progress.wasCanceled()) break;
-
-
-    QString curlambda;
-    curlambda.sprintf("%.2f",lstart+i*ldelta);
-    QString text = "Compute DMS for Lambda " + curlambda;
-    progress.setLabelText(text);
-    progress.setValue(i);
-
-
-
-	DData *data = new DData (m_pDMSData->getName());
-    m_pDMSData->Compute(data,m_pBlade,lstart+i*ldelta, m_pDMSData->m_windspeed);
-
-    if (!data->m_bBackflow)
-    {
-        data->pen()->setColor(g_colorManager.getColor(m_pDMSData->m_data.size()));
-
-        m_pDData = m_pDMSData->m_data[0];
-
-        selected_lambda = -1;
-        selected_height = 0;
-        CreateRotorCurves();
-    }
+    m_pDMSData->startSimulation();
 
-    }
+    m_pDData = m_pDMSData->m_data.size() ? m_pDMSData->m_data[0] : NULL;
 
+    selected_lambda = -1;
+    selected_height = 0;
+    CreateRotorCurves();
 
     UpdateBlades();
     SetCurveParams();
@@ -4328,11 +4304,11 @@ void QDMS::OnStartCharacteristicSimulation()
 	DData *pDData;
 	pDData = NULL;
 
-	double vstart, vend, vdelta, windspeed;
-	double rotstart, rotend, rotdelta, rot;
-	double pitchstart, pitchend, pitchdelta, pitch;
+	double vstart, vend, vdelta;
+	double rotstart, rotend, rotdelta;
+	double pitchstart, pitchend, pitchdelta;
 	double lambda;
-	int vtimes, rottimes, pitchtimes, times;
+	int vtimes, rottimes, pitchtimes;
 
     m_pCDMSData->DeleteArrays(); //// if the simulation was run previously the old arrays are deleted
 
@@ -4366,8 +4342,6 @@ void QDMS::OnStartCharacteristicSimulation()
 	if (pSimuWidgetDMS->PitchFixed->isChecked()) pitchtimes = 1;
 	m_pCDMSData->pitchtimes = pitchtimes;
 
-	times = (rottimes)*(vtimes)*(pitchtimes);
-
 	dlg_windstart2  = pSimuWidgetDMS->WindStart->getValue();
 	dlg_windend2    = pSimuWidgetDMS->WindEnd->getValue();
 	dlg_winddelta2  = pSimuWidgetDMS->WindDelta->getValue();
@@ -4380,45 +4354,11 @@ void QDMS::OnStartCharacteristicSimulation()
 	dlg_rotend      = pSimuWidgetDMS->RotEnd->getValue();
 	dlg_rotdelta    = pSimuWidgetDMS->RotDelta->getValue();
 
-	////////get wing and associated polars;
-	CBlade *pWing;
-    pWing = m_pBlade;
-
-    m_pCDMSData->initArrays(vtimes,rottimes,pitchtimes);
-
-    m_bStopRequested = false;
-    m_progressDialog = new QProgressDialog ("Running Multi-Threaded Multi Parameter DMS Simulation ("+QString().number(times)+" Simulations)\nPlease wait...", "Cancel", 0, times,this);
-    m_progressDialog->setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
-    m_progressDialog->setModal(true);
-    m_progressDialog->setValue(0);
-    m_progressDialog->setWindowTitle("Multi Parameter DMS");
-
-    QPushButton *cancelButton = m_progressDialog->findChild<QPushButton *>();
-    cancelButton->disconnect();
-    connect(cancelButton, SIGNAL(clicked(bool)), this, SLOT(OnCancelProgress()));
-    m_progressDialog->show();
-
-    m_pCDMSData->simulated = true;
-    m_progress = 0;
-
-    QThreadPool::globalInstance()->setMaxThreadCount(QThread::idealThreadCount());
-
-    for (int i=0;i<vtimes;i++){
-		windspeed = vstart+vdelta*i;
-
-        for (int j=0;j<rottimes;j++){
-			rot = rotstart+rotdelta*j;
+    m_pCDMSData->startSimulation();
 
-            for (int k=0;k<pitchtimes;k++){
-				pitch = pitchstart+pitchdelta*k;
-
-                QFuture<void> t2 = QtConcurrent::run(m_pCDMSData,&CDMSData::Compute,i, j, k);
-                QFutureWatcher<void> *watch2 = new QFutureWatcher<void>;
-                watch2->setFuture(t2);
-                connect(watch2,&QFutureWatcher<void>::finished,this,&QDMS::OnUpdateProgress);
-			}
-		}
-    }
+    UpdateCharacteristicsSimulation();
+    SetCurveParams();
+    FillComboBoxes();
 }
 
 void QDMS::OnUpdateProgress(){
@@ -4548,14 +4488,13 @@ void QDMS::OnStartTurbineSimulation()
 	
 	CBlade *pWing = g_verticalRotorStore.getObjectByNameOnly(m_pTData->m_WingName);
 	
-	QProgressDialog progress("", "Abort DMS", 0, times, this);
-	progress.setMinimumDuration(1000);
-	progress.setModal(true);
-	
+	// the operating points are determined first, the windspeeds are then solved in parallel in sequences
+	// of neighbouring windspeeds that share the interference factors as initial guess
+
+	QVector<double> sweepRot(times+1);
+
 	for (int i=0;i<=times;i++)
 	{
-		if (progress.wasCanceled()) break;
-		
 		windspeed = vstart+vdelta*i;
 		
 		//// check which rotational speed is used (for fixed, 2step and variable)////
@@ -4575,22 +4514,39 @@ void QDMS::OnStartTurbineSimulation()
             double dummy;
             InterpolatePitchRPMData(windspeed,dummy,rot);
 		}
-		
-		QString curwind;
-		curwind.sprintf("%.2f",windspeed);
-		QString text = "Compute DMS for Windspeed " + curwind;
-		progress.setLabelText(text);
-		progress.setValue(i);
+
+		sweepRot[i] = rot;
+	}
+
+	Toff = m_pTData->Offset;
+
+	const int numTasks = times / SWEEP_SEQUENCELENGTH + 1;
+
+	QVector<DData *> results(times+1);
+	DData **resultData = results.data();
+
+	DMSSweep sweep(pWing, [this, Toff](){ DData *pDData = m_pTDMSData->CreateDDataObject(); pDData->Toff = Toff; return pDData; });
+
+	sweep.runWithProgress("Turbine DMS", numTasks, times+1, [&](int task, DMSSweep::Worker &worker){
+		for (int i = task*SWEEP_SEQUENCELENGTH; i <= times && i < (task+1)*SWEEP_SEQUENCELENGTH; ++i){
+			if (worker.isCanceled()) return;
+			double wind = vstart+vdelta*i;
+			if (wind>=m_pTData->CutIn && wind<=m_pTData->CutOut)
+				resultData[i] = worker.solve((sweepRot.at(i)*m_pTData->MaxRadius/60*2*PI_)/wind, 0, wind);
+		}
+	});
+
+	for (int i=0;i<=times;i++)
+	{
+		windspeed = vstart+vdelta*i;
+		rot = sweepRot.at(i);
 		
 		lambda = (rot*m_pTData->MaxRadius/60*2*PI_)/windspeed;
 		//lambda = m_pTData->OuterRadius*2*PI_/60/windspeed*rot;
 		
-		Toff = m_pTData->Offset;
-		
-		if (windspeed>=m_pTData->CutIn && windspeed<=m_pTData->CutOut)
+		if (results.at(i))
 		{
-			data= new DData (m_pTDMSData->getName());
-			m_pTDMSData->Compute(data,pWing,lambda,0,Toff,windspeed);
+			data = results.at(i);
 			
 			if (!data->m_bBackflow)
 			{
@@ -4629,10 +4585,13 @@ void QDMS::OnStartTurbineSimulation()
 				m_pTDMSData->m_Cm1.append(data->cm1);
 				m_pTDMSData->m_Cm2.append(data->cm2);
 				m_pTDMSData->m_Lambda.append(lambda);
+				m_pTDMSData->m_Iterations.append(data->m_totalIterations);
+				m_pTDMSData->m_ComputeTime.append(data->m_computeTime);
 
                 data->pen()->setColor(g_colorManager.getColor(m_pTDMSData->m_data.size()));
 				m_pTurbineDData = m_pTDMSData->m_data[0];
 			}
+			else delete data;
 			
 			selected_windspeed = -1;
 			
@@ -20,7 +20,6 @@
 #include <QString>
 #include <QList>
 #include <QDebug>
-#include <QProgressDialog>
 
 #include "../QBEM/Blade.h"
 #include "../Globals.h"
@@ -28,6 +27,7 @@
 #include "../Serializer.h"
 #include "../MainFrame.h"
 #include "DData.h"
+#include "DMSSweep.h"
 #include "../Graph/NewCurve.h"
 #include "../ColorManager.h"
 #include "../ParameterViewer.h"
@@ -99,6 +99,10 @@ void DMSData::initializeOutputVectors(){
     m_Data.append(&m_Cm1);
     m_availableVariables.append("Torque Coefficient Cq2 [-]");
     m_Data.append(&m_Cm2);
+    m_availableVariables.append("DMS Iterations [-]");
+    m_Data.append(&m_Iterations);
+    m_availableVariables.append("Computation Time [ms]");
+    m_Data.append(&m_ComputeTime);
 
 }
 
@@ -185,6 +189,8 @@ void DMSData::Clear()
     m_Windspeed.clear();
     m_Omega.clear();
     m_Thrust.clear();
+    m_Iterations.clear();
+    m_ComputeTime.clear();
 }
 
 
@@ -213,6 +219,36 @@ void DMSData::Compute(DData *pDData, CBlade *pWing, double lambda, double inflow
     pDData->Init(pWing,lambda,0);
     pDData->OnDMS(pWing);
 
+    AppendResult(pDData, pWing, lambda, inflowspeed);
+}
+
+DData* DMSData::CreateDDataObject()
+{
+    DData *pDData = new DData (m_objectName);
+
+    pDData->elements = elements;
+    pDData->epsilon = epsilon;
+    pDData->iterations = iterations;
+    pDData->m_bTipLoss = m_bTipLoss;
+    pDData->m_bAspectRatio = m_bAspectRatio;
+    pDData->m_bVariable = m_bVariable;
+
+    pDData->relax = relax;
+    pDData->rho = rho;
+    pDData->visc = visc;
+    pDData->Toff = 0;
+
+    pDData->bPowerLaw = m_bPowerLaw;
+    pDData->bConstant = m_bConstant;
+    pDData->bLogarithmic = m_bLogarithmic;
+    pDData->exponent = exponent;
+    pDData->roughness = roughness;
+
+    return pDData;
+}
+
+void DMSData::AppendResult(DData *pDData, CBlade *pWing, double lambda, double inflowspeed)
+{
     double rot = lambda / pWing->m_MaxRadius *60 / 2 / PI_ * inflowspeed;
 
     if (!pDData->m_bBackflow)
@@ -233,6 +269,8 @@ void DMSData::Compute(DData *pDData, CBlade *pWing, double lambda, double inflow
         m_Torque.append(pDData->torque);
         m_Thrust.append(pDData->thrust);
         m_Windspeed.append(inflowspeed);
+        m_Iterations.append(pDData->m_totalIterations);
+        m_ComputeTime.append(pDData->m_computeTime);
     }
 
 }
@@ -260,6 +298,15 @@ void DMSData::serialize() {
     g_serializer.readOrWriteFloatVector1D (&m_Ct2);
     g_serializer.readOrWriteFloatVector1D (&m_Lambda);
 
+    if (g_serializer.getArchiveFormat() >= 310012){
+        g_serializer.readOrWriteFloatVector1D (&m_Iterations);
+        g_serializer.readOrWriteFloatVector1D (&m_ComputeTime);
+    }
+    else{
+        m_Iterations.fill(0, m_Power.size());
+        m_ComputeTime.fill(0, m_Power.size());
+    }
+
 	// serialize the DData array m_DData
 	if (g_serializer.isReadMode()) {
 		int n = g_serializer.readInt();
@@ -388,28 +435,38 @@ NewCurve *DMSData::newCurve(QString xAxis, QString yAxis, NewGraph::GraphType gr
 void DMSData::startSimulation() {  // NM copied from QDMS::OnStartRotorSimulation
 	const int times = int((m_tipSpeedTo-m_tipSpeedFrom)/m_tipSpeedDelta);
 
-	QProgressDialog progress("", "Abort DMS", 0, times, g_mainFrame);
-    progress.setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
-	progress.setModal(true);
-
 	CBlade *blade = static_cast<CBlade*> (getParent());
 
-	for (int i = 0; i <= times; ++i) {
-		if (progress.wasCanceled())
-			break;
+    // the tip speed ratios are split into short sequences, every sequence is one task of the sweep
+
+    const int numTasks = times / SWEEP_SEQUENCELENGTH + 1;
+
+    QVector<DData *> results(times+1);
+    DData **resultData = results.data();
 
-		QString curlambda;
-		curlambda.sprintf("%.2f", m_tipSpeedFrom + i*m_tipSpeedDelta);
-		QString text = "Compute DMS for Lambda " + curlambda;
-		progress.setLabelText(text);
-		progress.setValue(i);
+    DMSSweep sweep(blade, [this](){ return CreateDDataObject(); });
+
+    sweep.runWithProgress("Rotor DMS", numTasks, times+1, [this, resultData, times](int task, DMSSweep::Worker &worker){
+        for (int i = task*SWEEP_SEQUENCELENGTH; i <= times && i < (task+1)*SWEEP_SEQUENCELENGTH; ++i){
+            if (worker.isCanceled()) return;
+            resultData[i] = worker.solve(m_tipSpeedFrom + i*m_tipSpeedDelta, 0, m_windspeed);
+        }
+    });
+
+    // the results are stored in order, a canceled sweep keeps the points that were finished
+
+	for (int i = 0; i <= times; ++i) {
+        DData *data = results.at(i);
+        if (!data) continue;
 
-		DData *data = new DData (m_objectName);
-		Compute(data, blade, m_tipSpeedFrom + i*m_tipSpeedDelta, m_windspeed);  // NM appends data to m_data
+		AppendResult(data, blade, m_tipSpeedFrom + i*m_tipSpeedDelta, m_windspeed);  // NM appends data to m_data
 
         if (!data->m_bBackflow) {
             data->pen()->setColor(g_colorManager.getColor(m_data.size()));
 		}
+        else {
+            delete data;
+        }
 	}
 }
 
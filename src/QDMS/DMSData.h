@@ -35,6 +35,8 @@ public:
 	//enum SimulationType {};  // NM fill this later, when more Modules are reimplemented
 
     virtual void Compute(DData *pDData, CBlade *pWing, double lambda, double inflowspeed);
+    void AppendResult(DData *pDData, CBlade *pWing, double lambda, double inflowspeed);
+    DData* CreateDDataObject();
     virtual void Clear();
 	virtual void serialize ();  // override from StorableObject
 	void restorePointers();  // override from StorableObject
@@ -72,6 +74,8 @@ public:
     QVector <float> m_Thrust;                //thrust
     QVector <float> m_Windspeed;             //wind speed
     QVector <float> m_Omega;                 //rotational speed
+    QVector <float> m_Iterations;            //DMS iterations summed over all streamtubes
+    QVector <float> m_ComputeTime;           //computation time of the operating point in ms
 
     QList <DData *> m_data;
 
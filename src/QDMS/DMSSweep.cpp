@@ -0,0 +1,91 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "DMSSweep.h"
+
+#include <QDebug>
+#include <QStatusBar>
+
+#include "DData.h"
+#include "../QBEM/Blade.h"
+#include "../Globals.h"
+#include "../MainFrame.h"
+
+DMSSweep::Worker::Worker(DMSSweep *sweep){
+    m_sweep = sweep;
+}
+
+DData *DMSSweep::Worker::solve(double lambda, double pitch, double windspeed){
+
+    DData *pDData = m_sweep->m_createDData();
+
+    pDData->windspeed = windspeed;
+
+    pDData->Init(m_sweep->m_blade, lambda, pitch);
+    pDData->OnDMS(m_sweep->m_blade, &m_interference);
+
+    m_sweep->m_iterations += pDData->m_totalIterations;
+    m_sweep->m_computeTime += qRound64(pDData->m_computeTime * 1000);
+    m_sweep->m_progress++;
+
+    return pDData;
+}
+
+DMSSweep::DMSSweep(CBlade *blade, std::function<DData *()> createDData){
+    m_blade = blade;
+    m_createDData = createDData;
+    m_iterations = 0;
+    m_computeTime = 0;
+}
+
+void DMSSweep::run(int numTasks, Task task){
+
+    #pragma omp parallel default (none) shared (numTasks, task)
+    {
+        Worker worker(this);
+
+        #pragma omp for schedule(dynamic)
+        for (int i=0;i<numTasks;i++){
+            if (!isCanceled()){
+                worker.resetWarmStart();
+                task(i, worker);
+            }
+        }
+    }
+}
+
+bool DMSSweep::runWithProgress(QString title, int numTasks, int numPoints, Task task){
+
+    m_iterations = 0;
+    m_computeTime = 0;
+
+    const bool finished = runInBackground(title, numPoints, [this, numTasks, task](){ run(numTasks, task); });
+
+    // the iterations and computation time of every point are also stored with the DMS results
+
+    if (isGUI) g_mainFrame->statusBar()->showMessage(getStatistics());
+    if (debugSimulation) qDebug().noquote() << getStatistics();
+
+    return finished;
+}
+
+QString DMSSweep::getStatistics(){
+
+    const int points = qMax(getProgress(), 1);
+
+    return QString("DMS Sweep: %1 points, %2 iterations per point, %3 ms per point").arg(getProgress()).arg(double(m_iterations) / points, 0, 'f', 1).arg(double(m_computeTime) / 1000.0 / points, 0, 'f', 2);
+}
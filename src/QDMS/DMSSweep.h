@@ -0,0 +1,71 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef DMSSWEEP_H
+#define DMSSWEEP_H
+
+#include <QVector>
+#include <QString>
+#include <functional>
+#include <atomic>
+
+#include "../ParallelSweep.h"
+
+class DData;
+class CBlade;
+
+// Parallel engine for the DMS parameter sweeps of the multi parameter, rotor and turbine simulations.
+// The tasks are distributed dynamically over the OpenMP threads, every thread owns a Worker that
+// passes the converged interference factors of one operating point as initial guess to the next
+// point of the same task. The warm start is reset at the beginning of each task, so the results do
+// not depend on the distribution of the tasks over the threads. The iterations and computation time
+// of every point are stored in the DData object and summed up for the whole sweep.
+
+class DMSSweep : public ParallelSweep
+{
+public:
+    class Worker
+    {
+    public:
+        Worker(DMSSweep *sweep);
+
+        DData *solve(double lambda, double pitch, double windspeed);   // the returned object is owned by the caller
+        void resetWarmStart(){ m_interference.clear(); }
+        bool isCanceled() const { return m_sweep->isCanceled(); }
+
+    private:
+        DMSSweep *m_sweep;
+        QVector<float> m_interference;
+    };
+
+    typedef std::function<void(int task, Worker &worker)> Task;
+
+    DMSSweep(CBlade *blade, std::function<DData *()> createDData);
+
+    void run(int numTasks, Task task);
+    bool runWithProgress(QString title, int numTasks, int numPoints, Task task);    // returns false if the sweep was canceled
+
+    QString getStatistics();    // iterations and computation time per point
+
+private:
+    CBlade *m_blade;
+    std::function<DData *()> m_createDData;
+    std::atomic<long long> m_iterations;
+    std::atomic<long long> m_computeTime;     // in microseconds
+};
+
+#endif // DMSSWEEP_H
@@ -15,9 +15,8 @@
 
 ***********************************************************************/
 
-#include <QProgressDialog>
-
 #include "TDMSData.h"
+#include "DMSSweep.h"
 #include "../Globals.h"
 #include "../Store.h"
 #include "../Serializer.h"
@@ -132,6 +131,8 @@ void TDMSData::Clear()
     m_Cm1.clear();
     m_Cm2.clear();
     m_Lambda.clear();
+    m_Iterations.clear();
+    m_ComputeTime.clear();
 
 }
 
@@ -176,15 +177,10 @@ void TDMSData::startSimulation() {  // NM copied from void QDMS::OnStartTurbineS
 	
 	TData *turbine = dynamic_cast<TData*> (this->getParent());
 	CBlade *blade = dynamic_cast<CBlade*> (turbine->getParent());
-	
-	QProgressDialog progress("", "Abort DMS", 0, times, g_mainFrame);
-    progress.setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
-	progress.setModal(true);
+
+    QVector<double> sweepRot(times+1);
 	
 	for (int i = 0; i <= times; ++i) {
-		if (progress.wasCanceled())
-			break;
-		
 		windspeed = m_windspeedFrom + m_windspeedDelta * i;
 		
 		//// check which rotational speed is used (for fixed, 2step and variable)////
@@ -232,66 +228,85 @@ void TDMSData::startSimulation() {  // NM copied from void QDMS::OnStartTurbineS
 			}
 		}
 		
-		QString curwind;
-		curwind.sprintf("%.2f",windspeed);
-		progress.setLabelText("Compute DMS for Windspeed " + curwind);
-		progress.setValue(i);
-		
+		sweepRot[i] = rot;
+	}
+
+	Toff = turbine->Offset;
+
+    // the windspeeds are independent and solved in parallel, in sequences of neighbouring windspeeds that
+    // share the interference factors as initial guess
+
+    const int numTasks = times / SWEEP_SEQUENCELENGTH + 1;
+
+    QVector<DData *> results(times+1);
+    DData **resultData = results.data();
+
+    DMSSweep sweep(blade, [this, Toff](){ DData *pDData = CreateDDataObject(); pDData->Toff = Toff; return pDData; });
+
+    sweep.runWithProgress("Turbine DMS", numTasks, times+1, [this, turbine, resultData, times, &sweepRot](int task, DMSSweep::Worker &worker){
+        for (int i = task*SWEEP_SEQUENCELENGTH; i <= times && i < (task+1)*SWEEP_SEQUENCELENGTH; ++i){
+            if (worker.isCanceled()) return;
+            double wind = m_windspeedFrom + m_windspeedDelta * i;
+            if (wind >= turbine->CutIn && wind <= turbine->CutOut)
+                resultData[i] = worker.solve((sweepRot.at(i)*turbine->MaxRadius/60*2*PI_)/wind, 0, wind);
+        }
+    });
+
+	for (int i = 0; i <= times; ++i) {
+		data = results.at(i);
+		if (!data) continue;
+
+		windspeed = m_windspeedFrom + m_windspeedDelta * i;
+		rot = sweepRot.at(i);
 		lambda = (rot*turbine->MaxRadius/60*2*PI_)/windspeed;
 		//lambda = turbine->OuterRadius*2*PI_/60/windspeed*rot;
-		
-		Toff = turbine->Offset;
-		
-		if (windspeed >= turbine->CutIn && windspeed <= turbine->CutOut)
+
+		if (!data->m_bBackflow)
 		{
-			data = new DData (m_objectName);
-			Compute(data,blade,lambda,0,Toff,windspeed);
+			// fill turbine data
+			m_Omega.append(rot);
+            m_Windspeed.append(windspeed);
+			m_data.append(data);
+			
+			double P = data->power;
+            m_Power.append(P);
 			
-			if (!data->m_bBackflow)
+			double Thrust = data->thrust;
+			m_Thrust.append(Thrust);
+			
+			double T = data->torque;
+            m_Torque.append(T);
+			
+			double P_loss = (1-turbine->VariableLosses) * P - turbine->m_fixedLosses;
+			if (P_loss > 0)
 			{
-				// fill turbine data
-				m_Omega.append(rot);
-                m_Windspeed.append(windspeed);
-				m_data.append(data);
-				
-				double P = data->power;
-                m_Power.append(P);
-				
-				double Thrust = data->thrust;
-				m_Thrust.append(Thrust);
-				
-				double T = data->torque;
-                m_Torque.append(T);
-				
-				double P_loss = (1-turbine->VariableLosses) * P - turbine->m_fixedLosses;
-				if (P_loss > 0)
-				{
-					m_P_loss.append(P_loss);
-					m_Cp_loss.append(P_loss/P);
-				}
-				else
-				{
-					m_P_loss.append(0);
-					m_Cp_loss.append(0);
-				}
-				
-//				m_S.append(pow(turbine->OuterRadius,2)*PI_*rho/2*pow(windspeed,2)*data->cm);
-				
-				m_Cp.append(data->cp);
-				m_Cp1.append(data->cp1);
-				m_Cp2.append(data->cp2);
-				m_Cm.append(data->cm);
-				m_Cm1.append(data->cm1);
-				m_Cm2.append(data->cm2);
-				m_Lambda.append(lambda);
-
-                data->pen()->setColor(g_colorManager.getColor((m_data.size()-1)%24));  // old DMS
-				data->pen()->setColor(g_colorManager.getColor(m_data.size()-1));
+				m_P_loss.append(P_loss);
+				m_Cp_loss.append(P_loss/P);
+			}
+			else
+			{
+				m_P_loss.append(0);
+				m_Cp_loss.append(0);
 			}
 			
+//				m_S.append(pow(turbine->OuterRadius,2)*PI_*rho/2*pow(windspeed,2)*data->cm);
+			
+			m_Cp.append(data->cp);
+			m_Cp1.append(data->cp1);
+			m_Cp2.append(data->cp2);
+			m_Cm.append(data->cm);
+			m_Cm1.append(data->cm1);
+			m_Cm2.append(data->cm2);
+			m_Lambda.append(lambda);
+			m_Iterations.append(data->m_totalIterations);
+			m_ComputeTime.append(data->m_computeTime);
+
+            data->pen()->setColor(g_colorManager.getColor((m_data.size()-1)%24));  // old DMS
+			data->pen()->setColor(g_colorManager.getColor(m_data.size()-1));
 		}
+		else
+			delete data;
 	}
-	
 }
 
 QStringList TDMSData::getAvailableVariables(NewGraph::GraphType graphType, bool xAxis) {
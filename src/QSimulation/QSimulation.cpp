@@ -20,6 +20,7 @@
 #include <GL/gl.h>
 #include <qopenglext.h>
 #include <QSysInfo>
+#include <QDir>
 
 #include "src/Serializer.h"
 #include "src/Windfield/WindField.h"
@@ -31,6 +32,8 @@
 #include "src/OpenCLSetup.h"
 #include "src/StructModel/StrModel.h"
 #include "src/QSimulation/QVelocityCutPlane.h"
+#include "src/Waves/WaveKinematicsGrid.h"
+#include "src/QSimulation/ResultStreamWriter.h"
 #include "src/GLWidget.h"
 #include "src/GlobalFunctions.h"
 #include "src/IceThrowSimulation/IceThrowSimulation.h"
@@ -223,6 +226,13 @@ QSimulation::QSimulation(QString name, StorableObject *parent)
     m_Windfield = NULL;
     m_linearWave = NULL;
     m_VPMLGrid = NULL;
+    m_bisTreecode = false;
+    m_bTreecodeInduction = false;
+    m_bTreecodeCheck = false;
+    m_treecodeTheta = 0.5;
+    m_treecodeOrder = 2;
+    m_treecodeMaxError = 0;
+    m_treecodeRmsError = 0;
     m_bisPrecomp = false;
     m_bIsRunning = false;
     m_bContinue = false;
@@ -236,6 +246,18 @@ QSimulation::QSimulation(QString name, StorableObject *parent)
     m_currentTimeStep = 0;
     m_currentTime = 0;
     m_waveStretchingType = 0;
+    m_bUseWaveGrid = false;
+    m_waveGridSpacing = 4;
+    m_waveGridVerticalSpacing = 2;
+    m_waveGridTimestep = 0.1;
+    m_waveGridInterpolation = WAVEGRID_CUBIC;
+    m_waveGridErrorBound = 0.02;
+    m_waveGrid = NULL;
+    m_bWaveGridFailed = false;
+    m_resultStream = NULL;
+    m_streamWindow = 0;
+    m_aeroCouplingType = AEROCOUPLING_HOLD;
+    m_aeroCouplingLimit = 0.5;
 }
 
 bool QSimulation::hasData(){
@@ -369,6 +391,10 @@ void QSimulation::resetSimulation(){
     if (m_linearWave && m_bIsOffshore)
         m_linearWave->CalculateDispersion(m_gravity,m_waterDepth);
 
+    clearWaveGrid();
+
+    closeResultStream();
+
     updateTurbineTime();
 
     VPML_createGrid();
@@ -389,6 +415,9 @@ void QSimulation::initializeOutputVectors(){
     m_t_structural = 0;
     m_t_iteration = 0;
 
+    m_treecodeMaxError = 0;
+    m_treecodeRmsError = 0;
+
     m_QSimulationData.clear();
     m_availableQSimulationVariables.clear();
 
@@ -428,7 +457,57 @@ void QSimulation::initializeOutputVectors(){
     m_QSimulationData.append(dummy);
     m_availableQSimulationVariables.append("CPU Overhead Time per Timestep [s]");
     m_QSimulationData.append(dummy);
+    m_availableQSimulationVariables.append("Structural Factorizations [-]");
+    m_QSimulationData.append(dummy);
+    m_availableQSimulationVariables.append("Structural Factorizations per Sim. Second [1/s]");
+    m_QSimulationData.append(dummy);
+
+}
+
+void QSimulation::initializeTreecodeOutputVectors(){
+
+    if (!m_bisTreecode || !m_bTreecodeCheck) return;
+
+    if (m_availableQSimulationVariables.contains("Treecode Max. Rel. Error [-]")) return;
+
+    // when a simulation is continued the channels are padded to the length of the stored data
+
+    QVector<float> dummy;
+    if (m_QSimulationData.size()) dummy.fill(0,m_QSimulationData.at(0).size());
+
+    m_availableQSimulationVariables.append("Treecode Max. Rel. Error [-]");
+    m_QSimulationData.append(dummy);
+    m_availableQSimulationVariables.append("Treecode RMS Rel. Error [-]");
+    m_QSimulationData.append(dummy);
+}
+
+void QSimulation::trimOutputVectors(int numSteps){
+
+    for (int i=0;i<m_QSimulationData.size();i++)
+        m_QSimulationData[i].remove(0, std::min(numSteps, m_QSimulationData[i].size()));
+
+    m_QTurbine->trimOutputVectors(numSteps);
+
+    // without a replay the saved geometry only holds the current timestep
+    if (m_bStoreReplay) m_QTurbine->trimReplayData(numSteps);
+}
+
+void QSimulation::openResultStream(){
+
+    if (!m_streamFileName.size() || m_resultStream || !m_QTurbine) return;
+
+    m_resultStream = new ResultStreamWriter(this, m_QTurbine, m_streamFileName, m_streamWindow);
 
+    if (!m_resultStream->open()){
+        delete m_resultStream;
+        m_resultStream = NULL;
+    }
+}
+
+void QSimulation::closeResultStream(){
+
+    if (m_resultStream) delete m_resultStream;
+    m_resultStream = NULL;
 }
 
 void QSimulation::calcResults(){
@@ -492,6 +571,18 @@ void QSimulation::calcResults(){
     else if (m_QSimulationData[pos].size() == 1) m_QSimulationData[k++].append(m_QSimulationData[pos].at(m_QSimulationData[pos].size()-1)/m_currentTimeStep);
     else m_QSimulationData[k++].append(m_QSimulationData[pos].at(m_QSimulationData[pos].size()-1) - m_QSimulationData[pos].at(m_QSimulationData[pos].size()-2));
 
+    double factorizations = 0;
+    if (m_QTurbine->m_StrModel) factorizations = m_QTurbine->m_StrModel->GetNumFactorizations();
+    pos = k;
+    m_QSimulationData[k++].append(factorizations);
+    if (m_QSimulationData[pos].size() == 1) m_QSimulationData[k++].append(factorizations / std::max(m_currentTime, m_timestepSize));
+    else m_QSimulationData[k++].append((m_QSimulationData[pos].at(m_QSimulationData[pos].size()-1) - m_QSimulationData[pos].at(m_QSimulationData[pos].size()-2)) / m_timestepSize);
+
+    // the treecode error channels are only appended at the end when the treecode check is active, see initializeTreecodeOutputVectors()
+    if (k+1 < m_QSimulationData.size()){
+        m_QSimulationData[k++].append(m_treecodeMaxError);
+        m_QSimulationData[k++].append(m_treecodeRmsError);
+    }
 
 }
 
@@ -634,6 +725,8 @@ void QSimulation::storeSimulationData(){
      m_QTurbine->calcResults();
      calcResults();
 
+     if (m_resultStream) m_resultStream->append();
+
 }
 
 void QSimulation::setBoundaryConditions(double time){
@@ -699,7 +792,8 @@ void QSimulation::onStartAnalysis(){
     if (debugSimulation) qDebug() << "QSimulation: Start Analysis: "<<getName();
 
     initMultiThreading();
-    connectGUISignals();
+    initializeTreecodeOutputVectors();
+    if (isGUI) connectGUISignals();
     lockStores();
 
     m_bStopRequested = false;
@@ -709,6 +803,8 @@ void QSimulation::onStartAnalysis(){
 
     initializeStructuralModels();
 
+    openResultStream();
+
     timer.start();
 
     if (m_bUseIce && !m_bContinue){
@@ -741,7 +837,8 @@ void QSimulation::onStartAnalysis(){
 
             if (m_bUseIce) m_IceThrow->AdvanceParticleSimulation(m_currentTime);
 
-            updateGUI();
+            if (isGUI) updateGUI();
+            else printProgress();
             m_t_overhead += timer.nsecsElapsed();timer.start();
 
             if (m_bAbort){ qDebug() << "SIMULATION ABORTED DUE TO NAN VALUES IN RESULTS"; break; } // this catches NaN values in the results
@@ -753,18 +850,21 @@ void QSimulation::onStartAnalysis(){
 
     }
 
+    if (m_resultStream) m_resultStream->append();
+
     if (m_currentTimeStep >= m_numberTimesteps){
         m_bFinished = true;
         m_bContinue = false;
         m_currentTimeStep = m_numberTimesteps;
         unloadAllControllers();
+        closeResultStream();
     }
 
     m_shownTimeIndex = GetTimeArray()->size()-1;
 
     m_bIsRunning = false;
 
-    disconnectGUISignals();
+    if (isGUI) disconnectGUISignals();
     unlockStores();
 
     if (debugSimulation) qDebug() << "QSimulation: Finished Analysis: "<<getName();
@@ -984,6 +1084,15 @@ void QSimulation::gammaBoundFixedPointIteration(){
         m_QTurbine->gammaBoundFixedPointIteration();
 }
 
+void QSimulation::printProgress(){
+
+    // headless replacement of updateGUI(), the progress is written to the console in 10% steps
+
+    const int step = qMax(m_numberTimesteps/10,1);
+    if (m_currentTimeStep % step == 0 || m_currentTimeStep == m_numberTimesteps)
+        qDebug().noquote() << "..." + getName() + ": timestep" << m_currentTimeStep << "of" << m_numberTimesteps;
+}
+
 void QSimulation::updateGUI(){
 
     if (debugSimulation) qDebug() << "QSimulation: Start Update GUI";
@@ -1384,6 +1493,36 @@ void QSimulation::serialize() {
     g_serializer.readOrWriteInt(&m_currentTimeStep);
     g_serializer.readOrWriteInt(&m_waveStretchingType);
 
+    if (g_serializer.getArchiveFormat() >= 310006){
+        g_serializer.readOrWriteBool(&m_bUseWaveGrid);
+        g_serializer.readOrWriteDouble(&m_waveGridSpacing);
+        g_serializer.readOrWriteDouble(&m_waveGridVerticalSpacing);
+        g_serializer.readOrWriteDouble(&m_waveGridTimestep);
+        g_serializer.readOrWriteInt(&m_waveGridInterpolation);
+        g_serializer.readOrWriteDouble(&m_waveGridErrorBound);
+    }
+
+    if (g_serializer.getArchiveFormat() >= 310007){
+        g_serializer.readOrWriteStringList(&m_bladeOutputChannels);
+    }
+
+    if (g_serializer.getArchiveFormat() >= 310008){
+        g_serializer.readOrWriteString(&m_streamFileName);
+        g_serializer.readOrWriteInt(&m_streamWindow);
+    }
+
+    if (g_serializer.getArchiveFormat() >= 310010){
+        g_serializer.readOrWriteInt(&m_aeroCouplingType);
+        g_serializer.readOrWriteDouble(&m_aeroCouplingLimit);
+    }
+
+    if (g_serializer.getArchiveFormat() >= 310011){
+        g_serializer.readOrWriteBool(&m_bTreecodeInduction);
+        g_serializer.readOrWriteDouble(&m_treecodeTheta);
+        g_serializer.readOrWriteInt(&m_treecodeOrder);
+        g_serializer.readOrWriteBool(&m_bTreecodeCheck);
+    }
+
     g_serializer.readOrWriteString(&m_hubHeightFileName);
     g_serializer.readOrWriteStringList(&m_hubHeightFileStream);
 
@@ -1444,6 +1583,88 @@ QStringList QSimulation::prepareMissingObjectMessage() {
     return QStringList();
 }
 
+void QSimulation::getWaveKinematics(LinearWave::KinematicsBatch &batch, double time, bool buildGrid){
+
+    // evaluates the wave kinematics from the precomputed grid, if it is enabled, or from the wave trains;
+    // the grid is built around the positions of the first batch for which buildGrid is set
+
+    if (!m_linearWave) return;
+
+    if (m_bUseWaveGrid && buildGrid && !m_waveGrid && !m_bWaveGridFailed)
+        m_bWaveGridFailed = !buildWaveGrid(batch);
+
+    if (m_waveGrid)
+        m_waveGrid->Evaluate(batch,time);
+    else
+        m_linearWave->GetKinematicsBatch(batch,time,m_waterDepth,m_waveStretchingType);
+}
+
+bool QSimulation::buildWaveGrid(LinearWave::KinematicsBatch &batch){
+
+    if (!m_linearWave || !batch.size()) return false;
+
+    clearWaveGrid();
+
+    WaveKinematicsGrid::GridDefinition def;
+
+    def.xMin = def.xMax = batch.x.at(0);
+    def.yMin = def.yMax = batch.y.at(0);
+    def.zMin = def.zMax = batch.z.at(0);
+
+    for (int i=1;i<batch.size();i++){
+        def.xMin = std::min(def.xMin, batch.x.at(i));
+        def.xMax = std::max(def.xMax, batch.x.at(i));
+        def.yMin = std::min(def.yMin, batch.y.at(i));
+        def.yMax = std::max(def.yMax, batch.y.at(i));
+        def.zMin = std::min(def.zMin, batch.z.at(i));
+        def.zMax = std::max(def.zMax, batch.z.at(i));
+    }
+
+    // margin for the motion of the substructure, positions that leave the grid are evaluated from the wave trains
+
+    float margin = 2.0 * m_waveGridSpacing + 0.1 * std::max(def.xMax - def.xMin, def.yMax - def.yMin);
+    def.xMin -= margin;
+    def.xMax += margin;
+    def.yMin -= margin;
+    def.yMax += margin;
+    def.zMin -= 2.0 * m_waveGridVerticalSpacing;
+    def.zMax += 2.0 * m_waveGridVerticalSpacing;
+
+    def.tMin = 0;
+    def.tMax = m_numberTimesteps * m_timestepSize + m_waveGridTimestep;
+    def.dxy = m_waveGridSpacing;
+    def.dz = m_waveGridVerticalSpacing;
+    def.dt = m_waveGridTimestep;
+    def.depth = m_waterDepth;
+    def.stretchingType = m_waveStretchingType;
+    def.interpolation = m_waveGridInterpolation;
+
+    m_waveGrid = new WaveKinematicsGrid();
+
+    if (!m_waveGrid->Build(m_linearWave, def, WaveKinematicsGrid::GetCacheDirectory())){
+        qDebug().noquote() << "...the wave kinematics grid could not be built, the kinematics are evaluated from the wave trains";
+        clearWaveGrid();
+        return false;
+    }
+
+    double error = m_waveGrid->CheckAccuracy();
+
+    if (error > m_waveGridErrorBound){
+        qDebug().noquote() << "...the wave kinematics grid error" << QString().number(error,'f',4) << "exceeds the bound of" << QString().number(m_waveGridErrorBound,'f',4) << ", the kinematics are evaluated from the wave trains; reduce the grid spacing or timestep";
+        clearWaveGrid();
+        return false;
+    }
+
+    return true;
+}
+
+void QSimulation::clearWaveGrid(){
+
+    if (m_waveGrid) delete m_waveGrid;
+    m_waveGrid = NULL;
+    m_bWaveGridFailed = false;
+}
+
 Vec3 QSimulation::getOceanCurrentAt(Vec3 position, double elevation){
 
     if (!m_bIsOffshore) return Vec3(0,0,0);
@@ -1766,6 +1987,7 @@ void QSimulation::glCallWindWavesList(){
 
 void QSimulation::initMultiThreading(int i){
     if (isGUI){
+        m_bisTreecode = false;
         if (g_QSimulationModule->GetDeviceType() == 0){
             m_bisOpenMp = false;
             m_bisOpenCl = false;
@@ -1774,7 +1996,16 @@ void QSimulation::initMultiThreading(int i){
             m_bisOpenMp = true;
             m_bisOpenCl = false;
         }
+        else if (g_QSimulationModule->GetDeviceType() == 2){
+            m_bisOpenMp = true;
+            m_bisOpenCl = false;
+            m_bisTreecode = true;
+            m_treecodeTheta = g_QSimulationModule->GetTreecodeTheta();
+            m_treecodeOrder = g_QSimulationModule->GetTreecodeOrder();
+            m_bTreecodeCheck = g_QSimulationModule->GetTreecodeCheck();
+        }
         else m_bisOpenCl = true;
+        m_bTreecodeInduction = m_bisTreecode;
     }
     else{
         if (i == 1 && g_OpenCl->DeviceIDs.size() >= 1){
@@ -1789,6 +2020,7 @@ void QSimulation::initMultiThreading(int i){
             m_bisOpenCl = false;
             m_bisOpenMp = true;
         }
+        m_bisTreecode = m_bTreecodeInduction && !m_bisOpenCl;
     }
 }
 
@@ -1883,23 +2115,30 @@ void QSimulation::onComputeCutPlane(QVelocityCutPlane *plane, int timestep, int
         double renderTime;
         if (m_bStoreReplay) renderTime = GetTimeArray()->at(timestep);
         else renderTime = GetTimeArray()->at(GetTimeArray()->size()-1);
-        #pragma omp parallel default (none) shared (plane, renderTime)
-        {
-        #pragma omp for
-            for (int i=0;i<plane->m_points.size();i++){
-                for (int j=0;j<plane->m_points.at(i).size();j++){
-
-                    Vec3 vel(0,0,0);
-                    Vec3 position(plane->m_points[i][j].x,plane->m_points[i][j].y,plane->m_points[i][j].z);
-                    double elevation = 0;
-                    if (m_linearWave)
-                        elevation = m_linearWave->GetElevation(position,renderTime);
-                    if (plane->m_points[i][j].z < elevation){
-                        if (m_linearWave)
-                            m_linearWave->GetVelocityAndAcceleration(position,renderTime,elevation,m_waterDepth,m_waveStretchingType,&vel);
-                        vel += getOceanCurrentAt(position,elevation);
-                        plane->m_velocities[i][j] = vel;
-                    }
+
+        LinearWave::KinematicsBatch batch;
+        for (int i=0;i<plane->m_points.size();i++){
+            for (int j=0;j<plane->m_points.at(i).size();j++){
+                batch.x.append(plane->m_points[i][j].x);
+                batch.y.append(plane->m_points[i][j].y);
+                batch.z.append(plane->m_points[i][j].z);
+                batch.evalElevation.append(1);
+            }
+        }
+        batch.Resize(batch.size());
+
+        getWaveKinematics(batch,renderTime);
+
+        int p = 0;
+        for (int i=0;i<plane->m_points.size();i++){
+            for (int j=0;j<plane->m_points.at(i).size();j++,p++){
+
+                Vec3 position(plane->m_points[i][j].x,plane->m_points[i][j].y,plane->m_points[i][j].z);
+                double elevation = batch.elevation.at(p);
+                if (plane->m_points[i][j].z < elevation){
+                    Vec3 vel(batch.velX.at(p),batch.velY.at(p),batch.velZ.at(p));
+                    vel += getOceanCurrentAt(position,elevation);
+                    plane->m_velocities[i][j] = vel;
                 }
             }
         }
@@ -1961,23 +2200,33 @@ void QSimulation::onComputeVelVolume(Vec3*** positions, Vec3*** velocities, int
         if (m_bStoreReplay) renderTime = GetTimeArray()->at(timestep);
         else renderTime = GetTimeArray()->at(GetTimeArray()->size()-1);
         int XDELTA = XEND-XSTART;
-        #pragma omp parallel default (none) shared (velocities, positions, renderTime, XSTART, XDELTA, YR, ZR)
-        {
-        #pragma omp for
-            for (int i=0;i<XDELTA;i++){
-                for (int j=0;j<YR;j++){
-                    for (int k=0;k<ZR;k++){
-
-                        Vec3 vel(0,0,0);
-                        double elevation = 0;
-                        if (m_linearWave)
-                            elevation = m_linearWave->GetElevation(positions[i+XSTART][j][k],renderTime);
-                        if (positions[i+XSTART][j][k].z < elevation){
-                            if (m_linearWave)
-                                m_linearWave->GetVelocityAndAcceleration(positions[i+XSTART][j][k],renderTime,elevation,m_waterDepth,m_waveStretchingType,&vel);
-                            vel += getOceanCurrentAt(positions[i+XSTART][j][k],elevation);
-                            velocities[i+XSTART][j][k] = vel;
-                        }
+
+        LinearWave::KinematicsBatch batch;
+        batch.Resize(XDELTA*YR*ZR);
+        for (int i=0;i<XDELTA;i++){
+            for (int j=0;j<YR;j++){
+                for (int k=0;k<ZR;k++){
+                    int p = (i*YR+j)*ZR+k;
+                    batch.x[p] = positions[i+XSTART][j][k].x;
+                    batch.y[p] = positions[i+XSTART][j][k].y;
+                    batch.z[p] = positions[i+XSTART][j][k].z;
+                    batch.evalElevation[p] = 1;
+                }
+            }
+        }
+
+        getWaveKinematics(batch,renderTime);
+
+        for (int i=0;i<XDELTA;i++){
+            for (int j=0;j<YR;j++){
+                for (int k=0;k<ZR;k++){
+
+                    int p = (i*YR+j)*ZR+k;
+                    double elevation = batch.elevation.at(p);
+                    if (positions[i+XSTART][j][k].z < elevation){
+                        Vec3 vel(batch.velX.at(p),batch.velY.at(p),batch.velZ.at(p));
+                        vel += getOceanCurrentAt(positions[i+XSTART][j][k],elevation);
+                        velocities[i+XSTART][j][k] = vel;
                     }
                 }
             }
@@ -2387,4 +2636,6 @@ void QSimulation::WriteTowerGeomToFile(QString fileName, int timestep, bool debu
 QSimulation::~QSimulation ()
 {
     if (m_VPMLGrid) delete m_VPMLGrid;
+    clearWaveGrid();
+    closeResultStream();
 }
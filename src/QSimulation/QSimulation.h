@@ -30,6 +30,10 @@
 
 class QSimulationModule;
 class IceThrowSimulation;
+class WaveKinematicsGrid;
+class ResultStreamWriter;
+
+enum AeroCouplingType {AEROCOUPLING_HOLD, AEROCOUPLING_EXTRAPOLATE};
 
 class QSimulation : public StorableObject, public ShowAsGraphInterface
 {
@@ -156,6 +160,8 @@ public:
     double m_kinematicViscosity;
     double m_kinematicViscosityWater;
     double m_wakeInteractionTime;
+    int m_aeroCouplingType;              // aero loads over the structural substeps: held constant or extrapolated from the last aero steps
+    double m_aeroCouplingLimit;          // max. extrapolated load increment (over all substeps since the last aero step), relative to the last aero load
     bool m_bModalAnalysis;
     bool m_bMirrorWindfield;
     bool m_bisWindAutoShift;
@@ -174,6 +180,12 @@ public:
     LinearWave *m_linearWave;
     WindField *m_Windfield;
     int m_waveStretchingType;
+    bool m_bUseWaveGrid;
+    double m_waveGridSpacing;
+    double m_waveGridVerticalSpacing;
+    double m_waveGridTimestep;
+    int m_waveGridInterpolation;
+    double m_waveGridErrorBound;
     QString m_hubHeightFileName;
     QStringList m_hubHeightFileStream;
     QList< QList <double> > m_hubHeightStreamData;
@@ -207,6 +219,11 @@ public:
 
     IceThrowSimulation *m_IceThrow;
 
+    WaveKinematicsGrid *m_waveGrid;
+    bool m_bWaveGridFailed;
+
+    ResultStreamWriter *m_resultStream;
+
     // QSimulation State Variables
     int m_currentTimeStep;
     double m_currentTime;
@@ -237,6 +254,13 @@ public:
 
     bool m_bisOpenMp;
     bool m_bisOpenCl;
+    bool m_bisTreecode;                  // treecode induction is used in the current run
+    bool m_bTreecodeInduction;           // treecode induction is requested for batch and command line runs
+    bool m_bTreecodeCheck;
+    double m_treecodeTheta;
+    int m_treecodeOrder;
+    double m_treecodeMaxError;
+    double m_treecodeRmsError;
     bool m_bForceRerender;
     bool m_bGlChanged;
     bool m_bRenderOceanSurface;
@@ -248,10 +272,17 @@ public:
     bool m_bStoreStructuralData;
     bool m_bStoreControllerData;
     bool m_bStoreHydroData;
+    QStringList m_bladeOutputChannels;   // blade output variables that are stored (without the blade number and unit), empty = all
+    QString m_streamFileName;            // the results are streamed to HAWC2 binary files with this name during the run, empty = off
+    int m_streamWindow;                  // timesteps that are kept in memory while streaming, 0 = all
 
     Vec3 getOceanCurrentAt(Vec3 position, double elevation);
+    void getWaveKinematics(LinearWave::KinematicsBatch &batch, double time, bool buildGrid = false);
+    bool buildWaveGrid(LinearWave::KinematicsBatch &batch);
+    void clearWaveGrid();
     bool initializeControllerInstances();
     void onStartAnalysis();
+    void initializeTreecodeOutputVectors();
     void setBoundaryConditions(double time);
     void setHubHeightWind(double time);
     void initMultiThreading(int i = 0);
@@ -270,6 +301,7 @@ public:
     void updateRotorGeometry();
     void storeSimulationData();
     void updateGUI();
+    void printProgress();
     void drawOverpaint(QPainter &painter);
     void drawText(QPainter &painter);
     void gammaBoundFixedPointIteration();
@@ -288,6 +320,9 @@ public:
 
     void initializeOutputVectors();
     void calcResults();
+    void trimOutputVectors(int numSteps);
+    void openResultStream();
+    void closeResultStream();
 
     QVector<float>* GetTimeArray();
     QVector<float>* GetTimestepArray();
@@ -51,6 +51,7 @@
 #include "src/Waves/WaveCreatorDialog.h"
 #include "src/Waves/WaveModule.h"
 #include "src/Waves/WaveToolBar.h"
+#include "src/Waves/WaveKinematicsGrid.h"
 
 QSimulationCreatorDialog::QSimulationCreatorDialog(QSimulation *editedSimulation, QSimulationModule *module)
 {
@@ -739,6 +740,30 @@ QSimulationCreatorDialog::QSimulationCreatorDialog(QSimulation *editedSimulation
     includeHydroGroup->addButton(radioButton, 1);
     miniHBox->addWidget(radioButton);
 
+    label = new QLabel (tr("Aero Loads over Substeps: "));
+    grid->addWidget(label, gridRowCount, 0);
+    aeroCouplingBox = new QComboBox();
+    aeroCouplingBox->addItem("HELD CONSTANT");
+    aeroCouplingBox->addItem("EXTRAPOLATED");
+    aeroCouplingBox->setMinimumWidth(MinEditWidth);
+    aeroCouplingBox->setMaximumWidth(MaxEditWidth);
+    miniHBox = new QHBoxLayout ();
+    miniHBox->addStretch();
+    miniHBox->addWidget(aeroCouplingBox);
+    grid->addLayout(miniHBox, gridRowCount++, 1);
+
+    label = new QLabel (tr("Max. Extrapolated Load Increment [-]: "));
+    grid->addWidget(label, gridRowCount, 0);
+    aeroCouplingLimit = new NumberEdit ();
+    aeroCouplingLimit->setMinimumWidth(MinEditWidth);
+    aeroCouplingLimit->setMaximumWidth(MaxEditWidth);
+    aeroCouplingLimit->setAutomaticPrecision(3);
+    aeroCouplingLimit->setMinimum(0);
+    miniHBox = new QHBoxLayout ();
+    miniHBox->addStretch();
+    miniHBox->addWidget(aeroCouplingLimit);
+    grid->addLayout(miniHBox, gridRowCount++, 1);
+
     groupBox = new QGroupBox (tr("Turbine Behavior"));
     vBox->addWidget(groupBox);
     grid = new QGridLayout ();
@@ -1236,6 +1261,86 @@ QSimulationCreatorDialog::QSimulationCreatorDialog(QSimulation *editedSimulation
     miniHBox->addWidget(seabedShear);
     grid->addLayout(miniHBox, gridRowCount++, 1);
 
+    groupBox = new QGroupBox ("Wave Kinematics Grid");
+    vBox->addWidget(groupBox);
+    grid = new QGridLayout ();
+    groupBox->setLayout(grid);
+    gridRowCount = 0;
+
+    label = new QLabel (tr("Precompute Wave Kinematics: "));
+    grid->addWidget (label, gridRowCount, 0);
+    miniHBox = new QHBoxLayout ();
+    grid->addLayout(miniHBox, gridRowCount++, 1);
+    miniHBox->addStretch();
+    waveGridGroup = new QButtonGroup(miniHBox);
+    radioButton = new QRadioButton ("On");
+    waveGridGroup->addButton(radioButton, 0);
+    miniHBox->addWidget(radioButton);
+    radioButton = new QRadioButton ("Off");
+    waveGridGroup->addButton(radioButton, 1);
+    miniHBox->addWidget(radioButton);
+
+    label = new QLabel (tr("Grid Interpolation: "));
+    grid->addWidget (label, gridRowCount, 0);
+    miniHBox = new QHBoxLayout ();
+    grid->addLayout(miniHBox, gridRowCount++, 1);
+    miniHBox->addStretch();
+    waveGridInterpolationGroup = new QButtonGroup(miniHBox);
+    radioButton = new QRadioButton ("Linear");
+    waveGridInterpolationGroup->addButton(radioButton, WAVEGRID_LINEAR);
+    miniHBox->addWidget(radioButton);
+    radioButton = new QRadioButton ("Cubic");
+    waveGridInterpolationGroup->addButton(radioButton, WAVEGRID_CUBIC);
+    miniHBox->addWidget(radioButton);
+
+    label = new QLabel (tr("Horizontal Grid Spacing [m]: "));
+    grid->addWidget(label, gridRowCount, 0);
+    waveGridSpacing = new NumberEdit ();
+    waveGridSpacing->setMinimumWidth(MinEditWidth);
+    waveGridSpacing->setMaximumWidth(MaxEditWidth);
+    waveGridSpacing->setAutomaticPrecision(3);
+    waveGridSpacing->setMinimum(0.1);
+    miniHBox = new QHBoxLayout ();
+    miniHBox->addStretch();
+    miniHBox->addWidget(waveGridSpacing);
+    grid->addLayout(miniHBox, gridRowCount++, 1);
+
+    label = new QLabel (tr("Vertical Grid Spacing [m]: "));
+    grid->addWidget(label, gridRowCount, 0);
+    waveGridVerticalSpacing = new NumberEdit ();
+    waveGridVerticalSpacing->setMinimumWidth(MinEditWidth);
+    waveGridVerticalSpacing->setMaximumWidth(MaxEditWidth);
+    waveGridVerticalSpacing->setAutomaticPrecision(3);
+    waveGridVerticalSpacing->setMinimum(0.1);
+    miniHBox = new QHBoxLayout ();
+    miniHBox->addStretch();
+    miniHBox->addWidget(waveGridVerticalSpacing);
+    grid->addLayout(miniHBox, gridRowCount++, 1);
+
+    label = new QLabel (tr("Grid Timestep [s]: "));
+    grid->addWidget(label, gridRowCount, 0);
+    waveGridTimestep = new NumberEdit ();
+    waveGridTimestep->setMinimumWidth(MinEditWidth);
+    waveGridTimestep->setMaximumWidth(MaxEditWidth);
+    waveGridTimestep->setAutomaticPrecision(4);
+    waveGridTimestep->setMinimum(0.001);
+    miniHBox = new QHBoxLayout ();
+    miniHBox->addStretch();
+    miniHBox->addWidget(waveGridTimestep);
+    grid->addLayout(miniHBox, gridRowCount++, 1);
+
+    label = new QLabel (tr("Max. Relative Grid Error [-]: "));
+    grid->addWidget(label, gridRowCount, 0);
+    waveGridError = new NumberEdit ();
+    waveGridError->setMinimumWidth(MinEditWidth);
+    waveGridError->setMaximumWidth(MaxEditWidth);
+    waveGridError->setAutomaticPrecision(4);
+    waveGridError->setMinimum(0);
+    miniHBox = new QHBoxLayout ();
+    miniHBox->addStretch();
+    miniHBox->addWidget(waveGridError);
+    grid->addLayout(miniHBox, gridRowCount++, 1);
+
     groupBox = new QGroupBox ("Stored Simulation Data");
     vBox->addWidget(groupBox);
     grid = new QGridLayout ();
@@ -1675,6 +1780,24 @@ void QSimulationCreatorDialog::onCreateButtonClicked(){
                         seabedShear->getValue()
                         );
 
+    m_simulation->m_bUseWaveGrid = waveGridGroup->button(0)->isChecked();
+    m_simulation->m_waveGridInterpolation = waveGridInterpolationGroup->checkedId();
+    m_simulation->m_waveGridSpacing = waveGridSpacing->getValue();
+    m_simulation->m_waveGridVerticalSpacing = waveGridVerticalSpacing->getValue();
+    m_simulation->m_waveGridTimestep = waveGridTimestep->getValue();
+    m_simulation->m_waveGridErrorBound = waveGridError->getValue();
+    m_simulation->m_aeroCouplingType = aeroCouplingBox->currentIndex();
+    m_simulation->m_aeroCouplingLimit = aeroCouplingLimit->getValue();
+    if (m_editedSimulation){
+        m_simulation->m_bladeOutputChannels = m_editedSimulation->m_bladeOutputChannels;
+        m_simulation->m_streamFileName = m_editedSimulation->m_streamFileName;
+        m_simulation->m_streamWindow = m_editedSimulation->m_streamWindow;
+        m_simulation->m_bTreecodeInduction = m_editedSimulation->m_bTreecodeInduction;
+        m_simulation->m_treecodeTheta = m_editedSimulation->m_treecodeTheta;
+        m_simulation->m_treecodeOrder = m_editedSimulation->m_treecodeOrder;
+        m_simulation->m_bTreecodeCheck = m_editedSimulation->m_bTreecodeCheck;
+    }
+
 
     for (int i=turbineSimulationBox->count()-1;i>=0;i--) g_QTurbineSimulationStore.remove(turbineSimulationBox->getObjectAt(i));
 
@@ -1837,6 +1960,16 @@ void QSimulationCreatorDialog::initView(){
         seabedDamp->setValue(m_editedSimulation->m_seabedDampFactor);
         seabedShear->setValue(m_editedSimulation->m_seabedShearFactor);
 
+        waveGridGroup->button(m_editedSimulation->m_bUseWaveGrid ? 0 : 1)->setChecked(true);
+        waveGridInterpolationGroup->button(m_editedSimulation->m_waveGridInterpolation)->setChecked(true);
+        waveGridSpacing->setValue(m_editedSimulation->m_waveGridSpacing);
+        waveGridVerticalSpacing->setValue(m_editedSimulation->m_waveGridVerticalSpacing);
+        waveGridTimestep->setValue(m_editedSimulation->m_waveGridTimestep);
+        waveGridError->setValue(m_editedSimulation->m_waveGridErrorBound);
+
+        aeroCouplingBox->setCurrentIndex(m_editedSimulation->m_aeroCouplingType);
+        aeroCouplingLimit->setValue(m_editedSimulation->m_aeroCouplingLimit);
+
         int i;
         if (m_editedSimulation->m_bStoreAeroRotorData) i = 0;
         else i = 1;
@@ -2094,6 +2227,16 @@ void QSimulationCreatorDialog::initView(){
         seabedDamp->setValue(0.5);
         seabedShear->setValue(0.0);
 
+        waveGridGroup->button(1)->setChecked(true);
+        waveGridInterpolationGroup->button(WAVEGRID_CUBIC)->setChecked(true);
+        waveGridSpacing->setValue(4);
+        waveGridVerticalSpacing->setValue(2);
+        waveGridTimestep->setValue(0.1);
+        waveGridError->setValue(0.02);
+
+        aeroCouplingBox->setCurrentIndex(AEROCOUPLING_HOLD);
+        aeroCouplingLimit->setValue(0.5);
+
         windStitchingGroup->button(0)->setChecked(true);
         windShiftGroup->button(0)->setChecked(true);
         windFieldShift->setValue(0);
@@ -2132,6 +2275,7 @@ void QSimulationCreatorDialog::initView(){
     connect(windShiftGroup,SIGNAL(buttonToggled(int,bool)),this,SLOT(OnWindfieldShiftChanged()));
     connect(modalAnalysisGroup,SIGNAL(buttonToggled(int,bool)), this, SLOT(OnSpecialSimChanged()));
     connect(intBox,SIGNAL(currentIndexChanged(int)), this, SLOT(OnIntegratorChanged()));
+    connect(aeroCouplingBox,SIGNAL(currentIndexChanged(int)), this, SLOT(OnAeroCouplingChanged()));
     connect(timestepSize ,SIGNAL(valueChanged(double)), this, SLOT(OnTimestepChanged()));
     connect(numberOfTimesteps ,SIGNAL(valueChanged(double)), this, SLOT(OnNumberTimestepsChanged()));
     connect(simulationLength ,SIGNAL(valueChanged(double)), this, SLOT(OnSimulationLengthChanged()));
@@ -2141,6 +2285,8 @@ void QSimulationCreatorDialog::initView(){
     connect(tipSpeedRatioCurrentTurbine,SIGNAL(valueChanged(double)),this,SLOT(OnTSRChanged()));
     connect(windShiftGroup,SIGNAL(buttonToggled(int,bool)),this,SLOT(OnWindfieldShiftChanged()));
 
+    OnAeroCouplingChanged();
+
 }
 
 void QSimulationCreatorDialog::OnCreateWindfield(){
@@ -2927,6 +3073,11 @@ void QSimulationCreatorDialog::OnTurbineChanged(bool reset){
     OnTSRChanged();
 }
 
+void QSimulationCreatorDialog::OnAeroCouplingChanged(){
+
+    aeroCouplingLimit->setEnabled(aeroCouplingBox->currentIndex() == AEROCOUPLING_EXTRAPOLATE);
+}
+
 void QSimulationCreatorDialog::OnIntegratorChanged(){
 
     if (intBox->currentIndex() == 0 || intBox->currentIndex() == 3) iterationEdit->setEnabled(true);
@@ -47,6 +47,8 @@ public:
     NumberEdit *windFieldShift, *horizontalWindspeed, *verticalInflowAngle, *horizontalInflowAngle, *powerLawShearExponent, *referenceHeight, *directionalShear, *roughnessLength, *azimuthalStep, *timestepSize, *precomputeTime, *overdampTime, *overdampFactor, *numberOfTimesteps, *simulationLength;
     NumberEdit *iterationEdit, *storeOutputFrom, *airDensity, *gravity, *waterDensity, *kinematicViscosity, *kinematicViscosityWater, *interactionTime, *tipSpeedRatioCurrentTurbine;
     NumberEdit *minFreq, *deltaFreq, *seabedStiffness, *seabedShear, *seabedDamp;
+    NumberEdit *waveGridSpacing, *waveGridVerticalSpacing, *waveGridTimestep, *waveGridError;
+    QButtonGroup *waveGridGroup, *waveGridInterpolationGroup;
     WindFieldComboBox *windFieldBox;
     QPushButton *eventDefinitionFile, *eventDefinitionFileView, *simFile, *simFileView, *motionFile, *motionFileView, *loadingFile, *loadingFileView;
     QString eventStreamName, MotionFileName, SimFileName, mooringFileName, loadingStreamName;
@@ -64,7 +66,8 @@ public:
     QLineEdit *nameEditCurrentTurbine;
     NumberEdit *numberSubstepsCurrentTurbine, *n_thWakStepCurrentTurbine, *relaxationStepsCurrentTurbine, *omegaCurrentTurbine;
     NumberEdit *positionXCurrentTurbine, *positionYCurrentTurbine, *positionZCurrentTurbine;
-    QComboBox *intBox;
+    QComboBox *intBox, *aeroCouplingBox;
+    NumberEdit *aeroCouplingLimit;
     NumberEdit *initialZimuthalAngle, *rotorYaw, *collectivePitchAngle, *yaw, *pitch, *roll, *transX, *transY, *transZ;
 
     QGroupBox *floaterBox;
@@ -137,6 +140,7 @@ private slots:
     void OnEditPrototype();
     void OnRPMChanged();
     void OnIntegratorChanged();
+    void OnAeroCouplingChanged();
     void OnSpecialSimChanged();
     void OnCreateWindfield();
     void OnEditWindfield();
@@ -33,6 +33,7 @@
 #include "src/GlobalFunctions.h"
 #include "src/Globals.h"
 #include "src/ImportExport.h"
+#include "src/SpectralAnalysis.h"
 
 QSimulationDock::QSimulationDock(const QString & title, QMainWindow * parent, Qt::WindowFlags flags, QSimulationModule *module)
     : ScrolledDock (title, parent, flags)
@@ -96,8 +97,37 @@ QSimulationDock::QSimulationDock(const QString & title, QMainWindow * parent, Qt
     grid->addWidget(m_OpenClDevice,0,0);
     m_OpenClDevice->addItem("CPU: Single Thread");
     m_OpenClDevice->addItem("CPU: OpenMP Multi Threading");
+    m_OpenClDevice->addItem("CPU: OpenMP Treecode");
     m_OpenClDevice->setCurrentIndex(1);
 
+    m_treecodeBox = new QWidget;
+    grid->addWidget(m_treecodeBox,1,0);
+    QGridLayout *treeGrid = new QGridLayout ();
+    treeGrid->setContentsMargins(0,0,0,0);
+    m_treecodeBox->setLayout(treeGrid);
+    label = new QLabel(tr("Opening Angle [-]: "));
+    treeGrid->addWidget(label,0,0);
+    m_treecodeTheta = new NumberEdit();
+    m_treecodeTheta->setMinimum(0);
+    m_treecodeTheta->setMaximum(0.9);
+    m_treecodeTheta->setAutomaticPrecision(2);
+    m_treecodeTheta->setValue(0.5);
+    m_treecodeTheta->setToolTip("Clusters with (cluster radius / distance) below this value are evaluated with a multipole expansion, 0 reproduces the direct sum");
+    treeGrid->addWidget(m_treecodeTheta,0,1);
+    label = new QLabel(tr("Expansion Order [-]: "));
+    treeGrid->addWidget(label,1,0);
+    m_treecodeOrder = new QSpinBox();
+    m_treecodeOrder->setMinimum(0);
+    m_treecodeOrder->setMaximum(2);
+    m_treecodeOrder->setValue(2);
+    m_treecodeOrder->setToolTip("0: Monopole, 1: Dipole, 2: Quadrupole");
+    treeGrid->addWidget(m_treecodeOrder,1,1);
+    m_treecodeCheck = new QCheckBox("Check against Direct Sum");
+    m_treecodeCheck->setChecked(false);
+    m_treecodeCheck->setToolTip("Compares the treecode velocities with the direct sum for a subset of the wake at every wake step and stores the error in the simulation results");
+    treeGrid->addWidget(m_treecodeCheck,2,0,1,2);
+    m_treecodeBox->setVisible(false);
+
     m_progressBox = new QGroupBox(tr("Simulation Progress"));
     m_contentVBox->addWidget(m_progressBox);
     grid = new QGridLayout ();
@@ -246,6 +276,41 @@ QSimulationDock::QSimulationDock(const QString & title, QMainWindow * parent, Qt
     label = new QLabel(tr("[s]"));
     grid->addWidget(label,0,5);
 
+    // Welch settings of the PSD graphs, a segment length of 0 splits the time range into 8 segments
+    label = new QLabel(tr("PSD Segment:"));
+    grid->addWidget(label,1,0);
+    m_PSDSegmentLength = new QSpinBox;
+    m_PSDSegmentLength->setMinimum(0);
+    m_PSDSegmentLength->setMaximum(100000000);
+    m_PSDSegmentLength->setSingleStep(256);
+    m_PSDSegmentLength->setValue(0);
+    m_PSDSegmentLength->setSpecialValueText(tr("auto"));
+    m_PSDSegmentLength->setToolTip(tr("Number of samples per Welch segment, auto = 8 segments over the plot time range"));
+    m_PSDSegmentLength->setMaximumSize(maximumSpinWidth,maximumSpinHeight);
+    grid->addWidget(m_PSDSegmentLength,1,1);
+    label = new QLabel(tr("[-]"));
+    grid->addWidget(label,1,2);
+    label = new QLabel(tr("Overlap:"));
+    grid->addWidget(label,1,3);
+    m_PSDOverlap = new QDoubleSpinBox;
+    m_PSDOverlap->setMinimum(0);
+    m_PSDOverlap->setMaximum(95);
+    m_PSDOverlap->setSingleStep(5);
+    m_PSDOverlap->setDecimals(1);
+    m_PSDOverlap->setValue(50);
+    m_PSDOverlap->setMaximumSize(maximumSpinWidth,maximumSpinHeight);
+    grid->addWidget(m_PSDOverlap,1,4);
+    label = new QLabel(tr("[%]"));
+    grid->addWidget(label,1,5);
+    label = new QLabel(tr("PSD Window:"));
+    grid->addWidget(label,2,0);
+    m_PSDWindow = new QComboBox;
+    m_PSDWindow->addItem(tr("Rectangular"));
+    m_PSDWindow->addItem(tr("Hann"));
+    m_PSDWindow->addItem(tr("Hamming"));
+    m_PSDWindow->setCurrentIndex(WINDOW_HANN);
+    grid->addWidget(m_PSDWindow,2,1,1,2);
+
     m_combinedAveragesBox = new QGroupBox (tr("Plot Ensemble Data"));
     grid = new QGridLayout ();
     m_combinedAveragesBox->setLayout(grid);
@@ -996,6 +1061,9 @@ QSimulationDock::QSimulationDock(const QString & title, QMainWindow * parent, Qt
     connect(m_sectionEdit,SIGNAL(valueChanged(double)),this,SLOT(onSectionChanged(double)));
     connect(m_TimeSectionStart,SIGNAL(valueChanged(double)),m_module,SLOT(reloadAllGraphs()));
     connect(m_TimeSectionEnd,SIGNAL(valueChanged(double)),m_module,SLOT(reloadAllGraphs()));
+    connect(m_PSDSegmentLength,SIGNAL(valueChanged(int)),m_module,SLOT(reloadAllGraphs()));
+    connect(m_PSDOverlap,SIGNAL(valueChanged(double)),m_module,SLOT(reloadAllGraphs()));
+    connect(m_PSDWindow,SIGNAL(currentIndexChanged(int)),m_module,SLOT(reloadAllGraphs()));
     connect(m_curveStyleBox->m_simulationLineButton, SIGNAL(clicked()), this, SLOT(onLineButtonClicked()));
     connect(m_curveStyleBox->m_showCheckBox, SIGNAL(stateChanged(int)), this, SLOT(onShowCheckBoxCanged()));
     connect(m_curveStyleBox->m_showCurveCheckBox, SIGNAL(stateChanged(int)), this, SLOT(onShowCurveCheckBoxCanged()));
@@ -1414,6 +1482,7 @@ void QSimulationDock::onSimulationStarted(){
     m_exportVelVolume->setEnabled(false);
 
     m_OpenClDevice->setEnabled(false);
+    m_treecodeBox->setEnabled(false);
     m_module->DisableButtons();
 
 }
@@ -1456,6 +1525,7 @@ void QSimulationDock::onSimulationStopped(){
     m_module->m_QSimulationThread->deleteLater();
 
     m_OpenClDevice->setEnabled(true);
+    m_treecodeBox->setEnabled(true);
 
     m_module->EnableButtons();
     m_module->CurrentSimulationChanged();
@@ -1477,8 +1547,10 @@ void QSimulationDock::updateProgress(int i){
 void QSimulationDock::OnGlDeviceChanged(){
     int i=m_OpenClDevice->currentIndex();
 
-    if (i > 1){
-        g_OpenCl->CompileKernels(i-2);
+    m_treecodeBox->setVisible(i == 2);
+
+    if (i > 2){
+        g_OpenCl->CompileKernels(i-3);
     }
 }
 
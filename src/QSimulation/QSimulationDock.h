@@ -91,6 +91,9 @@ public:
     NumberEdit *m_sceneRenderWidth, *m_sceneRenderLength, *m_oceanDiscW, *m_oceanDiscL, *m_sceneCenterX, *m_sceneCenterY;
 
     QSpinBox *m_modeNumber, *m_modeAmplification;
+    QSpinBox *m_PSDSegmentLength;
+    QDoubleSpinBox *m_PSDOverlap;
+    QComboBox *m_PSDWindow;
     QSlider *m_modeSlider;
     QPushButton *m_modeAnimationButton;
     QLabel *m_DelayLabel;
@@ -108,6 +111,10 @@ public:
     QCheckBox *m_evalAllBox, *m_skipFinished, *m_SaveAfterEval, *m_disableGL;
 
     QComboBox *m_OpenClDevice;
+    QWidget *m_treecodeBox;
+    NumberEdit *m_treecodeTheta;
+    QSpinBox *m_treecodeOrder;
+    QCheckBox *m_treecodeCheck;
 
     QPushButton *m_addPlane, *m_deleteAllPlanes, *m_exportPlane, *m_exportVelVolume, *m_exportAllPlanes, *m_canceldeletePlane;
     QGroupBox *m_cutBox;
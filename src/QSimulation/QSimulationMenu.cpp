@@ -25,6 +25,7 @@
 #include "src/IceThrowSimulation/IceThrowSimulation.h"
 #include "src/QTurbine/QTurbine.h"
 #include "src/StructModel/StrModel.h"
+#include "src/StructModel/PotentialFlowCache.h"
 #include "src/GlobalFunctions.h"
 #include "src/ImportExport.h"
 #include "src/Store.h"
@@ -143,6 +144,26 @@ QSimulationMenu::QSimulationMenu(QMainWindow *parent, QSimulationModule *module)
     m_showFlapBox->setCheckable(true);
     m_showFlapBox->setChecked(false);
 
+    addSeparator();
+
+    m_potentialFlowCache = new QAction(tr("Reuse Cached Potential Flow Data"), this);
+    m_potentialFlowCache->setCheckable(true);
+    m_potentialFlowCache->setChecked(PotentialFlowCache::isEnabled());
+    connect(m_potentialFlowCache, SIGNAL(toggled(bool)), this, SLOT(OnPotentialFlowCacheToggled(bool)));
+    addAction(m_potentialFlowCache);
+
+    m_clearPotentialFlowCache = new QAction(tr("Clear Potential Flow Cache"), this);
+    connect(m_clearPotentialFlowCache, SIGNAL(triggered()), this, SLOT(OnClearPotentialFlowCache()));
+    addAction(m_clearPotentialFlowCache);
+
+}
+
+void QSimulationMenu::OnPotentialFlowCacheToggled(bool enabled){
+    PotentialFlowCache::setEnabled(enabled);
+}
+
+void QSimulationMenu::OnClearPotentialFlowCache(){
+    PotentialFlowCache::clear();
 }
 
 void QSimulationMenu::OnImportSimulation(){
@@ -33,6 +33,7 @@ public:
     *m_exportDataBINARY, *m_exportAllDataASCII, *m_exportAllDataBINARY, *m_exportIce, *m_exportFrequencies, *m_exportEnsembleDataASCII, *m_exportEnsembleDataBINARY;
     QAction *m_importSimulation, *m_ExportSimulation, *m_showStructVizOptions, *m_ExportAllSimulations;
     QAction *m_importVelocityCutPlane, *m_exportVelocityCutPlane, *m_deleteAll;
+    QAction *m_potentialFlowCache, *m_clearPotentialFlowCache;
 
 private:
     QSimulationModule *m_module;
@@ -63,6 +64,9 @@ private slots:
     void OnExportIce();
     void OnExportFrequencies();
 
+    void OnPotentialFlowCacheToggled(bool enabled);
+    void OnClearPotentialFlowCache();
+
 
 };
 
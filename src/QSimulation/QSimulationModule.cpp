@@ -38,6 +38,7 @@
 #include "QVelocityCutPlane.h"
 
 #include "QSimulationToolBar.h"
+#include "src/SpectralAnalysis.h"
 
 QSimulationModule::QSimulationModule(QMainWindow *mainWindow, QToolBar *toolbar)
 {
@@ -286,66 +287,133 @@ void QSimulationModule::CalculateEnsembleGraphs(int numSteps, int sortIndex, boo
     reloadEnsembleGraphs();
 }
 
-QList<NewCurve*> QSimulationModule::newFFTCurves (QString xAxis, QString yAxis){
-    QList<NewCurve*> curves;
+QString QSimulationModule::getPSDChannel(QTurbine *turbine, QString yAxis, int &from, int &length){
 
-    for (int i=0;i<g_QTurbineSimulationStore.size();i++){
+    // returns the key of the PSD of a channel in the plot time range, or an empty string if it can't be evaluated
 
-        if (g_QTurbineSimulationStore.at(i)->isShownInGraph() && g_QTurbineSimulationStore.at(i)->m_TimeArray.size()){
+    if (!turbine->isShownInGraph() || !turbine->m_TimeArray.size()) return QString();
 
-            bool evaluate = true;
+    const int yAxisIndex = turbine->m_availableCombinedVariables.indexOf(yAxis);
+    if (yAxisIndex == -1) return QString();
 
-            const int yAxisIndex = g_QTurbineSimulationStore.at(i)->m_availableCombinedVariables.indexOf(yAxis);
-            if (yAxisIndex == -1) {
-                evaluate = false;
-            }
+    double fromTime = m_Dock->m_TimeSectionStart->value();
+    double toTime = m_Dock->m_TimeSectionEnd->value();
 
-            double fromTime = m_Dock->m_TimeSectionStart->value();
-            double toTime = m_Dock->m_TimeSectionEnd->value();
-
-            if (fromTime > g_QTurbineSimulationStore.at(i)->m_TimeArray.at(g_QTurbineSimulationStore.at(i)->m_TimeArray.size()-1)) evaluate = false;
-            int from = 0, to = g_QTurbineSimulationStore.at(i)->m_TimeArray.size(), length;
-            if (fromTime > g_QTurbineSimulationStore.at(i)->m_TimeArray.at(0)){
-                for (int j=0;j<g_QTurbineSimulationStore.at(i)->m_TimeArray.size();j++){
-                    if (fromTime < g_QTurbineSimulationStore.at(i)->m_TimeArray.at(j)){
-                        from = j-1;
-                        break;
-                    }
-                }
+    if (fromTime > turbine->m_TimeArray.at(turbine->m_TimeArray.size()-1)) return QString();
+    int to = turbine->m_TimeArray.size();
+    from = 0;
+    if (fromTime > turbine->m_TimeArray.at(0)){
+        for (int j=0;j<turbine->m_TimeArray.size();j++){
+            if (fromTime < turbine->m_TimeArray.at(j)){
+                from = j-1;
+                break;
             }
-            if (toTime < g_QTurbineSimulationStore.at(i)->m_TimeArray.at(g_QTurbineSimulationStore.at(i)->m_TimeArray.size()-1)){
-                for (int j=g_QTurbineSimulationStore.at(i)->m_TimeArray.size()-1;j>=0;j--){
-                    if (toTime > g_QTurbineSimulationStore.at(i)->m_TimeArray.at(j)){
-                        to = j+1;
-                        break;
-                    }
-                }
+        }
+    }
+    if (toTime < turbine->m_TimeArray.at(turbine->m_TimeArray.size()-1)){
+        for (int j=turbine->m_TimeArray.size()-1;j>=0;j--){
+            if (toTime > turbine->m_TimeArray.at(j)){
+                to = j+1;
+                break;
             }
-            length = to - from;
-            if (length < 0 || length == 0) evaluate = false;
+        }
+    }
+    length = to - from;
+    if (length <= 200) return QString();
 
+    const QVector<float> *data = turbine->m_AllData.at(yAxisIndex);
 
-            if (evaluate){
+    // the data pointer and the first and last sample identify the data of the channel after a simulation is rerun
 
-                QVector<float> data = g_QTurbineSimulationStore.at(i)->m_AllData.at(yAxisIndex)->mid(from,length);
+    return QString("%1|%2|%3|%4|%5|%6|%7|%8|%9").arg(quintptr(turbine)).arg(yAxis).arg(quintptr(data->constData())).arg(from).arg(length)
+            .arg(data->at(from)).arg(data->at(from+length-1)).arg(turbine->m_QSim->m_timestepSize)
+            .arg(QString("%1|%2|%3").arg(m_Dock->m_PSDSegmentLength->value()).arg(m_Dock->m_PSDOverlap->value()).arg(m_Dock->m_PSDWindow->currentIndex()));
+}
 
-                QVector<float> xData,yData;
+void QSimulationModule::calculatePSDCache(){
 
-                CalculatePSD(&data,xData,yData,g_QTurbineSimulationStore.at(i)->m_QSim->m_timestepSize);
+    // the spectra of all channels that are shown in PSD graphs are evaluated in one batch, in parallel over the channels
 
-                if (xData.size() && yData.size()){
+    int numGraphs = 8;
+    switch (getGraphArrangement()) {
+    case Single: numGraphs = 1; break;
+    case Vertical: case Horizontal: numGraphs = 2; break;
+    case Vertical3: numGraphs = 3; break;
+    case Quad: case QuadVertical: numGraphs = 4; break;
+    case Six: case SixVertical: numGraphs = 6; break;
+    default: numGraphs = 8; break;
+    }
 
-                    NewCurve *curve = new NewCurve (g_QTurbineSimulationStore.at(i));
-                    curve->setAllPoints(xData.data(),
-                                        yData.data(),
-                                        yData.size());  // numberOfRows is the same for all results
-                    curves.append(curve);
+    QStringList keys;
+    QList<QVector<float> > channels;
+    QList<double> timesteps;
 
-                }
-            }
+    for (int k=0;k<numGraphs;k++){
+
+        if (!m_graph[k] || m_graph[k]->getGraphType() != NewGraph::PSDGraph) continue;
+
+        const QString yAxis = m_graph[k]->getShownYVariable();
+
+        for (int i=0;i<g_QTurbineSimulationStore.size();i++){
+
+            QTurbine *turbine = g_QTurbineSimulationStore.at(i);
+
+            int from, length;
+            const QString key = getPSDChannel(turbine, yAxis, from, length);
+            if (!key.size() || keys.contains(key)) continue;
+
+            keys.append(key);
+            channels.append(turbine->m_AllData.at(turbine->m_availableCombinedVariables.indexOf(yAxis))->mid(from,length));
+            timesteps.append(turbine->m_QSim->m_timestepSize);
+        }
+    }
+
+    QList<QVector<float> > xData, yData;
+    CalculateWelchPSDBatch(channels, timesteps, xData, yData, m_Dock->m_PSDSegmentLength->value(), m_Dock->m_PSDOverlap->value()/100.0, m_Dock->m_PSDWindow->currentIndex());
+
+    m_PSDCache.clear();
+    for (int i=0;i<keys.size();i++) m_PSDCache.insert(keys.at(i), qMakePair(xData.at(i), yData.at(i)));
+}
+
+QList<NewCurve*> QSimulationModule::newFFTCurves (QString /*xAxis*/, QString yAxis){
+    QList<NewCurve*> curves;
+
+    // the first PSD graph that requests a channel which is not cached evaluates all shown PSD channels, the other
+    // PSD graphs of the same reload take their spectra from the cache
+
+    QList<QTurbine*> turbines;
+    QStringList keys;
+
+    for (int i=0;i<g_QTurbineSimulationStore.size();i++){
+        int from, length;
+        const QString key = getPSDChannel(g_QTurbineSimulationStore.at(i), yAxis, from, length);
+        if (key.size()){
+            turbines.append(g_QTurbineSimulationStore.at(i));
+            keys.append(key);
+        }
+    }
+
+    for (int i=0;i<keys.size();i++){
+        if (!m_PSDCache.contains(keys.at(i))){
+            calculatePSDCache();
+            break;
         }
     }
 
+    for (int i=0;i<turbines.size();i++){
+
+        if (!m_PSDCache.contains(keys.at(i))) continue;
+
+        QPair<QVector<float>, QVector<float> > psd = m_PSDCache.value(keys.at(i));
+
+        if (psd.first.size() && psd.second.size()){
+            NewCurve *curve = new NewCurve (turbines.at(i));
+            curve->setAllPoints(psd.first.data(),
+                                psd.second.data(),
+                                psd.second.size());  // numberOfRows is the same for all results
+            curves.append(curve);
+        }
+    }
 
     return curves;
 }
@@ -1151,6 +1219,7 @@ void QSimulationModule::LoadSettings(QSettings *pSettings){
         m_Menu->m_showCutPlanes->setChecked(pSettings->value("ShowCut",false).toBool());
         m_Menu->m_showFlapBox->setChecked(pSettings->value("ShowFlap",false).toBool());
         m_Menu->m_showBatchOptions->setChecked(pSettings->value("ShowBatch",true).toBool());
+        m_Menu->m_potentialFlowCache->setChecked(pSettings->value("PotFlowCache",true).toBool());
         m_Dock->m_autoScaleScene->setChecked(pSettings->value("AutoScale",true).toBool());
         m_Dock->m_sceneRenderWidth->setValue(pSettings->value("RenderWidth",200).toDouble());
         m_Dock->m_sceneRenderLength->setValue(pSettings->value("RenderLength",200).toDouble());
@@ -1255,6 +1324,7 @@ void QSimulationModule::SaveSettings(QSettings *pSettings){
         pSettings->setValue("ShowCut", m_Menu->m_showCutPlanes->isChecked());
         pSettings->setValue("ShowFlap", m_Menu->m_showFlapBox->isChecked());
         pSettings->setValue("ShowBatch", m_Menu->m_showBatchOptions->isChecked());
+        pSettings->setValue("PotFlowCache", m_Menu->m_potentialFlowCache->isChecked());
         pSettings->setValue("AutoScale", m_Dock->m_autoScaleScene->isChecked());
         pSettings->setValue("RenderWidth", m_Dock->m_sceneRenderWidth->getValue());
         pSettings->setValue("RenderLength", m_Dock->m_sceneRenderLength->getValue());
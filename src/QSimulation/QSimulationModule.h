@@ -19,6 +19,7 @@
 #define QSIMULATIONMODULE_H
 
 #include <QModelIndex>
+#include <QHash>
 #include "../Module.h"
 #include "../Params.h"
 #include "../GUI/GLLightSettings.h"
@@ -72,6 +73,9 @@ public:
     QList<NewCurve *> newEnsembleCurves(QString xAxis, QString yAxis);
     QList<NewCurve *> newCampbellCurves(QString xAxis, QString yAxis);
     QList<NewCurve *> newFFTCurves(QString xAxis, QString yAxis);
+    QString getPSDChannel(QTurbine *turbine, QString yAxis, int &from, int &length);
+    void calculatePSDCache();
+    QHash<QString, QPair<QVector<float>, QVector<float> > > m_PSDCache;   // frequencies and PSD of the channels shown in PSD graphs
 
     void CalculateEnsembleGraphs(int numSteps, int sortIndex, bool average_revolutions);
     QVector< QVector <float> > m_EnsembleMin, m_EnsembleMax, m_EnsembleMean, m_EnsembleStd;
@@ -119,6 +123,9 @@ public slots:
     void AddDeviceType(QString strong){ return m_Dock->m_OpenClDevice->addItem(strong); }
     void SetDeviceType(int index){ return m_Dock->m_OpenClDevice->setCurrentIndex(index); }
     QComboBox* GetDevices(){ return m_Dock->m_OpenClDevice; }
+    double GetTreecodeTheta(){ return m_Dock->m_treecodeTheta->getValue(); }
+    int GetTreecodeOrder(){ return m_Dock->m_treecodeOrder->value(); }
+    bool GetTreecodeCheck(){ return m_Dock->m_treecodeCheck->isChecked(); }
     void reloadAllGraphs () { reloadAllGraphCurves(); }
     void reloadTimeGraphs () { reloadForGraphType(NewGraph::MultiTimeGraph);
                                reloadForGraphType(NewGraph::MultiStructTimeGraph);
@@ -0,0 +1,321 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "ResultStreamWriter.h"
+
+#include <QSaveFile>
+#include <QDataStream>
+#include <QTextStream>
+#include <QFileInfo>
+#include <QDate>
+#include <QTime>
+#include <QDir>
+#include <QSet>
+#include <QDebug>
+
+#include "QSimulation.h"
+#include "src/QTurbine/QTurbine.h"
+#include "src/GlobalFunctions.h"
+#include "src/Globals.h"
+
+#define MIN_WINDOW 10
+
+ResultStreamWriter::ResultStreamWriter(QSimulation *simulation, QTurbine *turbine, QString fileName, int window){
+
+    m_simulation = simulation;
+    m_turbine = turbine;
+    m_window = window > 0 ? std::max(window, MIN_WINDOW) : 0;
+    m_bOpen = false;
+    m_numWritten = 0;
+    m_numRemoved = 0;
+    m_numBlocks = 0;
+
+    int pos = fileName.lastIndexOf(".");
+    if (pos > fileName.lastIndexOf(QDir::separator()) && pos > fileName.lastIndexOf("/")) fileName = fileName.left(pos);
+    m_fileName = fileName;
+}
+
+ResultStreamWriter::~ResultStreamWriter(){
+    close();
+}
+
+bool ResultStreamWriter::open(){
+
+    QString pathName = m_fileName.left(std::max(m_fileName.lastIndexOf(QDir::separator()),m_fileName.lastIndexOf("/")));
+    if (!pathName.size()) pathName = ".";
+    QDir().mkpath(pathName);
+
+    if (!QFileInfo(pathName).isWritable()){
+        qDebug().noquote() << "...cant write to"<<pathName<<"for the result stream";
+        return false;
+    }
+
+    // blocks of a previous run with the same name are removed, otherwise they would appear to continue this run
+
+    QDir dir(pathName);
+    const QString baseName = QFileInfo(m_fileName).fileName();
+    QStringList oldBlocks = dir.entryList(QStringList() << baseName+"_[0-9][0-9][0-9][0-9].sel" << baseName+"_[0-9][0-9][0-9][0-9].dat", QDir::Files);
+    for (int i=0;i<oldBlocks.size();i++) dir.remove(oldBlocks.at(i));
+
+    m_bOpen = true;
+    m_numWritten = 0;
+    m_numRemoved = 0;
+    m_numBlocks = 0;
+    m_names.clear();
+    m_channels.clear();
+
+    return true;
+}
+
+int ResultStreamWriter::getMaxStored(){
+
+    // the window, the timesteps that are on disk but not yet trimmed and the timesteps of the block in progress
+
+    if (!m_window) return 0;
+    return m_window + std::max(m_window / 4, 1) + STREAM_BLOCKSIZE;
+}
+
+void ResultStreamWriter::createChannels(){
+
+    // same channel order and naming as QTurbineResults::GetCombinedVariableNamesAndData(); channels that are still
+    // empty when the first timestep is stored (e.g. controller swap arrays without controller) are not streamed
+
+    QSet<QString> names;
+
+    QList<QPair<const QVector<QVector<float> > *, const QStringList *> > groups;
+    groups.append(qMakePair((const QVector<QVector<float> > *) &m_turbine->m_TurbineStructData, (const QStringList *) &m_turbine->m_availableRotorStructVariables));
+    groups.append(qMakePair((const QVector<QVector<float> > *) &m_turbine->m_RotorAeroData, (const QStringList *) &m_turbine->m_availableRotorAeroVariables));
+
+    for (int g=0;g<groups.size();g++){
+        for (int i=0;i<groups.at(g).first->size() && i<groups.at(g).second->size();i++){
+            if (!groups.at(g).first->at(i).size() || names.contains(groups.at(g).second->at(i))) continue;
+            names.insert(groups.at(g).second->at(i));
+            m_names.append(groups.at(g).second->at(i));
+            Channel channel = {groups.at(g).first, i, 0};
+            m_channels.append(channel);
+        }
+    }
+
+    if (m_turbine->m_BladeAeroData.size()){
+        const QVector<QVector<float> > &blade = m_turbine->m_BladeAeroData.at(0);
+        for (int i=0;i<blade.size() && i<m_turbine->m_availableBladeAeroVariables.size();i++){
+
+            const int pos = m_turbine->m_availableBladeAeroVariables.at(i).lastIndexOf("[");
+            const QString prefix = m_turbine->m_availableBladeAeroVariables.at(i).left(pos) + "PAN ";
+            const QString suffix = " " + m_turbine->m_availableBladeAeroVariables.at(i).mid(pos);
+
+            for (int j=0;j<blade.at(i).size();j++){
+                QString varName = prefix + QString().number(j,'f',0) + suffix;
+                if (names.contains(varName)) continue;
+                names.insert(varName);
+                m_names.append(varName);
+                Channel channel = {NULL, i, j};
+                m_channels.append(channel);
+            }
+        }
+    }
+
+    groups.clear();
+    groups.append(qMakePair((const QVector<QVector<float> > *) &m_turbine->m_HydroData, (const QStringList *) &m_turbine->m_availableHydroVariables));
+    groups.append(qMakePair((const QVector<QVector<float> > *) &m_turbine->m_ControllerData, (const QStringList *) &m_turbine->m_availableControllerVariables));
+
+    for (int g=0;g<groups.size();g++){
+        for (int i=0;i<groups.at(g).first->size() && i<groups.at(g).second->size();i++){
+            if (!groups.at(g).first->at(i).size() || names.contains(groups.at(g).second->at(i))) continue;
+            names.insert(groups.at(g).second->at(i));
+            m_names.append(groups.at(g).second->at(i));
+            Channel channel = {groups.at(g).first, i, 0};
+            m_channels.append(channel);
+        }
+    }
+}
+
+int ResultStreamWriter::getNumAvailable(){
+
+    // the channels are filled at different points of a timestep, only timesteps that are complete in all channels are written
+
+    int num = m_turbine->m_TimeArray.size();
+
+    for (int i=0;i<m_channels.size();i++){
+        if (m_channels.at(i).data) num = std::min(num, m_channels.at(i).data->at(m_channels.at(i).index).size());
+        else num = std::min(num, m_turbine->m_BladeAeroData.size());
+    }
+
+    return num + m_numRemoved;
+}
+
+float ResultStreamWriter::getValue(const Channel &channel, int row){
+
+    const int k = row - m_numRemoved;
+
+    if (channel.data) return channel.data->at(channel.index).at(k);
+
+    const QVector<float> &panels = m_turbine->m_BladeAeroData.at(k).at(channel.index);
+    if (channel.panel < panels.size()) return panels.at(channel.panel);
+    return 0;
+}
+
+QString ResultStreamWriter::getBlockName(int block){
+
+    return m_fileName + "_" + QString("%1").arg(block+1, 4, 10, QChar('0'));
+}
+
+void ResultStreamWriter::append(){
+
+    if (!m_bOpen) return;
+
+    if (!m_channels.size()){
+        if (!m_turbine->m_TimeArray.size()) return;
+        createChannels();
+        if (!m_channels.size()) return;
+    }
+
+    const int numAvailable = getNumAvailable();
+
+    while (numAvailable - m_numWritten >= STREAM_BLOCKSIZE)
+        if (!writeBlock(STREAM_BLOCKSIZE)) break;
+
+    if (m_window) trimMemory();
+}
+
+bool ResultStreamWriter::writeBlock(int numRows){
+
+    // the HAWC2 binary format stores every channel contiguously as int16, scaled with one factor per channel
+
+    QVector<QVector<float> > values(m_channels.size());
+    QVector<double> scaleFactors;
+
+    for (int j=0;j<m_channels.size();j++){
+        values[j].resize(numRows);
+        for (int i=0;i<numRows;i++) values[j][i] = getValue(m_channels.at(j), m_numWritten+i);
+        double factor = findAbsMinMax(&values[j])/32000.;
+        if (factor <= 0) factor = 1;
+        scaleFactors.append(factor);
+    }
+
+    const QString blockName = getBlockName(m_numBlocks);
+
+    QSaveFile file(blockName+".dat");
+    if (!file.open(QIODevice::WriteOnly)){
+        qDebug().noquote() << "...cant open"<<blockName+".dat"<<"for the result stream";
+        return false;
+    }
+
+    QDataStream dataStream(&file);
+    dataStream.setByteOrder(QDataStream::LittleEndian);
+
+    for (int j=0;j<values.size();j++)
+        for (int i=0;i<numRows;i++)
+            dataStream << qint16(values.at(j).at(i)/scaleFactors.at(j));
+
+    // the .dat file is committed before its header, a .sel file on disk always describes a complete .dat file
+
+    if (!file.commit()){
+        qDebug().noquote() << "...cant write"<<blockName+".dat"<<"for the result stream";
+        return false;
+    }
+
+    const float blockTime = m_turbine->m_TimeArray.at(m_numWritten + numRows - 1 - m_numRemoved) - m_turbine->m_TimeArray.at(m_numWritten - m_numRemoved);
+
+    if (!writeHeader(blockName, numRows, blockTime, scaleFactors)){
+        qDebug().noquote() << "...cant write"<<blockName+".sel"<<"for the result stream";
+        return false;
+    }
+
+    m_numWritten += numRows;
+    m_numBlocks++;
+
+    return true;
+}
+
+void ResultStreamWriter::trimMemory(){
+
+    // timesteps are removed in blocks of a quarter window, to avoid shifting all channels every timestep
+
+    const int numStored = m_turbine->m_TimeArray.size();
+    const int numOnDisk = m_numWritten - m_numRemoved;
+
+    int numRemove = std::min(numStored - m_window, numOnDisk);
+
+    if (numRemove < std::max(m_window / 4, 1)) return;
+
+    m_simulation->trimOutputVectors(numRemove);
+    m_numRemoved += numRemove;
+}
+
+bool ResultStreamWriter::writeHeader(QString blockName, int numRows, float blockTime, const QVector<double> &scaleFactors){
+
+    QSaveFile file(blockName+".sel");
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) return false;
+
+    QTextStream stream(&file);
+
+    QDate date = QDate::currentDate();
+    QTime time = QTime::currentTime();
+
+    int index;
+    if (blockName.lastIndexOf(QDir::separator()) > blockName.lastIndexOf("/")) index = blockName.lastIndexOf(QDir::separator());
+    else index = blockName.lastIndexOf("/");
+
+    stream << "________________________________________________________________________________________________________________________"<<endl;
+    stream << "\tGenerated with : QBlade "<<g_VersionName<<"\tSimulation Name : "<<m_simulation->getName()<<endl;
+    stream << "\tTime : "<<time.toString("hh:mm:ss")<<endl;
+    stream << "\tDate : "<<date.toString("dd.MM.yyyy")<<endl;
+    stream << "________________________________________________________________________________________________________________________"<<endl;
+    stream << "\tResult file : "<<"./"+blockName.right(blockName.size() - index - 1)+".dat"<<endl;
+    stream << "________________________________________________________________________________________________________________________"<<endl;
+    stream << QString("Scans").rightJustified(8,' ')<< QString("Channels").rightJustified(12,' ')<<QString("Time [sec]").rightJustified(14,' ') << QString("Format").rightJustified(14,' ')<<endl;
+    stream << QString().number(numRows,'f',0).rightJustified(8,' ')<< QString().number(m_names.size(),'f',0).rightJustified(12,' ')
+           <<QString().number(blockTime,'f',2).rightJustified(14,' ') << QString("BINARY").rightJustified(14,' ')<<endl;
+    stream << endl;
+    stream << "\tChannel\tVariable Description"<<endl;
+    stream << endl;
+
+    for (int i=0;i<m_names.size();i++){
+        int pos = QString(m_names.at(i)).lastIndexOf("[");
+        QString varName = QString(m_names.at(i)).left(pos);
+
+        int pos2 = QString(m_names.at(i)).size() - pos - 1;
+        QString unit = QString(m_names.at(i)).right(pos2);
+        int pos3 = unit.lastIndexOf("]");
+        unit = unit.left(pos3);
+
+        stream << QString("%1").arg(i+1, 6, 'f', 0, ' ') <<"      "<<  truncateQStringMiddle(varName,31).leftJustified(31,' ',true)<<unit.leftJustified(11,' ',true) <<endl;
+    }
+
+    stream << "________________________________________________________________________________________________________________________"<<endl;
+    stream << "Scale factors:"<<endl;
+    for (int i=0;i<scaleFactors.size();i++)
+        stream << QString().number(scaleFactors.at(i),'E',8)<<endl;
+
+    stream.flush();
+    return file.commit();
+}
+
+void ResultStreamWriter::close(){
+
+    if (!m_bOpen) return;
+
+    if (m_channels.size()){
+        const int numAvailable = getNumAvailable();
+        if (numAvailable > m_numWritten) writeBlock(numAvailable - m_numWritten);
+    }
+
+    m_bOpen = false;
+
+    if (m_numWritten) qDebug().noquote() << "...streamed"<<m_numWritten<<"timesteps in"<<m_numBlocks<<"blocks to"<<m_fileName+"_*.sel/.dat";
+}
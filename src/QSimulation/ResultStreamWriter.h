@@ -0,0 +1,78 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef RESULTSTREAMWRITER_H
+#define RESULTSTREAMWRITER_H
+
+#include <QStringList>
+#include <QVector>
+
+class QSimulation;
+class QTurbine;
+
+// Writes the stored output of a turbine simulation to HAWC2 binary result files while the simulation is running.
+// The timesteps are written in blocks of STREAM_BLOCKSIZE timesteps, every block is a complete HAWC2 binary
+// file pair (name_0001.sel/.dat, name_0002.sel/.dat, ...) with int16 data scaled per channel and block. Each pair
+// is saved atomically, after a crash all blocks on disk are readable and at most one block is lost. With a rolling
+// window (window > 0) timesteps that are on disk are removed from memory once more than window timesteps are
+// stored; the graphs, the replay and the exporters then only see the last window timesteps.
+
+#define STREAM_BLOCKSIZE 200
+
+class ResultStreamWriter
+{
+public:
+    ResultStreamWriter(QSimulation *simulation, QTurbine *turbine, QString fileName, int window = 0);
+    ~ResultStreamWriter();
+
+    bool open();
+    void append();      // writes all complete blocks of timesteps that are complete in all channels and not yet on disk
+    void close();       // writes the remaining timesteps as the last (shorter) block
+
+    int getNumWritten(){ return m_numWritten; }
+    int getMaxStored(); // upper bound of the timesteps that are kept in memory, 0 = all
+
+private:
+    struct Channel{
+        const QVector<QVector<float> > *data;   // time series channel data[index], NULL for blade data
+        int index;
+        int panel;                              // panel of the blade channel m_BladeAeroData[time][index][panel]
+    };
+
+    void createChannels();
+    int getNumAvailable();
+    float getValue(const Channel &channel, int row);
+    QString getBlockName(int block);
+    bool writeBlock(int numRows);
+    bool writeHeader(QString blockName, int numRows, float blockTime, const QVector<double> &scaleFactors);
+    void trimMemory();
+
+    QSimulation *m_simulation;
+    QTurbine *m_turbine;
+    QString m_fileName;
+    int m_window;
+    bool m_bOpen;
+
+    QStringList m_names;
+    QVector<Channel> m_channels;
+
+    int m_numWritten;      // timesteps written to disk
+    int m_numRemoved;      // timesteps removed from memory, the memory index of a timestep is row - m_numRemoved
+    int m_numBlocks;       // block files written to disk
+};
+
+#endif // RESULTSTREAMWRITER_H
@@ -563,6 +563,7 @@ NewCurve* QTurbine::newCurve (QString xAxis, QString yAxis, NewGraph::GraphType
             const int yAxisIndex = m_availableRotorAeroVariables.indexOf(yAxis);
             const bool xAxisIsBladeData = xAxisIndex >= m_RotorAeroData.size();
             const bool yAxisIsBladeData = yAxisIndex >= m_RotorAeroData.size();
+            if (xAxisIsBladeData || yAxisIsBladeData) decodeBladeAeroData();
             if (xAxisIndex == -1 || yAxisIndex == -1) {
                 return NULL;
             }
@@ -777,6 +778,7 @@ NewCurve* QTurbine::newCurve (QString xAxis, QString yAxis, NewGraph::GraphType
     }
         case NewGraph::MultiBladeGraph:
         {
+            decodeBladeAeroData();
             if (!m_BladeAeroData.size()) return NULL;
             if (m_QSim->m_shownTime > m_TimeArray.at(m_TimeArray.size()-1) || m_QSim->m_shownTime < m_TimeArray.at(0)) return NULL;
             const int xAxisIndex = m_availableBladeAeroVariables.indexOf(xAxis);
@@ -785,11 +787,14 @@ NewCurve* QTurbine::newCurve (QString xAxis, QString yAxis, NewGraph::GraphType
                 return NULL;
             }
             else{
+                // unselected channels are stored as empty vectors
+                QVector<double> X = BladeOutputAtTime(m_QSim->m_shownTime,xAxisIndex);
+                QVector<double> Y = BladeOutputAtTime(m_QSim->m_shownTime,yAxisIndex);
+                if (!X.size() || !Y.size()) return NULL;
+
                 NewCurve *curve = new NewCurve (this);
                 curve->setCurveName(m_QSim->getName()+": "+this->getName());
-                curve->setAllPoints(BladeOutputAtTime(m_QSim->m_shownTime,xAxisIndex).data(),
-                                    BladeOutputAtTime(m_QSim->m_shownTime,yAxisIndex).data(),
-                                    m_BladeAeroData[0][0].size());  // numberOfRows is the same for all results
+                curve->setAllPoints(X.data(), Y.data(), qMin(X.size(), Y.size()));
                 return curve;
             }
             return NULL;
@@ -841,7 +846,8 @@ QStringList QTurbine::getAvailableVariables (NewGraph::GraphType graphType, bool
     case NewGraph::QTurbineDiffractionIRFGraph:
         return m_avaliableDiffractionIRFData;
     case NewGraph::MultiTimeGraph:
-        return m_availableRotorAeroVariables;
+        if (!m_RotorAeroData.size()) return m_availableRotorAeroVariables;
+        return removeUnselectedBladeVariables(m_availableRotorAeroVariables, m_RotorAeroData.size());
     case NewGraph::ControllerTimeGraph:
         return m_availableControllerVariables;
     case NewGraph::FloaterTimeGraph:
@@ -851,7 +857,7 @@ QStringList QTurbine::getAvailableVariables (NewGraph::GraphType graphType, bool
     case NewGraph::AllDataGraph:
         return m_availableCombinedVariables;
     case NewGraph::MultiBladeGraph:
-        return m_availableBladeAeroVariables;
+        return removeUnselectedBladeVariables(m_availableBladeAeroVariables, 0);
     case NewGraph::MultiStructTimeGraph:
         return m_availableRotorStructVariables;
     case NewGraph::MultiStructBladeGraph:
@@ -19,9 +19,11 @@
 #include <QFileDialog>
 #include <QDate>
 #include <QTime>
+#include <QSet>
 #include "src/QTurbine/QTurbine.h"
 #include "src/StructModel/StrModel.h"
 #include "src/QSimulation/QSimulation.h"
+#include "src/QSimulation/ResultStreamWriter.h"
 #include "src/QSimulation/QSimulationModule.h"
 #include "src/Globals.h"
 #include "src/GlobalFunctions.h"
@@ -42,8 +44,14 @@ void QTurbineResults::serialize(){
     g_serializer.readOrWriteFloatVector1D(&m_TimestepArray);
 
     g_serializer.readOrWriteStringList(&m_availableBladeAeroVariables);
-    if (uintRes) g_serializer.readOrWriteCompressedResultsVector3D(&m_BladeAeroData);
-    else g_serializer.readOrWriteFloatVector3D(&m_BladeAeroData);
+    if (uintRes){
+        QMutexLocker locker(&m_bladeAeroMutex);
+        g_serializer.readOrWriteCompressedResultsVector3D(&m_BladeAeroData, &m_BladeAeroBlocks);
+    }
+    else{
+        decodeBladeAeroData();
+        g_serializer.readOrWriteFloatVector3D(&m_BladeAeroData);
+    }
 
     g_serializer.readOrWriteStringList(&m_availableRotorAeroVariables);
     if (uintRes) g_serializer.readOrWriteCompressedResultsVector2D(&m_RotorAeroData);
@@ -245,6 +253,8 @@ void QTurbineResults::initializeOutputVectors(){
 
         m_availableRotorAeroVariables.append("Number of Gamma Iterations [-]");
         m_RotorAeroData.append(dummy);
+        m_availableRotorAeroVariables.append("Gamma Iteration Time [ms]");
+        m_RotorAeroData.append(dummy);
         m_availableRotorAeroVariables.append("Number of Vortex Particles [-]");
         m_RotorAeroData.append(dummy);
         m_availableRotorAeroVariables.append("Number of Vortex Filaments [-]");
@@ -414,6 +424,8 @@ void QTurbineResults::initializeOutputVectors(){
 
         m_availableRotorAeroVariables.append("Number of Gamma Iterations [-]");
         m_RotorAeroData.append(dummy);
+        m_availableRotorAeroVariables.append("Gamma Iteration Time [ms]");
+        m_RotorAeroData.append(dummy);
         m_availableRotorAeroVariables.append("Number of Vortex Particles [-]");
         m_RotorAeroData.append(dummy);
         m_availableRotorAeroVariables.append("Number of Vortex Filaments [-]");
@@ -476,13 +488,37 @@ void QTurbineResults::initializeOutputVectors(){
     }
 }
 
+void QTurbineResults::decodeBladeAeroData(){
+
+    // the blade data is the largest part of the results, its blocks are only decoded when it is first shown or the
+    // simulation is continued, opening a project with many simulations does not pay for data that is never looked at
+
+    QMutexLocker locker(&m_bladeAeroMutex);
+
+    if (!m_BladeAeroBlocks.size()) return;
+
+    QVector<QVector<QVector<float> > > decoded;
+    if (!Serializer::decodeCompressedResultsBlocks(m_BladeAeroBlocks, &decoded)){
+        qDebug().noquote() << "...corrupted blade results block, the blade data is discarded";
+        decoded.clear();
+    }
+
+    decoded.append(m_BladeAeroData);
+    m_BladeAeroData = decoded;
+    m_BladeAeroBlocks.clear();
+    m_BladeAeroBlocks.squeeze();
+}
+
 void QTurbineResults::ClearOutputArrays(){
+    QMutexLocker locker(&m_bladeAeroMutex);
     m_TimeArray.clear();
     m_TimestepArray.clear();
     m_RotorAeroData.clear();
     m_availableRotorAeroVariables.clear();
     m_BladeAeroData.clear();
+    m_BladeAeroBlocks.clear();
     m_availableBladeAeroVariables.clear();
+    m_bStoreBladeAeroVariable.clear();
     m_availableControllerVariables.clear();
     m_ControllerData.clear();
 }
@@ -493,6 +529,12 @@ void QTurbineResults::calcResults(){
 
     if ((m_QTurbine->m_currentTime+TINYVAL) < m_QTurbine->m_QSim->m_storeOutputFrom) return;
 
+    decodeBladeAeroData();
+
+    reserveOutputVectors();
+
+    if (m_bStoreBladeAeroVariable.size() != m_availableBladeAeroVariables.size()) initializeBladeOutputSelection();
+
     if (m_QTurbine->m_bisVAWT) calcVAWTResults();
     else calcHAWTResults();  
 
@@ -503,6 +545,124 @@ void QTurbineResults::calcResults(){
 
 }
 
+static void reserveChannels(QVector<QVector<float> > &channels, int capacity){
+
+    for (int i=0;i<channels.size();i++)
+        if (channels[i].capacity() < capacity) channels[i].reserve(capacity);
+}
+
+void QTurbineResults::reserveOutputVectors(){
+
+    // all time series channels are preallocated for the number of stored timesteps of the simulation, if the
+    // simulation is continued beyond that all channels are grown together in chunks instead of on every append.
+    // With a rolling window of the result stream only the timesteps that are kept in memory are preallocated
+
+    if (m_TimeArray.size() < m_TimeArray.capacity()) return;
+
+    int capacity;
+
+    if (!m_TimeArray.size()){
+        capacity = m_QTurbine->m_QSim->m_numberTimesteps + 1;
+        if (m_QTurbine->m_QSim->m_timestepSize > 0)
+            capacity -= int(m_QTurbine->m_QSim->m_storeOutputFrom / m_QTurbine->m_QSim->m_timestepSize);
+        capacity = std::max(capacity, 1);
+    }
+    else
+        capacity = m_TimeArray.size() + std::max(m_TimeArray.size() / 4, 1000);
+
+    if (m_QTurbine->m_QSim->m_resultStream && m_QTurbine->m_QSim->m_resultStream->getMaxStored())
+        capacity = std::max(std::min(capacity, m_QTurbine->m_QSim->m_resultStream->getMaxStored()), m_TimeArray.size() + 1);
+
+    m_TimeArray.reserve(capacity);
+    m_TimestepArray.reserve(capacity);
+    m_BladeAeroData.reserve(capacity);
+
+    reserveChannels(m_RotorAeroData, capacity);
+    reserveChannels(m_TurbineStructData, capacity);
+    reserveChannels(m_HydroData, capacity);
+    reserveChannels(m_ControllerData, capacity);
+}
+
+static void trimChannels(QVector<QVector<float> > &channels, int numSteps, int capacity){
+
+    for (int i=0;i<channels.size();i++){
+        channels[i].remove(0, std::min(numSteps, channels[i].size()));
+        if (capacity && channels[i].capacity() > 2*capacity){
+            channels[i].squeeze();
+            channels[i].reserve(capacity);
+        }
+    }
+}
+
+void QTurbineResults::trimOutputVectors(int numSteps){
+
+    // removes the oldest stored timesteps from all time series channels, used by the rolling window of the result stream;
+    // channels that were allocated for more than the window (e.g. a continued simulation) are shrunk to the window
+
+    int capacity = 0;
+    if (m_QTurbine->m_QSim->m_resultStream) capacity = m_QTurbine->m_QSim->m_resultStream->getMaxStored();
+
+    m_TimeArray.remove(0, std::min(numSteps, m_TimeArray.size()));
+    m_TimestepArray.remove(0, std::min(numSteps, m_TimestepArray.size()));
+    m_BladeAeroData.remove(0, std::min(numSteps, m_BladeAeroData.size()));
+
+    if (capacity && m_TimeArray.capacity() > 2*capacity){
+        m_TimeArray.squeeze();
+        m_TimeArray.reserve(capacity);
+        m_TimestepArray.squeeze();
+        m_TimestepArray.reserve(capacity);
+        m_BladeAeroData.squeeze();
+        m_BladeAeroData.reserve(capacity);
+    }
+
+    trimChannels(m_RotorAeroData, numSteps, capacity);
+    trimChannels(m_TurbineStructData, numSteps, capacity);
+    trimChannels(m_HydroData, numSteps, capacity);
+    trimChannels(m_ControllerData, numSteps, capacity);
+}
+
+void QTurbineResults::initializeBladeOutputSelection(){
+
+    // the blade channels are matched by their name without the blade number and unit, e.g. "Angle of Attack at 0.25c";
+    // channels that are not selected are stored as empty vectors, so that the channel indices remain unchanged.
+    // The radial (or height) positions are always stored, they are needed to interpolate the data at a section
+
+    m_bStoreBladeAeroVariable.clear();
+
+    QStringList selection;
+    for (int i=0;i<m_QTurbine->m_QSim->m_bladeOutputChannels.size();i++)
+        selection.append(m_QTurbine->m_QSim->m_bladeOutputChannels.at(i).simplified().toLower());
+
+    for (int i=0;i<m_availableBladeAeroVariables.size();i++){
+
+        if (!selection.size() || i / m_QTurbine->m_numBlades == BLADE_RADIUS){
+            m_bStoreBladeAeroVariable.append(true);
+            continue;
+        }
+
+        QString name = m_availableBladeAeroVariables.at(i);
+        name = name.left(name.lastIndexOf(" Blade ")).simplified().toLower();
+        m_bStoreBladeAeroVariable.append(selection.contains(name));
+    }
+}
+
+QStringList QTurbineResults::removeUnselectedBladeVariables(const QStringList &variables, int bladeOffset){
+
+    // the variables from bladeOffset on correspond to the blade channels, channels that are not stored are not offered in the graph menus
+
+    if (!m_QTurbine->m_QSim || !m_availableBladeAeroVariables.size()) return variables;
+
+    if (m_bStoreBladeAeroVariable.size() != m_availableBladeAeroVariables.size()) initializeBladeOutputSelection();
+
+    QStringList list;
+    for (int i=0;i<variables.size();i++){
+        const int channel = i - bladeOffset;
+        if (channel >= 0 && channel < m_bStoreBladeAeroVariable.size() && !m_bStoreBladeAeroVariable.at(channel)) continue;
+        list.append(variables.at(i));
+    }
+    return list;
+}
+
 void QTurbineResults::calcHAWTResults(){
 
     if (!m_QTurbine->m_QSim) return;
@@ -520,6 +680,10 @@ void QTurbineResults::calcHAWTResults(){
     QVector<QVector<float> > BladeTimestepData;
     QVector<QVector<float> > CL, CD, RE, VIND, VTOWER, VABS, VABSNOIND, CN, CM, CR, CT, PITCHMOM, AXIND, TANIND, RADIND, FORCEN, FORCET, FORCER, AOA, AOA75, RADIUS, CLCD, GAMMA, VSAMPLE, VROTATIONAL, LENGTH;
 
+    // only the selected blade channels are evaluated, the others remain empty vectors
+    const bool *stored = m_bStoreBladeAeroVariable.constData();
+    const int numBlades = m_QTurbine->m_numBlades;
+
     double TSR = m_QTurbine->m_CurrentOmega *m_QTurbine->m_Blade->getRotorRadius() / m_QTurbine->getFreeStream(m_QTurbine->m_hubCoordsFixed.Origin ).VAbs();
     if (m_QTurbine->getFreeStream(m_QTurbine->m_hubCoordsFixed.Origin).VAbs() == 0) TSR = 0;
 
@@ -533,6 +697,7 @@ void QTurbineResults::calcHAWTResults(){
 
     if (m_QTurbine->m_QSim->m_bStoreAeroBladeData){
         QVector<float> dummy;
+        dummy.reserve(m_QTurbine->m_BladePanel.size() / m_QTurbine->m_numBlades);
         for (int m=0;m<m_QTurbine->m_numBlades;m++){
             CL.append(dummy);
             CD.append(dummy);
@@ -594,34 +759,33 @@ void QTurbineResults::calcHAWTResults(){
         azipos[m_QTurbine->m_BladePanel[k]->fromBlade] = m_QTurbine->m_BladePanel[k]->angularPos;
 
         if (m_QTurbine->m_QSim) if (m_QTurbine->m_QSim->m_bStoreAeroBladeData){
-            double REY = m_QTurbine->m_BladePanel[k]->chord*m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs()/m_QTurbine->m_kinematicViscosity;
-            CL[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_CL);
-            CD[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_CD);
-            VABS[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs());
-            VABSNOIND[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(Vec3(m_QTurbine->m_BladePanel[k]->m_V_total-m_QTurbine->m_BladePanel[k]->m_V_induced).dot(m_QTurbine->m_BladePanel[k]->a1), Vec3(m_QTurbine->m_BladePanel[k]->m_V_total-m_QTurbine->m_BladePanel[k]->m_V_induced).dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            VSAMPLE[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_sampled.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_sampled.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            VROTATIONAL[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_relative.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_relative.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            VIND[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_induced.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_induced.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            VTOWER[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_tower.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_tower.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            CN[m_QTurbine->m_BladePanel[k]->fromBlade].append(Cn);
-            CT[m_QTurbine->m_BladePanel[k]->fromBlade].append(Ct);
-            CR[m_QTurbine->m_BladePanel[k]->fromBlade].append(Cr);
-            FORCEN[m_QTurbine->m_BladePanel[k]->fromBlade].append(Cn * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
-            FORCET[m_QTurbine->m_BladePanel[k]->fromBlade].append(Ct * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
-            FORCER[m_QTurbine->m_BladePanel[k]->fromBlade].append(Cr * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
-            AOA[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_AoA);
-            AOA75[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_AoA75);
-            RADIUS[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->fromBladelength);
-            LENGTH[m_QTurbine->m_BladePanel[k]->fromBlade].append((m_QTurbine->m_BladePanel[k]->relativeLengthA+m_QTurbine->m_BladePanel[k]->relativeLengthB)/2.0);
-            RE[m_QTurbine->m_BladePanel[k]->fromBlade].append(REY);
-            AXIND[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_hubCoords.X.dot(m_QTurbine->m_BladePanel[k]->m_V_induced) / m_QTurbine->m_hubCoords.X.dot(m_QTurbine->m_BladePanel[k]->m_V_sampled)*(-1));
-            TANIND[m_QTurbine->m_BladePanel[k]->fromBlade].append(-m_QTurbine->m_BladePanel[k]->tangentialVector.dot(m_QTurbine->m_BladePanel[k]->m_V_induced) / m_QTurbine->m_BladePanel[k]->radius / m_QTurbine->m_CurrentOmega);
-            RADIND[m_QTurbine->m_BladePanel[k]->fromBlade].append(-m_QTurbine->m_BladePanel[k]->radialVector.dot(m_QTurbine->m_BladePanel[k]->m_V_induced) / m_QTurbine->m_BladePanel[k]->m_V_sampled.VAbs());
-            CLCD[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_CL/m_QTurbine->m_BladePanel[k]->m_CD);
-            if (m_QTurbine->m_bisReversed) GAMMA[m_QTurbine->m_BladePanel[k]->fromBlade].append(-m_QTurbine->m_BladePanel[k]->m_Gamma);
-            else GAMMA[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_Gamma);
-            CM[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_CM);
-            PITCHMOM[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->PitchMomentPerLength);
+            const int blade = m_QTurbine->m_BladePanel[k]->fromBlade;
+            if (stored[BLADE_CL*numBlades+blade]) CL[blade].append(m_QTurbine->m_BladePanel[k]->m_CL);
+            if (stored[BLADE_CD*numBlades+blade]) CD[blade].append(m_QTurbine->m_BladePanel[k]->m_CD);
+            if (stored[BLADE_VABS*numBlades+blade]) VABS[blade].append(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs());
+            if (stored[BLADE_VABSNOIND*numBlades+blade]) VABSNOIND[blade].append(Vec3(Vec3(m_QTurbine->m_BladePanel[k]->m_V_total-m_QTurbine->m_BladePanel[k]->m_V_induced).dot(m_QTurbine->m_BladePanel[k]->a1), Vec3(m_QTurbine->m_BladePanel[k]->m_V_total-m_QTurbine->m_BladePanel[k]->m_V_induced).dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[BLADE_VSAMPLE*numBlades+blade]) VSAMPLE[blade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_sampled.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_sampled.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[BLADE_VROTATIONAL*numBlades+blade]) VROTATIONAL[blade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_relative.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_relative.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[BLADE_VIND*numBlades+blade]) VIND[blade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_induced.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_induced.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[BLADE_VTOWER*numBlades+blade]) VTOWER[blade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_tower.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_tower.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[BLADE_CN*numBlades+blade]) CN[blade].append(Cn);
+            if (stored[BLADE_CT*numBlades+blade]) CT[blade].append(Ct);
+            if (stored[BLADE_CR*numBlades+blade]) CR[blade].append(Cr);
+            if (stored[BLADE_FORCEN*numBlades+blade]) FORCEN[blade].append(Cn * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
+            if (stored[BLADE_FORCET*numBlades+blade]) FORCET[blade].append(Ct * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
+            if (stored[BLADE_FORCER*numBlades+blade]) FORCER[blade].append(Cr * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
+            if (stored[BLADE_AOA*numBlades+blade]) AOA[blade].append(m_QTurbine->m_BladePanel[k]->m_AoA);
+            if (stored[BLADE_AOA75*numBlades+blade]) AOA75[blade].append(m_QTurbine->m_BladePanel[k]->m_AoA75);
+            if (stored[BLADE_RADIUS*numBlades+blade]) RADIUS[blade].append(m_QTurbine->m_BladePanel[k]->fromBladelength);
+            if (stored[BLADE_LENGTH*numBlades+blade]) LENGTH[blade].append((m_QTurbine->m_BladePanel[k]->relativeLengthA+m_QTurbine->m_BladePanel[k]->relativeLengthB)/2.0);
+            if (stored[BLADE_RE*numBlades+blade]) RE[blade].append(m_QTurbine->m_BladePanel[k]->chord*m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs()/m_QTurbine->m_kinematicViscosity);
+            if (stored[BLADE_AXIND*numBlades+blade]) AXIND[blade].append(m_QTurbine->m_hubCoords.X.dot(m_QTurbine->m_BladePanel[k]->m_V_induced) / m_QTurbine->m_hubCoords.X.dot(m_QTurbine->m_BladePanel[k]->m_V_sampled)*(-1));
+            if (stored[BLADE_TANIND*numBlades+blade]) TANIND[blade].append(-m_QTurbine->m_BladePanel[k]->tangentialVector.dot(m_QTurbine->m_BladePanel[k]->m_V_induced) / m_QTurbine->m_BladePanel[k]->radius / m_QTurbine->m_CurrentOmega);
+            if (stored[BLADE_RADIND*numBlades+blade]) RADIND[blade].append(-m_QTurbine->m_BladePanel[k]->radialVector.dot(m_QTurbine->m_BladePanel[k]->m_V_induced) / m_QTurbine->m_BladePanel[k]->m_V_sampled.VAbs());
+            if (stored[BLADE_CLCD*numBlades+blade]) CLCD[blade].append(m_QTurbine->m_BladePanel[k]->m_CL/m_QTurbine->m_BladePanel[k]->m_CD);
+            if (stored[BLADE_GAMMA*numBlades+blade]) GAMMA[blade].append(m_QTurbine->m_bisReversed ? -m_QTurbine->m_BladePanel[k]->m_Gamma : m_QTurbine->m_BladePanel[k]->m_Gamma);
+            if (stored[BLADE_CM*numBlades+blade]) CM[blade].append(m_QTurbine->m_BladePanel[k]->m_CM);
+            if (stored[BLADE_PITCHMOM*numBlades+blade]) PITCHMOM[blade].append(m_QTurbine->m_BladePanel[k]->PitchMomentPerLength);
         }
     }
 
@@ -736,6 +900,7 @@ void QTurbineResults::calcHAWTResults(){
     m_RotorAeroData[k++].append(pow(m_QTurbine->m_maxFilamentCoreSize,0.5));
 
     m_RotorAeroData[k++].append(m_QTurbine->m_iterations);
+    m_RotorAeroData[k++].append(m_QTurbine->m_gammaIterationTime);
     m_RotorAeroData[k++].append(m_QTurbine->m_WakeParticles.size());
     m_RotorAeroData[k++].append(m_QTurbine->m_WakeLine.size());
     m_RotorAeroData[k++].append(m_QTurbine->m_WakeNode.size());
@@ -764,6 +929,10 @@ void QTurbineResults::calcVAWTResults(){
     QVector<QVector<float> > BladeTimestepData;
     QVector<QVector<float> > CL, CD, CM, PITCHMOM, RE, VIND, VTOWER, VABS, VABSNOIND, CN, CT, AXIND, FORCEN, FORCET, AOA, AOA75, RADIUS, CLCD, GAMMA, VSAMPLE, VROTATIONAL, LENGTH;
 
+    // only the selected blade channels are evaluated, the others remain empty vectors
+    const bool *stored = m_bStoreBladeAeroVariable.constData();
+    const int numBlades = m_QTurbine->m_numBlades;
+
     float TSR = m_QTurbine->m_CurrentOmega *m_QTurbine->m_Blade->m_MaxRadius / m_QTurbine->getFreeStream(m_QTurbine->m_hubCoordsFixed.Origin ).VAbs();
     if (m_QTurbine->getFreeStream(m_QTurbine->m_hubCoordsFixed.Origin ).VAbs() == 0) TSR = 0;
 
@@ -776,6 +945,7 @@ void QTurbineResults::calcVAWTResults(){
     if (m_QTurbine->m_QSim) if (m_QTurbine->m_QSim->m_bStoreAeroBladeData){
 
         QVector<float> dummy;
+        dummy.reserve(m_QTurbine->m_BladePanel.size() / m_QTurbine->m_numBlades);
         for (int m=0;m<m_QTurbine->m_numBlades;m++){
             CL.append(dummy);
             CD.append(dummy);
@@ -834,31 +1004,32 @@ void QTurbineResults::calcVAWTResults(){
 
 
         if (m_QTurbine->m_QSim) if (m_QTurbine->m_QSim->m_bStoreAeroBladeData){
-            double REY = m_QTurbine->m_BladePanel[k]->chord * m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs()/m_QTurbine->m_kinematicViscosity;
-            CL[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_CL);
-            CD[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_CD);
-            VABS[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs());
-            VABSNOIND[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(Vec3(m_QTurbine->m_BladePanel[k]->m_V_total-m_QTurbine->m_BladePanel[k]->m_V_induced).dot(m_QTurbine->m_BladePanel[k]->a1), Vec3(m_QTurbine->m_BladePanel[k]->m_V_total-m_QTurbine->m_BladePanel[k]->m_V_induced).dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            VSAMPLE[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_sampled.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_sampled.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            VROTATIONAL[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_relative.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_relative.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            VIND[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_induced.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_induced.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            VTOWER[m_QTurbine->m_BladePanel[k]->fromBlade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_tower.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_tower.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
-            CN[m_QTurbine->m_BladePanel[k]->fromBlade].append(Cn);
-            CT[m_QTurbine->m_BladePanel[k]->fromBlade].append(Ct);
-            FORCEN[m_QTurbine->m_BladePanel[k]->fromBlade].append(Cn * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
-            FORCET[m_QTurbine->m_BladePanel[k]->fromBlade].append(Ct * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
-            AOA[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_AoA);
-            AOA75[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_AoA75);
-            RADIUS[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->fromBladelength);
-            LENGTH[m_QTurbine->m_BladePanel[k]->fromBlade].append((m_QTurbine->m_BladePanel[k]->relativeLengthA+m_QTurbine->m_BladePanel[k]->relativeLengthB)/2.0);
-            RE[m_QTurbine->m_BladePanel[k]->fromBlade].append(REY);
-            double axind = 1 - InflowNorm.dot(m_QTurbine->m_BladePanel[k]->m_V_induced+m_QTurbine->m_BladePanel[k]->m_V_sampled) / InflowNorm.dot(m_QTurbine->m_BladePanel[k]->m_V_sampled);
-            AXIND[m_QTurbine->m_BladePanel[k]->fromBlade].append(axind);
-            CLCD[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_CL/m_QTurbine->m_BladePanel[k]->m_CD);
-            if (m_QTurbine->m_bisReversed) GAMMA[m_QTurbine->m_BladePanel[k]->fromBlade].append(-m_QTurbine->m_BladePanel[k]->m_Gamma);
-            else GAMMA[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_Gamma);
-            CM[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->m_CM);
-            PITCHMOM[m_QTurbine->m_BladePanel[k]->fromBlade].append(m_QTurbine->m_BladePanel[k]->PitchMomentPerLength);
+            const int blade = m_QTurbine->m_BladePanel[k]->fromBlade;
+            if (stored[BLADE_CL*numBlades+blade]) CL[blade].append(m_QTurbine->m_BladePanel[k]->m_CL);
+            if (stored[BLADE_CD*numBlades+blade]) CD[blade].append(m_QTurbine->m_BladePanel[k]->m_CD);
+            if (stored[VBLADE_VABS*numBlades+blade]) VABS[blade].append(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs());
+            if (stored[VBLADE_VABSNOIND*numBlades+blade]) VABSNOIND[blade].append(Vec3(Vec3(m_QTurbine->m_BladePanel[k]->m_V_total-m_QTurbine->m_BladePanel[k]->m_V_induced).dot(m_QTurbine->m_BladePanel[k]->a1), Vec3(m_QTurbine->m_BladePanel[k]->m_V_total-m_QTurbine->m_BladePanel[k]->m_V_induced).dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[VBLADE_VSAMPLE*numBlades+blade]) VSAMPLE[blade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_sampled.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_sampled.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[VBLADE_VROTATIONAL*numBlades+blade]) VROTATIONAL[blade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_relative.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_relative.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[VBLADE_VIND*numBlades+blade]) VIND[blade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_induced.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_induced.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[VBLADE_VTOWER*numBlades+blade]) VTOWER[blade].append(Vec3(m_QTurbine->m_BladePanel[k]->m_V_tower.dot(m_QTurbine->m_BladePanel[k]->a1), m_QTurbine->m_BladePanel[k]->m_V_tower.dot(m_QTurbine->m_BladePanel[k]->a3), 0).VAbs());
+            if (stored[VBLADE_CN*numBlades+blade]) CN[blade].append(Cn);
+            if (stored[VBLADE_CT*numBlades+blade]) CT[blade].append(Ct);
+            if (stored[VBLADE_FORCEN*numBlades+blade]) FORCEN[blade].append(Cn * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
+            if (stored[VBLADE_FORCET*numBlades+blade]) FORCET[blade].append(Ct * pow(m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs(), 2) * m_QTurbine->m_BladePanel[k]->chord * 0.5 * m_QTurbine->m_fluidDensity);
+            if (stored[BLADE_AOA*numBlades+blade]) AOA[blade].append(m_QTurbine->m_BladePanel[k]->m_AoA);
+            if (stored[BLADE_AOA75*numBlades+blade]) AOA75[blade].append(m_QTurbine->m_BladePanel[k]->m_AoA75);
+            if (stored[BLADE_RADIUS*numBlades+blade]) RADIUS[blade].append(m_QTurbine->m_BladePanel[k]->fromBladelength);
+            if (stored[BLADE_LENGTH*numBlades+blade]) LENGTH[blade].append((m_QTurbine->m_BladePanel[k]->relativeLengthA+m_QTurbine->m_BladePanel[k]->relativeLengthB)/2.0);
+            if (stored[VBLADE_RE*numBlades+blade]) RE[blade].append(m_QTurbine->m_BladePanel[k]->chord*m_QTurbine->m_BladePanel[k]->m_V_inPlane.VAbs()/m_QTurbine->m_kinematicViscosity);
+            if (stored[VBLADE_AXIND*numBlades+blade]){
+                double axind = 1 - InflowNorm.dot(m_QTurbine->m_BladePanel[k]->m_V_induced+m_QTurbine->m_BladePanel[k]->m_V_sampled) / InflowNorm.dot(m_QTurbine->m_BladePanel[k]->m_V_sampled);
+                AXIND[blade].append(axind);
+            }
+            if (stored[BLADE_CLCD*numBlades+blade]) CLCD[blade].append(m_QTurbine->m_BladePanel[k]->m_CL/m_QTurbine->m_BladePanel[k]->m_CD);
+            if (stored[BLADE_GAMMA*numBlades+blade]) GAMMA[blade].append(m_QTurbine->m_bisReversed ? -m_QTurbine->m_BladePanel[k]->m_Gamma : m_QTurbine->m_BladePanel[k]->m_Gamma);
+            if (stored[BLADE_CM*numBlades+blade]) CM[blade].append(m_QTurbine->m_BladePanel[k]->m_CM);
+            if (stored[VBLADE_PITCHMOM*numBlades+blade]) PITCHMOM[blade].append(m_QTurbine->m_BladePanel[k]->PitchMomentPerLength);
         }
     }
 
@@ -1040,6 +1211,7 @@ void QTurbineResults::calcVAWTResults(){
     m_RotorAeroData[k++].append(pow(m_QTurbine->m_maxFilamentCoreSize,0.5));
 
     m_RotorAeroData[k++].append(m_QTurbine->m_iterations);
+    m_RotorAeroData[k++].append(m_QTurbine->m_gammaIterationTime);
     m_RotorAeroData[k++].append(m_QTurbine->m_WakeParticles.size());
     m_RotorAeroData[k++].append(m_QTurbine->m_WakeLine.size());
     m_RotorAeroData[k++].append(m_QTurbine->m_WakeNode.size());
@@ -1063,9 +1235,11 @@ void QTurbineResults::calcControllerResults(){
 }
 
 float QTurbineResults::BladeOutputAtSection(QVector<float> output, double section){
-    //radius at (6)
+    //radius (or height) channel group
+    decodeBladeAeroData();
     if (!m_BladeAeroData.size()) return -1;
-    QVector<float> positions = m_BladeAeroData.at(0).at(7*m_QTurbine->m_numBlades);
+    QVector<float> positions = m_BladeAeroData.at(0).at(BLADE_RADIUS*m_QTurbine->m_numBlades);
+    if (output.size() != positions.size()) return -1; // channel not stored
     double radius = m_QTurbine->m_Blade->getRotorRadius()*section;
     if (radius <= positions.at(0)) return output.at(0);
     else if (radius >= positions.at(positions.size()-1)) return output.at(positions.size()-1);
@@ -1081,6 +1255,8 @@ float QTurbineResults::BladeOutputAtSection(QVector<float> output, double sectio
 
 QVector<double> QTurbineResults::BladeOutputAtTime(double time, int index){
 
+    decodeBladeAeroData();
+
     QVector<double> result;
 
     for (int i=0;i<m_TimeArray.size()-1;i++){
@@ -1098,36 +1274,49 @@ QVector<double> QTurbineResults::BladeOutputAtTime(double time, int index){
 void QTurbineResults::GetCombinedVariableNamesAndData(QStringList &combinedVariables,QVector<QVector<float>> &combinedResults,bool isAero, bool isBlade,
                                      bool isStruct, bool isHydro, bool isControl){
 
+    decodeBladeAeroData();
+
+    // the time series channels are implicitly shared, only the blade data needs to be transposed into time series;
+    // duplicate names are skipped with a hash lookup instead of searching the growing list
+
+    QSet<QString> names;
+    for (int i=0;i<combinedVariables.size();i++) names.insert(combinedVariables.at(i));
 
     if (isStruct)
         for (int i = 0;i<m_availableRotorStructVariables.size();i++)
-            if (!combinedVariables.contains(m_availableRotorStructVariables.at(i))){
+            if (!names.contains(m_availableRotorStructVariables.at(i))){
+                names.insert(m_availableRotorStructVariables.at(i));
                 combinedVariables.append(m_availableRotorStructVariables.at(i));
                 combinedResults.append(m_TurbineStructData.at(i));
             }
 
     if (isAero)
         for (int i = 0;i<m_RotorAeroData.size();i++)
-            if (!combinedVariables.contains(m_availableRotorAeroVariables.at(i))){
+            if (!names.contains(m_availableRotorAeroVariables.at(i))){
+                names.insert(m_availableRotorAeroVariables.at(i));
                 combinedVariables.append(m_availableRotorAeroVariables.at(i));
                 combinedResults.append(m_RotorAeroData.at(i));
             }
 
     if (isBlade) if (m_BladeAeroData.size()){
         for (int i = 0;i<m_BladeAeroData.at(0).size();i++){
+
+            const int pos = m_availableBladeAeroVariables.at(i).lastIndexOf("[");
+            const QString prefix = m_availableBladeAeroVariables.at(i).left(pos) + "PAN ";
+            const QString suffix = " " + m_availableBladeAeroVariables.at(i).mid(pos);
+
             for (int j=0;j<m_BladeAeroData.at(0).at(i).size();j++){
 
-                int pos = QString(m_availableBladeAeroVariables.at(i)).lastIndexOf("[");
-                QString varName = QString(m_availableBladeAeroVariables.at(i));
-                varName.insert(pos,"PAN "+QString().number(j,'f',0)+" ");
+                QString varName = prefix + QString().number(j,'f',0) + suffix;
 
-                if (!combinedVariables.contains(varName)){
+                if (!names.contains(varName)){
 
+                    names.insert(varName);
                     combinedVariables.append(varName);
 
-                    QVector<float> data;
+                    QVector<float> data(m_BladeAeroData.size());
                     for (int k=0;k<m_BladeAeroData.size();k++){
-                        data.append(m_BladeAeroData.at(k).at(i).at(j));
+                        data[k] = m_BladeAeroData.at(k).at(i).at(j);
                     }
                     combinedResults.append(data);
                 }
@@ -1137,14 +1326,16 @@ void QTurbineResults::GetCombinedVariableNamesAndData(QStringList &combinedVaria
 
     if (isHydro)
         for (int i = 0;i<m_HydroData.size();i++)
-            if (!combinedVariables.contains(m_availableHydroVariables.at(i))){
+            if (!names.contains(m_availableHydroVariables.at(i))){
+                names.insert(m_availableHydroVariables.at(i));
                 combinedVariables.append(m_availableHydroVariables.at(i));
                 combinedResults.append(m_HydroData.at(i));
             }
 
     if (isControl)
         for (int i = 0;i<m_ControllerData.size();i++)
-            if (!combinedVariables.contains(m_availableControllerVariables.at(i))){
+            if (!names.contains(m_availableControllerVariables.at(i))){
+                names.insert(m_availableControllerVariables.at(i));
                 combinedVariables.append(m_availableControllerVariables.at(i));
                 combinedResults.append(m_ControllerData.at(i));
             }
@@ -1155,6 +1346,8 @@ void QTurbineResults::GetCombinedVariableNamesAndData(QStringList &combinedVaria
 void QTurbineResults::GetCombinedVariableNames
 (QStringList &combinedVariables, bool isAero, bool isBlade, bool isStruct, bool isHydro, bool isControl){
 
+    decodeBladeAeroData();
+
     if (isStruct) for (int i = 0;i<m_availableRotorStructVariables.size();i++) combinedVariables.append(m_availableRotorStructVariables.at(i));
     if (isAero) for (int i = 0;i<m_RotorAeroData.size();i++) combinedVariables.append(m_availableRotorAeroVariables.at(i));
 
@@ -1174,26 +1367,35 @@ void QTurbineResults::GetCombinedVariableNames
 
 void QTurbineResults::CreateCombinedGraphData(){
 
+    // the graphs access the stored channels through pointers, no data is copied
+
+    QSet<QString> names;
+    for (int i=0;i<m_availableCombinedVariables.size();i++) names.insert(m_availableCombinedVariables.at(i));
+
     for (int i = 0;i<m_availableRotorStructVariables.size();i++)
-        if (!m_availableCombinedVariables.contains(m_availableRotorStructVariables.at(i))){
+        if (!names.contains(m_availableRotorStructVariables.at(i))){
+            names.insert(m_availableRotorStructVariables.at(i));
             m_availableCombinedVariables.append(m_availableRotorStructVariables.at(i));
             m_AllData.append(&m_TurbineStructData[i]);
         }
 
     for (int i = 0;i<m_RotorAeroData.size();i++)
-        if (!m_availableCombinedVariables.contains(m_availableRotorAeroVariables.at(i))){
+        if (!names.contains(m_availableRotorAeroVariables.at(i))){
+            names.insert(m_availableRotorAeroVariables.at(i));
             m_availableCombinedVariables.append(m_availableRotorAeroVariables.at(i));
             m_AllData.append(&m_RotorAeroData[i]);
         }
 
     for (int i = 0;i<m_HydroData.size();i++)
-        if (!m_availableCombinedVariables.contains(m_availableHydroVariables.at(i))){
+        if (!names.contains(m_availableHydroVariables.at(i))){
+            names.insert(m_availableHydroVariables.at(i));
             m_availableCombinedVariables.append(m_availableHydroVariables.at(i));
             m_AllData.append(&m_HydroData[i]);
         }
 
     for (int i = 0;i<m_ControllerData.size();i++)
-        if (!m_availableCombinedVariables.contains(m_availableControllerVariables.at(i))){
+        if (!names.contains(m_availableControllerVariables.at(i))){
+            names.insert(m_availableControllerVariables.at(i));
             m_availableCombinedVariables.append(m_availableControllerVariables.at(i));
             m_AllData.append(&m_ControllerData[i]);
         }
@@ -1226,15 +1428,17 @@ void QTurbineResults::GetCombinedEnsembleVariableNamesAndData(QStringList &combi
 void QTurbineResults::GetCombinedVariableData
 (QVector<QVector<float>> &combinedResults, bool isAero, bool isBlade, bool isStruct, bool isHydro, bool isControl){
 
+    decodeBladeAeroData();
+
     if (isStruct) for (int i = 0;i<m_TurbineStructData.size();i++) combinedResults.append(m_TurbineStructData.at(i));
     if (isAero) for (int i = 0;i<m_RotorAeroData.size();i++) combinedResults.append(m_RotorAeroData.at(i));
 
     if (isBlade) if (m_BladeAeroData.size()){
         for (int i=0;i<m_BladeAeroData.at(0).size();i++){
             for (int j=0;j<m_BladeAeroData.at(0).at(i).size();j++){
-                QVector<float> data;
+                QVector<float> data(m_BladeAeroData.size());
                 for (int k=0;k<m_BladeAeroData.size();k++){
-                    data.append(m_BladeAeroData.at(k).at(i).at(j));
+                    data[k] = m_BladeAeroData.at(k).at(i).at(j);
                 }
                 combinedResults.append(data);
             }
@@ -20,9 +20,20 @@
 
 #include <QStringList>
 #include <QVector>
+#include <QByteArray>
+#include <QMutex>
 
 class QTurbine;
 
+// order of the blade channel groups in m_BladeAeroData, every group holds one channel per blade; the
+// groups up to BLADE_LENGTH are the same for HAWT and VAWT, BLADE_RADIUS is the height for a VAWT
+enum BladeChannelHAWT {BLADE_CL, BLADE_CD, BLADE_CM, BLADE_CLCD, BLADE_GAMMA, BLADE_AOA, BLADE_AOA75, BLADE_RADIUS, BLADE_LENGTH,
+                       BLADE_CN, BLADE_CT, BLADE_CR, BLADE_FORCEN, BLADE_FORCET, BLADE_FORCER, BLADE_PITCHMOM, BLADE_VABS,
+                       BLADE_VABSNOIND, BLADE_VSAMPLE, BLADE_VROTATIONAL, BLADE_VIND, BLADE_VTOWER, BLADE_AXIND, BLADE_TANIND,
+                       BLADE_RADIND, BLADE_RE};
+enum BladeChannelVAWT {VBLADE_CN = BLADE_CN, VBLADE_CT, VBLADE_FORCEN, VBLADE_FORCET, VBLADE_PITCHMOM, VBLADE_VABS, VBLADE_VABSNOIND,
+                       VBLADE_VSAMPLE, VBLADE_VROTATIONAL, VBLADE_VIND, VBLADE_VTOWER, VBLADE_AXIND, VBLADE_RE};
+
 class QTurbineResults
 {
 public:
@@ -34,10 +45,15 @@ public:
     void initializeControllerOutputVectors();
 
     void calcResults();
+    void reserveOutputVectors();
+    void trimOutputVectors(int numSteps);
+    void initializeBladeOutputSelection();
+    QStringList removeUnselectedBladeVariables(const QStringList &variables, int bladeOffset);
     void calcHAWTResults();
     void calcVAWTResults();
     void calcControllerResults();
     void ClearOutputArrays();
+    void decodeBladeAeroData();
     void CreateCombinedGraphData();
     float BladeOutputAtSection(QVector<float> output, double section);
     QVector<double> BladeOutputAtTime(double time, int index);
@@ -66,8 +82,11 @@ public:
 
     QVector< QVector <float> > m_RotorAeroData;
     QVector<QVector<QVector<float> > > m_BladeAeroData;
+    QVector<QByteArray> m_BladeAeroBlocks;   // compressed blade data of a loaded project, decoded on first access
+    QMutex m_bladeAeroMutex;
     QStringList m_availableRotorAeroVariables;
     QStringList m_availableBladeAeroVariables;
+    QVector<bool> m_bStoreBladeAeroVariable; // blade channels selected in QSimulation::m_bladeOutputChannels, not serialized
 
     QVector< QVector <float> > m_TurbineStructData;
     QStringList m_availableRotorStructVariables;
@@ -28,6 +28,9 @@
 #include "src/QSimulation/QVelocityCutPlane.h"
 #include "src/IceThrowSimulation/IceThrowSimulation.h"
 #include "src/Store.h"
+#include "src/VPML/Vortex_Treecode.h"
+#include "src/VortexObjects/BiotSavartKernels.h"
+#include <QSet>
 #include "CL/cl.cpp"
 
 QTurbineSimulationData::QTurbineSimulationData(QTurbine *turb)
@@ -39,6 +42,7 @@ QTurbineSimulationData::QTurbineSimulationData(QTurbine *turb)
     m_DemandedGeneratorTorque = 0;
     m_BrakeModulation = 0;
     m_turbineController = NULL;
+    m_gammaIterationTime = 0;
 }
 
 void QTurbineSimulationData::serialize() {
@@ -495,6 +499,11 @@ void QTurbineSimulationData::ClearSimulationArrays(){
 
     m_savedIceParticlesLanded.clear();
     m_savedIceParticlesFlying.clear();
+
+    // the pool chunks that held only the wake of this simulation are returned to the OS
+    VortexPool<VortexNode>::ReleaseUnusedChunks();
+    VortexPool<VortexLine>::ReleaseUnusedChunks();
+    VortexPool<VortexParticle>::ReleaseUnusedChunks();
 }
 
 
@@ -2128,6 +2137,37 @@ void QTurbineSimulationData::InitializePanelPositions(){
     m_QTurbine->m_bGlChanged = true;
 }
 
+template <typename T>
+static void trimReplayList(QList<T> &list, int numSteps){
+
+    // the last entry is the current geometry that is rendered, it is never removed
+    const int num = std::min(numSteps, list.size()-1);
+    if (num > 0) list.erase(list.begin(), list.begin()+num);
+}
+
+void QTurbineSimulationData::trimReplayData(int numSteps){
+
+    // removes the oldest replay timesteps, used by the rolling window of the result stream to keep the replay
+    // aligned with the trimmed time series
+
+    trimReplayList(m_savedWakeLines, numSteps);
+    trimReplayList(m_savedBladeVortexLines, numSteps);
+    trimReplayList(m_savedWakeParticles, numSteps);
+    trimReplayList(m_savedIceParticlesLanded, numSteps);
+    trimReplayList(m_savedIceParticlesFlying, numSteps);
+    trimReplayList(m_savedAeroLoads, numSteps);
+    trimReplayList(m_QTurbine->m_savedBladeVizPanels, numSteps);
+    trimReplayList(m_QTurbine->m_savedTowerCoordinates, numSteps);
+    trimReplayList(m_QTurbine->m_savedTorquetubeCoordinates, numSteps);
+    trimReplayList(m_QTurbine->m_savedHubCoords, numSteps);
+    trimReplayList(m_QTurbine->m_savedHubCoordsFixed, numSteps);
+
+    if (m_QTurbine->m_StrModel){
+        trimReplayList(m_QTurbine->m_StrModel->vizBeams, numSteps);
+        trimReplayList(m_QTurbine->m_StrModel->vizNodes, numSteps);
+    }
+}
+
 void QTurbineSimulationData::storeGeometry(bool storeReplay){
 
     if (debugTurbine) qDebug() << "QTurbine: Storing Geometry";
@@ -2519,6 +2559,79 @@ Vec3 QTurbineSimulationData::getFreeStream (Vec3 EvalPt, double time) {
     return Vec3(0,0,0);
 }
 
+void QTurbineSimulationData::getFreeStream (QVector<Vec3> const &EvalPts, QVector<Vec3> &V_free, double time) {
+
+    // batched getFreeStream(), the boundary conditions, the field time of the wind field and the inflow
+    // rotations are evaluated once for all points; the results are identical to the pointwise evaluation
+
+    const int num = EvalPts.size();
+    V_free.resize(num);
+
+    if (!m_QSim){
+        for (int i=0;i<num;i++) V_free[i] = Vec3(m_steadyBEMVelocity,0,0);
+        return;
+    }
+
+    if (time == -1) time = m_currentTime;
+    else m_QSim->setBoundaryConditions(time);
+
+    QVector<Vec3> points(EvalPts);
+    for (int i=0;i<num;i++) if (points[i].z < 0) points[i].z = 0;
+
+    // the horizontal offset of the directional shear is the only point dependent part of the rotations
+
+    const bool constantRotation = (m_QSim->m_directionalShearGradient == 0);
+    const double cosZ = cos(m_QSim->m_horizontalInflowAngle/180*PI_), sinZ = sin(m_QSim->m_horizontalInflowAngle/180*PI_);
+
+    if (m_QSim->m_windInputType == WINDFIELD && m_QSim->m_Windfield){
+
+        // rotor coordinates need to be transformed!!!!!! (instead of transforming windfield for skewed inflow)
+        const double angleIn = -(m_QSim->m_horizontalInflowAngle)/180*PI_;
+        const double cosIn = cos(angleIn), sinIn = sin(angleIn);
+        QVector<Vec3> rotated(num);
+        for (int i=0;i<num;i++) rotated[i] = Vec3(points.at(i).x*cosIn - points.at(i).y*sinIn, points.at(i).x*sinIn + points.at(i).y*cosIn, points.at(i).z);
+
+        m_QSim->m_Windfield->getWindspeeds(rotated, V_free, time, m_QSim->m_bMirrorWindfield, m_QSim->m_bisWindAutoShift, m_QSim->m_windShiftTime);
+
+    } else if (m_QSim->m_windInputType == UNIFORM){
+
+        const double cosY = cos(-m_QSim->m_verticalInflowAngle/180*PI_), sinY = sin(-m_QSim->m_verticalInflowAngle/180*PI_);
+        const double logRef = log(m_QSim->m_referenceHeight/m_QSim->m_roughnessLength);
+
+        for (int i=0;i<num;i++){
+            double Vx;
+            if (m_QSim->m_windProfileType == POWERLAW) Vx = m_QSim->m_horizontalWindspeed*pow(points.at(i).z/m_QSim->m_referenceHeight,m_QSim->m_powerLawShearExponent);
+            else Vx = m_QSim->m_horizontalWindspeed*log(points.at(i).z/m_QSim->m_roughnessLength)/logRef;
+            V_free[i] = Vec3(Vx*cosY + 0*sinY, 0, -Vx*sinY + 0*cosY);
+        }
+    }
+    else if (m_QSim->m_windInputType == HUBHEIGHT){
+        double radius;
+        if (m_QTurbine->m_bisVAWT) radius = m_QTurbine->m_Blade->m_MaxRadius;
+        else  radius = m_QTurbine->m_Blade->getRotorRadius();
+
+        for (int i=0;i<num;i++){
+            const Vec3 &EvalPt = points.at(i);
+            V_free[i].x = (EvalPt.y-m_QTurbine->m_hubCoordsFixed.Origin.y)/radius*m_QSim->m_horizontalHHWindspeed*m_QSim->m_linearHorizontalHHShear/2 + (EvalPt.z-m_QTurbine->m_hubCoordsFixed.Origin.z)/radius*m_QSim->m_horizontalHHWindspeed*m_QSim->m_linearVerticalHHShear/2 + m_QSim->m_horizontalHHWindspeed * pow((EvalPt.z/m_QSim->m_referenceHeight),m_QSim->m_verticalHHShear)+m_QSim->m_gustHHSpeed;
+            V_free[i].y = 0;
+            V_free[i].z = m_QSim->m_verticalHHWindspeed;
+        }
+    }
+    else{
+        for (int i=0;i<num;i++) V_free[i] = Vec3(0,0,0);
+        return;
+    }
+
+    for (int i=0;i<num;i++){
+        if (constantRotation){
+            const double x = V_free.at(i).x, y = V_free.at(i).y;
+            V_free[i].x = x * cosZ - y * sinZ;
+            V_free[i].y = x * sinZ + y * cosZ;
+        }
+        else V_free[i].RotZ((m_QSim->m_horizontalInflowAngle+(points.at(i).z-m_QSim->m_referenceHeight)*m_QSim->m_directionalShearGradient)/180*PI_);
+    }
+}
+
 Vec3 QTurbineSimulationData::getFreeStreamAcceleration (Vec3 EvalPt, double time) {
 
     double dt = m_dT;
@@ -2655,24 +2768,31 @@ void QTurbineSimulationData::truncateWake(){
         }
     }
 
-    for (int i=m_WakeParticles.size()-1;i>=0;i--){
+    // the lists are compacted in a single pass instead of removing the elements one by one
+
+    int count = 0;
+    for (int i=0;i<m_WakeParticles.size();i++){
         float dist = powf(powf(m_WakeParticles[i]->position.x-m_hubCoordsFixed.Origin.x,2)+powf(m_WakeParticles[i]->position.y-m_hubCoordsFixed.Origin.y,2)+powf(m_WakeParticles[i]->position.z-m_hubCoordsFixed.Origin.z,2),0.5);
-        if (dist / max > m_QTurbine->m_maxWakeDistance){
-            delete m_WakeParticles[i];
-            m_WakeParticles.removeAt(i);
-        }
+        if (dist / max > m_QTurbine->m_maxWakeDistance) delete m_WakeParticles[i];
+        else m_WakeParticles[count++] = m_WakeParticles[i];
     }
+    m_WakeParticles.erase(m_WakeParticles.begin()+count,m_WakeParticles.end());
 
-    while (m_WakeParticles.size()+m_WakeLine.size() > m_QTurbine->m_wakeSizeHardcap && m_WakeParticles.size()){
-        delete m_WakeParticles[0];
-        m_WakeParticles.removeAt(0);
+    int excess = m_WakeParticles.size()+m_WakeLine.size()-m_QTurbine->m_wakeSizeHardcap;
+    if (excess > 0 && m_WakeParticles.size()){
+        const int num = std::min(excess,m_WakeParticles.size());
+        for (int i=0;i<num;i++) delete m_WakeParticles[i];
+        m_WakeParticles.erase(m_WakeParticles.begin(),m_WakeParticles.begin()+num);
     }
 
-
-    while (m_WakeLine.size()+m_WakeParticles.size() > m_QTurbine->m_wakeSizeHardcap && m_WakeLine.size()){
-        m_WakeLine.at(0)->DisconnectFromWake();
-        delete m_WakeLine[0];
-        m_WakeLine.removeFirst();
+    excess = m_WakeLine.size()+m_WakeParticles.size()-m_QTurbine->m_wakeSizeHardcap;
+    if (excess > 0 && m_WakeLine.size()){
+        const int num = std::min(excess,m_WakeLine.size());
+        for (int i=0;i<num;i++){
+            m_WakeLine.at(i)->DisconnectFromWake();
+            delete m_WakeLine[i];
+        }
+        m_WakeLine.erase(m_WakeLine.begin(),m_WakeLine.begin()+num);
     }
 
     if (debugTurbine) qDebug() << "QTurbine: End Truncate Wake";
@@ -2777,28 +2897,39 @@ void QTurbineSimulationData::reduceWake(){
 
 void QTurbineSimulationData::cleanupWake(){
 
-    for (int i=m_WakeNode.size()-1;i>=0;i--){
-        if (!m_WakeNode.at(i)->hasLines() && m_WakeNode.at(i)->fromTimestep != m_currentTimeStep && m_WakeNode.at(i)->fromTimestep != (m_currentTimeStep-m_QTurbine->m_nthWakeStep)){
+    // the lists are compacted in a single pass instead of removing the elements one by one
+
+    int count = 0;
+    for (int i=0;i<m_WakeNode.size();i++){
+        if (!m_WakeNode.at(i)->hasLines() && m_WakeNode.at(i)->fromTimestep != m_currentTimeStep && m_WakeNode.at(i)->fromTimestep != (m_currentTimeStep-m_QTurbine->m_nthWakeStep))
             delete m_WakeNode.at(i);
-            m_WakeNode.removeAt(i);
-        }
+        else
+            m_WakeNode[count++] = m_WakeNode.at(i);
     }
+    m_WakeNode.erase(m_WakeNode.begin()+count,m_WakeNode.end());
 
-    for (int i=m_WakeLine.size()-1;i>=0;i--){
-        if (!m_WakeLine.at(i)->hasNodes()){
+    QSet<VortexLine *> removedLines;
+
+    count = 0;
+    for (int i=0;i<m_WakeLine.size();i++){
+        if (!m_WakeLine.at(i)->hasNodes())
+            removedLines.insert(m_WakeLine.at(i));
+        else
+            m_WakeLine[count++] = m_WakeLine.at(i);
+    }
+    m_WakeLine.erase(m_WakeLine.begin()+count,m_WakeLine.end());
 
-            for (int j=m_NewShedWakeLines.size()-1; j>=0;j--)
-                if (m_NewShedWakeLines.at(j) == m_WakeLine.at(i))
-                    m_NewShedWakeLines.removeAt(j);
+    if (!removedLines.size()) return;
 
-            for (int j=m_NewTrailingWakeLines.size()-1; j>=0;j--)
-                if (m_NewTrailingWakeLines.at(j) == m_WakeLine.at(i))
-                    m_NewTrailingWakeLines.removeAt(j);
+    for (int j=m_NewShedWakeLines.size()-1; j>=0;j--)
+        if (removedLines.contains(m_NewShedWakeLines.at(j)))
+            m_NewShedWakeLines.removeAt(j);
 
-            delete m_WakeLine.at(i);
-            m_WakeLine.removeAt(i);
-        }
-    }
+    for (int j=m_NewTrailingWakeLines.size()-1; j>=0;j--)
+        if (removedLines.contains(m_NewTrailingWakeLines.at(j)))
+            m_NewTrailingWakeLines.removeAt(j);
+
+    for (VortexLine *line : removedLines) delete line;
 }
 
 void QTurbineSimulationData::addNewWake(){
@@ -3019,6 +3150,8 @@ void QTurbineSimulationData::calculateWakeRatesOfChange(){
     QList<Vec3> positions, velocities;
     fillWakePositionAndVelocityLists(&positions,&velocities);
 
+    packWakeArrays();
+
     bool includeBladeInduction = true;
 
     if (m_QTurbine->m_bWakeRollup){
@@ -3026,7 +3159,8 @@ void QTurbineSimulationData::calculateWakeRatesOfChange(){
             wakeLineInductionOpenCL(&positions,&velocities,true,includeBladeInduction);
         }
         else{
-            if (m_QSim->m_bisOpenMp) wakeInductionOpenMP(&positions,&velocities);
+            if (m_QSim->m_bisTreecode) wakeInductionTreecode(&positions,&velocities);
+            else if (m_QSim->m_bisOpenMp) wakeInductionOpenMP(&positions,&velocities);
             else wakeInductionSingleCore(&positions,&velocities);
             if (includeBladeInduction) addBladeInductionVelocities(&positions,&velocities);
         }
@@ -3039,6 +3173,23 @@ void QTurbineSimulationData::calculateWakeRatesOfChange(){
 
     storeRatesOfChange();
 
+    m_WakeLineArrays.Invalidate();
+    m_WakeParticleArrays.Invalidate();
+
+}
+
+void QTurbineSimulationData::packWakeArrays(){
+
+    // packs the current wake lines and particles into m_WakeLineArrays and m_WakeParticleArrays, must be invalidated once the wake is modified
+
+    if (m_QSim->isWakeInteraction()){
+        m_WakeLineArrays.Pack(&m_QSim->m_globalWakeLine,m_currentTimeStep);
+        m_WakeParticleArrays.Pack(&m_QSim->m_globalWakeParticle);
+    }
+    else{
+        m_WakeLineArrays.Pack(&m_WakeLine,m_currentTimeStep);
+        m_WakeParticleArrays.Pack(&m_WakeParticles);
+    }
 }
 
 void QTurbineSimulationData::performWakeCorrectionStep(){
@@ -3270,7 +3421,22 @@ void QTurbineSimulationData::wakeLineInductionOpenCL(QList<Vec3> *positions, QLi
 
     int num_pos = positions->size();
 
-        int num_elems = lines->size();
+        // the wake lines are taken from the packed arrays, their float4 records are copied as a block
+
+        static_assert(sizeof(VortexLineFloat4) == sizeof(cl_float4), "VortexLineFloat4 must match the cl_float4 layout");
+
+        int num_lines = 0;
+        bool packedHere = false;
+
+        if (includeWake){
+            if (!m_WakeLineArrays.IsPackedFrom(lines)){
+                m_WakeLineArrays.Pack(lines,m_currentTimeStep);
+                packedHere = true;
+            }
+            num_lines = m_WakeLineArrays.size();
+        }
+
+        int num_elems = num_lines;
 
         num_elems += bladePanels->size() * 3;
 
@@ -3278,6 +3444,11 @@ void QTurbineSimulationData::wakeLineInductionOpenCL(QList<Vec3> *positions, QLi
 
         if (m_QSim->m_bincludeGround) num_elems *= 2;
 
+        if (!num_elems){
+            if (packedHere) m_WakeLineArrays.Invalidate();
+            return;
+        }
+
         cl_float3 *Positions = new cl_float3[num_pos];
         cl_float3 *InducedVelocities = new cl_float3[num_pos];
         cl_float4 *Vort1 = new cl_float4[num_elems];
@@ -3290,84 +3461,74 @@ void QTurbineSimulationData::wakeLineInductionOpenCL(QList<Vec3> *positions, QLi
             Positions[i].z = positions->at(i).z;
         }
 
-        for (int i=0; i<lines->size();i++){
-            //construction of wake vortex filaments as float4, for the cl_kernel
-            Vort1[i].x = lines->at(i)->pL->x;
-            Vort1[i].y = lines->at(i)->pL->y;
-            Vort1[i].z = lines->at(i)->pL->z;
-
-            Vort2[i].x = lines->at(i)->pT->x;
-            Vort2[i].y = lines->at(i)->pT->y;
-            Vort2[i].z = lines->at(i)->pT->z;
-
-            Vort1[i].w = lines->at(i)->coreSizeSquared;
-            Vort2[i].w = lines->at(i)->GetGamma();
+        if (num_lines){
+            memcpy(Vort1, m_WakeLineArrays.vort1.data(), num_lines*sizeof(cl_float4));
+            memcpy(Vort2, m_WakeLineArrays.vort2.data(), num_lines*sizeof(cl_float4));
         }
 
-
         for (int i=0;i<bladePanels->size();i++){
 
             double coreSizeSquared = pow(bladePanels->at(i)->chord*m_QTurbine->m_coreRadiusChordFractionBound,2);
 
-            Vort1[lines->size()+3*i].x = bladePanels->at(i)->VortPtA.x;
-            Vort1[lines->size()+3*i].y = bladePanels->at(i)->VortPtA.y;
-            Vort1[lines->size()+3*i].z = bladePanels->at(i)->VortPtA.z;
-            Vort2[lines->size()+3*i].x = bladePanels->at(i)->VortPtB.x;
-            Vort2[lines->size()+3*i].y = bladePanels->at(i)->VortPtB.y;
-            Vort2[lines->size()+3*i].z = bladePanels->at(i)->VortPtB.z;
-            Vort1[lines->size()+3*i].w = coreSizeSquared;
-            Vort2[lines->size()+3*i].w = bladePanels->at(i)->m_Gamma;
-
-            Vort1[lines->size()+3*i+1].x = bladePanels->at(i)->pTA->x;
-            Vort1[lines->size()+3*i+1].y = bladePanels->at(i)->pTA->y;
-            Vort1[lines->size()+3*i+1].z = bladePanels->at(i)->pTA->z;
-            Vort2[lines->size()+3*i+1].x = bladePanels->at(i)->VortPtA.x;
-            Vort2[lines->size()+3*i+1].y = bladePanels->at(i)->VortPtA.y;
-            Vort2[lines->size()+3*i+1].z = bladePanels->at(i)->VortPtA.z;
-            Vort1[lines->size()+3*i+1].w = coreSizeSquared;
-            Vort2[lines->size()+3*i+1].w = bladePanels->at(i)->m_Gamma;
-
-            Vort1[lines->size()+3*i+2].x = bladePanels->at(i)->VortPtB.x;
-            Vort1[lines->size()+3*i+2].y = bladePanels->at(i)->VortPtB.y;
-            Vort1[lines->size()+3*i+2].z = bladePanels->at(i)->VortPtB.z;
-            Vort2[lines->size()+3*i+2].x = bladePanels->at(i)->pTB->x;
-            Vort2[lines->size()+3*i+2].y = bladePanels->at(i)->pTB->y;
-            Vort2[lines->size()+3*i+2].z = bladePanels->at(i)->pTB->z;
-            Vort1[lines->size()+3*i+2].w = coreSizeSquared;
-            Vort2[lines->size()+3*i+2].w = bladePanels->at(i)->m_Gamma;
+            Vort1[num_lines+3*i].x = bladePanels->at(i)->VortPtA.x;
+            Vort1[num_lines+3*i].y = bladePanels->at(i)->VortPtA.y;
+            Vort1[num_lines+3*i].z = bladePanels->at(i)->VortPtA.z;
+            Vort2[num_lines+3*i].x = bladePanels->at(i)->VortPtB.x;
+            Vort2[num_lines+3*i].y = bladePanels->at(i)->VortPtB.y;
+            Vort2[num_lines+3*i].z = bladePanels->at(i)->VortPtB.z;
+            Vort1[num_lines+3*i].w = coreSizeSquared;
+            Vort2[num_lines+3*i].w = bladePanels->at(i)->m_Gamma;
+
+            Vort1[num_lines+3*i+1].x = bladePanels->at(i)->pTA->x;
+            Vort1[num_lines+3*i+1].y = bladePanels->at(i)->pTA->y;
+            Vort1[num_lines+3*i+1].z = bladePanels->at(i)->pTA->z;
+            Vort2[num_lines+3*i+1].x = bladePanels->at(i)->VortPtA.x;
+            Vort2[num_lines+3*i+1].y = bladePanels->at(i)->VortPtA.y;
+            Vort2[num_lines+3*i+1].z = bladePanels->at(i)->VortPtA.z;
+            Vort1[num_lines+3*i+1].w = coreSizeSquared;
+            Vort2[num_lines+3*i+1].w = bladePanels->at(i)->m_Gamma;
+
+            Vort1[num_lines+3*i+2].x = bladePanels->at(i)->VortPtB.x;
+            Vort1[num_lines+3*i+2].y = bladePanels->at(i)->VortPtB.y;
+            Vort1[num_lines+3*i+2].z = bladePanels->at(i)->VortPtB.z;
+            Vort2[num_lines+3*i+2].x = bladePanels->at(i)->pTB->x;
+            Vort2[num_lines+3*i+2].y = bladePanels->at(i)->pTB->y;
+            Vort2[num_lines+3*i+2].z = bladePanels->at(i)->pTB->z;
+            Vort1[num_lines+3*i+2].w = coreSizeSquared;
+            Vort2[num_lines+3*i+2].w = bladePanels->at(i)->m_Gamma;
         }
 
         for (int i=0;i<strutPanels->size();i++){
 
             double coreSizeSquared = pow(strutPanels->at(i)->chord*m_QTurbine->m_coreRadiusChordFractionBound,2);
 
-            Vort1[lines->size()+3*bladePanels->size()+3*i].x = strutPanels->at(i)->VortPtA.x;
-            Vort1[lines->size()+3*bladePanels->size()+3*i].y = strutPanels->at(i)->VortPtA.y;
-            Vort1[lines->size()+3*bladePanels->size()+3*i].z = strutPanels->at(i)->VortPtA.z;
-            Vort2[lines->size()+3*bladePanels->size()+3*i].x = strutPanels->at(i)->VortPtB.x;
-            Vort2[lines->size()+3*bladePanels->size()+3*i].y = strutPanels->at(i)->VortPtB.y;
-            Vort2[lines->size()+3*bladePanels->size()+3*i].z = strutPanels->at(i)->VortPtB.z;
-            Vort1[lines->size()+3*bladePanels->size()+3*i].w = coreSizeSquared;
-            Vort2[lines->size()+3*bladePanels->size()+3*i].w = strutPanels->at(i)->m_Gamma;
+            Vort1[num_lines+3*bladePanels->size()+3*i].x = strutPanels->at(i)->VortPtA.x;
+            Vort1[num_lines+3*bladePanels->size()+3*i].y = strutPanels->at(i)->VortPtA.y;
+            Vort1[num_lines+3*bladePanels->size()+3*i].z = strutPanels->at(i)->VortPtA.z;
+            Vort2[num_lines+3*bladePanels->size()+3*i].x = strutPanels->at(i)->VortPtB.x;
+            Vort2[num_lines+3*bladePanels->size()+3*i].y = strutPanels->at(i)->VortPtB.y;
+            Vort2[num_lines+3*bladePanels->size()+3*i].z = strutPanels->at(i)->VortPtB.z;
+            Vort1[num_lines+3*bladePanels->size()+3*i].w = coreSizeSquared;
+            Vort2[num_lines+3*bladePanels->size()+3*i].w = strutPanels->at(i)->m_Gamma;
 
 
-            Vort1[lines->size()+3*bladePanels->size()+3*i+1].x = strutPanels->at(i)->pTA->x;
-            Vort1[lines->size()+3*bladePanels->size()+3*i+1].y = strutPanels->at(i)->pTA->y;
-            Vort1[lines->size()+3*bladePanels->size()+3*i+1].z = strutPanels->at(i)->pTA->z;
-            Vort2[lines->size()+3*bladePanels->size()+3*i+1].x = strutPanels->at(i)->VortPtA.x;
-            Vort2[lines->size()+3*bladePanels->size()+3*i+1].y = strutPanels->at(i)->VortPtA.y;
-            Vort2[lines->size()+3*bladePanels->size()+3*i+1].z = strutPanels->at(i)->VortPtA.z;
-            Vort1[lines->size()+3*bladePanels->size()+3*i+1].w = coreSizeSquared;
-            Vort2[lines->size()+3*bladePanels->size()+3*i+1].w = strutPanels->at(i)->m_Gamma;
+            Vort1[num_lines+3*bladePanels->size()+3*i+1].x = strutPanels->at(i)->pTA->x;
+            Vort1[num_lines+3*bladePanels->size()+3*i+1].y = strutPanels->at(i)->pTA->y;
+            Vort1[num_lines+3*bladePanels->size()+3*i+1].z = strutPanels->at(i)->pTA->z;
+            Vort2[num_lines+3*bladePanels->size()+3*i+1].x = strutPanels->at(i)->VortPtA.x;
+            Vort2[num_lines+3*bladePanels->size()+3*i+1].y = strutPanels->at(i)->VortPtA.y;
+            Vort2[num_lines+3*bladePanels->size()+3*i+1].z = strutPanels->at(i)->VortPtA.z;
+            Vort1[num_lines+3*bladePanels->size()+3*i+1].w = coreSizeSquared;
+            Vort2[num_lines+3*bladePanels->size()+3*i+1].w = strutPanels->at(i)->m_Gamma;
 
-            Vort1[lines->size()+3*bladePanels->size()+3*i+2].x = strutPanels->at(i)->VortPtB.x;
-            Vort1[lines->size()+3*bladePanels->size()+3*i+2].y = strutPanels->at(i)->VortPtB.y;
-            Vort1[lines->size()+3*bladePanels->size()+3*i+2].z = strutPanels->at(i)->VortPtB.z;
-            Vort2[lines->size()+3*bladePanels->size()+3*i+2].x = strutPanels->at(i)->pTB->x;
-            Vort2[lines->size()+3*bladePanels->size()+3*i+2].y = strutPanels->at(i)->pTB->y;
-            Vort2[lines->size()+3*bladePanels->size()+3*i+2].z = strutPanels->at(i)->pTB->z;
-            Vort1[lines->size()+3*bladePanels->size()+3*i+2].w = coreSizeSquared;
-            Vort2[lines->size()+3*bladePanels->size()+3*i+2].w = strutPanels->at(i)->m_Gamma;
+            Vort1[num_lines+3*bladePanels->size()+3*i+2].x = strutPanels->at(i)->VortPtB.x;
+            Vort1[num_lines+3*bladePanels->size()+3*i+2].y = strutPanels->at(i)->VortPtB.y;
+            Vort1[num_lines+3*bladePanels->size()+3*i+2].z = strutPanels->at(i)->VortPtB.z;
+            Vort2[num_lines+3*bladePanels->size()+3*i+2].x = strutPanels->at(i)->pTB->x;
+            Vort2[num_lines+3*bladePanels->size()+3*i+2].y = strutPanels->at(i)->pTB->y;
+            Vort2[num_lines+3*bladePanels->size()+3*i+2].z = strutPanels->at(i)->pTB->z;
+            Vort1[num_lines+3*bladePanels->size()+3*i+2].w = coreSizeSquared;
+            Vort2[num_lines+3*bladePanels->size()+3*i+2].w = strutPanels->at(i)->m_Gamma;
         }
 
 
@@ -3393,6 +3554,8 @@ void QTurbineSimulationData::wakeLineInductionOpenCL(QList<Vec3> *positions, QLi
           velocities->replace(i,vec+induced);
       }
 
+      if (packedHere) m_WakeLineArrays.Invalidate();
+
       delete [] InducedVelocities;
       delete [] Positions;
       delete [] Vort1;
@@ -3419,19 +3582,261 @@ void QTurbineSimulationData::wakeInductionOpenMP(QList<Vec3> *positions, QList<V
 
 }
 
+void QTurbineSimulationData::wakeInductionTreecode(QList<Vec3> *positions, QList<Vec3> *velocities){
+
+    // wake self induction evaluated with a Barnes-Hut treecode; far field clusters are evaluated with a multipole
+    // expansion, near field filaments and particles use the same kernels as calculateWakeInduction()
+
+    if (!m_WakeNode.size() && !m_WakeParticles.size()) return;
+
+    if (debugTurbine) qDebug() << "QTurbine: Wake Induction Treecode";
+
+    QList<VortexLine*> *lines;
+    QList<VortexParticle*> *particles;
+
+    if (m_QSim->isWakeInteraction()){
+        lines = &m_QSim->m_globalWakeLine;
+        particles = &m_QSim->m_globalWakeParticle;
+    }
+    else{
+        lines = &m_WakeLine;
+        particles = &m_WakeParticles;
+    }
+
+    struct TreeElement{
+        int index;
+        bool isLine;
+        bool isMirror;
+    };
+
+    std::vector<VPML::Treecode_Source> sources;
+    QVector<TreeElement> elements;
+
+    int numMirror = m_QSim->m_bincludeGround ? 2 : 1;
+
+    for (int m=0;m<numMirror;m++){
+
+        bool isMirror = (m == 1);
+        double zSign = isMirror ? -1.0 : 1.0;
+
+        for (int i=0;i<lines->size();i++){
+            VortexLine *line = lines->at(i);
+            if (line->Gamma == 0) continue;
+
+            Vec3 pL(line->pL->x, line->pL->y, line->pL->z*zSign);
+            Vec3 pT(line->pT->x, line->pT->y, line->pT->z*zSign);
+            Vec3 mid = (pL+pT)/2.0;
+            Vec3 alpha = (pT-pL)*line->Gamma*zSign;
+
+            VPML::Treecode_Source src;
+            src.Pos = VPML::Vector3(mid.x,mid.y,mid.z);
+            src.Alpha = VPML::Vector3(alpha.x,alpha.y,alpha.z);
+            src.Ext = (pT-pL).VAbs()/2.0+2.0*sqrt(line->coreSizeSquared);
+            src.Stretch = false;
+            sources.push_back(src);
+
+            TreeElement element = {i, true, isMirror};
+            elements.append(element);
+        }
+
+        for (int i=0;i<particles->size();i++){
+            VortexParticle *particle = particles->at(i);
+
+            VPML::Treecode_Source src;
+            src.Pos = VPML::Vector3(particle->position.x,particle->position.y,particle->position.z*zSign);
+            src.Alpha = VPML::Vector3(particle->alpha.x*zSign,particle->alpha.y*zSign,particle->alpha.z);
+            src.Ext = 3.0*particle->coresize;
+            src.Stretch = !isMirror;
+            sources.push_back(src);
+
+            TreeElement element = {i, false, isMirror};
+            elements.append(element);
+        }
+    }
+
+    VPML::Vortex_Treecode tree;
+    tree.Set_Parameters(m_QSim->m_treecodeTheta, m_QSim->m_treecodeOrder);
+    tree.Build(sources);
+
+    std::vector<Vec3> induced(positions->size());
+
+    #pragma omp parallel default (none) shared (positions, velocities, induced, tree, elements, lines, particles)
+    {
+    #pragma omp for
+        for (int i=0;i<positions->size();i++){
+
+            VortexParticle *p_p = NULL;
+            if ( i < m_WakeParticles.size()) p_p = m_WakeParticles.at(i);
+
+            Vec3 EvalPt = positions->at(i);
+            Vec3f x;
+            x = EvalPt;
+            Vec3 nearField(0,0,0);
+
+            auto addNearField = [&](int ID){
+                const TreeElement &element = elements.at(ID);
+                if (element.isLine){
+                    VortexLine *line = lines->at(element.index);
+                    Vec3 R1, R2;
+                    if (element.isMirror){
+                        R1 = EvalPt - Vec3(line->pL->x, line->pL->y, -line->pL->z);
+                        R2 = EvalPt - Vec3(line->pT->x, line->pT->y, -line->pT->z);
+                        nearField += biotSavartLineKernel(R1,R2,-line->Gamma,line->coreSizeSquared);
+                    }
+                    else{
+                        R1 = EvalPt - *line->pL;
+                        R2 = EvalPt - *line->pT;
+                        nearField += biotSavartLineKernel(R1,R2,line->Gamma,line->coreSizeSquared);
+                    }
+                }
+                else{
+                    VortexParticle *particle = particles->at(element.index);
+                    if (element.isMirror){
+                        VortexParticle mirrored = *particle;
+                        mirrored.position.z = -particle->position.z;
+                        mirrored.alpha.x = -particle->alpha.x;
+                        mirrored.alpha.y = -particle->alpha.y;
+                        mirrored.alpha.z = particle->alpha.z;
+                        nearField += biotSavartParticleKernel(x, &mirrored, 3, NULL);
+                    }
+                    else{
+                        nearField += biotSavartParticleKernel(x, particle, 3, p_p);
+                    }
+                }
+            };
+
+            VPML::Vector3 alpha_p, stretch = VPML::Vector3::Zero();
+            if (p_p) alpha_p = VPML::Vector3(p_p->alpha.x,p_p->alpha.y,p_p->alpha.z);
+
+            VPML::Vector3 farField = tree.Evaluate(VPML::Vector3(EvalPt.x,EvalPt.y,EvalPt.z), p_p ? &alpha_p : NULL, stretch, addNearField);
+
+            if (p_p) p_p->dalpha_dt += Vec3f(stretch(0),stretch(1),stretch(2));
+
+            induced[i] = nearField + Vec3(farField(0),farField(1),farField(2));
+        }
+    }
+
+    for (int i=0;i<positions->size();i++){
+        Vec3 vec = velocities->at(i);
+        velocities->replace(i,vec+induced[i]);
+    }
+
+    if (m_QSim->m_bTreecodeCheck){
+
+        // compare the treecode against the direct summation for a subset of the evaluation points
+
+        int stride = std::max(1,positions->size()/500);
+        int numSamples = (positions->size()+stride-1)/stride;
+
+        std::vector<double> error(numSamples,0);
+        std::vector<double> magnitude(numSamples,0);
+
+        #pragma omp parallel default (none) shared (positions, induced, error, magnitude, stride, numSamples)
+        {
+        #pragma omp for
+            for (int k=0;k<numSamples;k++){
+                int i = k*stride;
+                Vec3 direct = calculateWakeInduction(positions->at(i));
+                error[k] = (induced[i]-direct).VAbs();
+                magnitude[k] = direct.VAbs();
+            }
+        }
+
+        double rmsMagnitude = 0, rmsError = 0, maxError = 0;
+        for (int k=0;k<numSamples;k++){
+            rmsMagnitude += pow(magnitude[k],2);
+            rmsError += pow(error[k],2);
+            if (error[k] > maxError) maxError = error[k];
+        }
+        rmsMagnitude = sqrt(rmsMagnitude/numSamples);
+        rmsError = sqrt(rmsError/numSamples);
+
+        if (rmsMagnitude > 0){
+            m_QSim->m_treecodeMaxError = maxError/rmsMagnitude;
+            m_QSim->m_treecodeRmsError = rmsError/rmsMagnitude;
+        }
+        else{
+            m_QSim->m_treecodeMaxError = 0;
+            m_QSim->m_treecodeRmsError = 0;
+        }
+
+        if (debugSimulation) qDebug().noquote() << "QTurbine: Treecode Check at Timestep" << m_currentTimeStep << ": Sources" << tree.N_Sources() << "Clusters" << tree.N_Clusters() << "Samples" << numSamples << "Max. Rel. Error" << m_QSim->m_treecodeMaxError << "RMS Rel. Error" << m_QSim->m_treecodeRmsError;
+    }
+
+    if (debugTurbine) qDebug() << "QTurbine: Finished Wake Induction Treecode";
+
+}
+
 void QTurbineSimulationData::addBladeInductionVelocities(QList<Vec3> *positions, QList<Vec3> *velocities){
 
     if (!m_WakeNode.size() && !m_WakeParticles.size()) return;
 
+    // the bound vortex lines are packed once and evaluated with the vectorized kernels
+
+    packBoundLineArrays();
+
     #pragma omp parallel default (none) shared (positions, velocities)
     {
     #pragma omp for
         for (int i=0;i<positions->size();i++){
             Vec3 vec = velocities->at(i);
-            velocities->replace(i,vec+calculateBladeInduction(positions->at(i)));
+            Vec3 ind = biotSavartLineInduction(m_BoundLineArrays,positions->at(i));
+            if (m_QSim->m_bincludeGround) ind += biotSavartLineInduction(m_BoundLineArrays,positions->at(i),true);
+            velocities->replace(i,vec+ind);
+        }
+    }
+
+}
+
+void QTurbineSimulationData::packBoundLineArrays(bool indWing){
+
+    // packs the vortex lines of the blade and strut panels, the bound line induction is evaluated from these arrays
+
+    QList<VortexPanel*> *panels;
+    if (m_QSim->isWakeInteraction())
+        panels = &m_QSim->m_globalBladePanel;
+    else
+        panels = &m_BladePanel;
+
+    QList<VortexPanel*> *strutPanels;
+    if (m_QSim->isWakeInteraction())
+        strutPanels = &m_QSim->m_globalStrutPanel;
+    else
+        strutPanels = &m_StrutPanel;
+
+    m_BoundLineArrays.Clear();
+
+    for (int ID = 0; ID < panels->size(); ++ID) {
+        VortexPanel *panel = panels->at(ID);
+        if (panel->m_Gamma != 0){
+            double coreSizeSquared = pow(panel->chord*m_QTurbine->m_coreRadiusChordFractionBound,2);
+            if (m_QTurbine->m_bShed || indWing)
+                m_BoundLineArrays.Append(panel->VortPtA,panel->VortPtB,panel->m_Gamma,coreSizeSquared);
+            if (m_QTurbine->m_bShed && (m_WakeLine.size() + m_WakeParticles.size()) == 0)
+                m_BoundLineArrays.Append(*panel->pTB,*panel->pTA,panel->m_Gamma,coreSizeSquared);
+            if (m_QTurbine->m_bTrailing || indWing){
+                m_BoundLineArrays.Append(*panel->pTA,panel->VortPtA,panel->m_Gamma,coreSizeSquared);
+                m_BoundLineArrays.Append(panel->VortPtB,*panel->pTB,panel->m_Gamma,coreSizeSquared);
+            }
         }
     }
 
+    if (!m_QTurbine->m_bcalculateStrutLift) return;
+
+    for (int ID = 0; ID < strutPanels->size(); ++ID) {
+        VortexPanel *panel = strutPanels->at(ID);
+        if (panel->m_Gamma != 0){
+            double coreSizeSquared = pow(panel->chord*m_QTurbine->m_coreRadiusChordFractionBound,2);
+            if (m_QTurbine->m_bShed || indWing)
+                m_BoundLineArrays.Append(panel->VortPtA,panel->VortPtB,panel->m_Gamma,coreSizeSquared);
+            if (m_QTurbine->m_bShed && m_WakeLine.size() == 0)
+                m_BoundLineArrays.Append(*panel->pTB,*panel->pTA,panel->m_Gamma,coreSizeSquared);
+            if (m_QTurbine->m_bTrailing || indWing){
+                m_BoundLineArrays.Append(*panel->pTA,panel->VortPtA,panel->m_Gamma,coreSizeSquared);
+                m_BoundLineArrays.Append(panel->VortPtB,*panel->pTB,panel->m_Gamma,coreSizeSquared);
+            }
+        }
+    }
 }
 
 void QTurbineSimulationData::wakeInductionSingleCore(QList<Vec3> *positions, QList<Vec3> *velocities){
@@ -3450,11 +3855,15 @@ void QTurbineSimulationData::addFreestreamVelocities(QList<Vec3> *positions, QLi
 
     if (!m_WakeNode.size() && !m_WakeParticles.size()) return;
 
+        QVector<Vec3> V_free;
+        if (m_QTurbine->m_WakeConvectionType != LOCALMEAN && m_QTurbine->m_WakeConvectionType != HHMEAN)
+            getFreeStream(positions->toVector(), V_free);
+
         for (int i=0;i<positions->size();i++){
             Vec3 vec = velocities->at(i);
             if (m_QTurbine->m_WakeConvectionType == LOCALMEAN) velocities->replace(i,vec+getMeanFreeStream(positions->at(i)));
             else if (m_QTurbine->m_WakeConvectionType == HHMEAN) velocities->replace(i,vec+getMeanFreeStream(m_hubCoordsFixed.Origin));
-            else velocities->replace(i,vec+getFreeStream(positions->at(i)));
+            else velocities->replace(i,vec+V_free.at(i));
         }
 }
 
@@ -3482,6 +3891,35 @@ Vec3 QTurbineSimulationData::calculateWakeInduction (Vec3 EvalPt, VortexPanel *p
 
         Vec3 gamma_cont;
 
+        // if the wake has been packed the filaments are read from contiguous arrays instead of the line objects
+
+        VortexLineArrays &arr = m_WakeLineArrays;
+        const bool isPacked = arr.IsPackedFrom(lines);
+
+        // without the shed velocity bookkeeping of a panel the vectorized kernels are used
+
+        if (!panel && isPacked && m_WakeParticleArrays.IsPackedFrom(particles)){
+            VGamma_total += biotSavartLineInduction(arr,EvalPt);
+            VGamma_total += biotSavartParticleInduction(m_WakeParticleArrays,EvalPt,false,particle);
+            if (m_QSim->m_bincludeGround){
+                VGamma_total += biotSavartLineInduction(arr,EvalPt,true);
+                VGamma_total += biotSavartParticleInduction(m_WakeParticleArrays,EvalPt,true);
+            }
+            return VGamma_total;
+        }
+
+        if (isPacked){
+            for(int ID=0;ID<arr.size();ID++){
+                R1.Set(EvalPt.x - arr.x1[ID], EvalPt.y - arr.y1[ID], EvalPt.z - arr.z1[ID]);
+                R2.Set(EvalPt.x - arr.x2[ID], EvalPt.y - arr.y2[ID], EvalPt.z - arr.z2[ID]);
+                gamma_cont = biotSavartLineKernel(R1,R2,arr.gamma[ID],arr.coreSizeSquared[ID]);
+                VGamma_total += gamma_cont;
+                if (panel){
+                    if (panel == arr.shedPanel[ID] && (arr.shedAge[ID]*m_dT*panel->m_V_relative.VAbs())<8*panel->chord) panel->m_V_Shed += gamma_cont;
+                }
+            }
+        }
+        else{
             for(int ID=0;ID<lines->size();ID++){
                 if (lines->at(ID)->Gamma != 0){
                 R1 = EvalPt - *lines->at(ID)->pL;
@@ -3493,6 +3931,7 @@ Vec3 QTurbineSimulationData::calculateWakeInduction (Vec3 EvalPt, VortexPanel *p
                     }
                 }
             }
+        }
 
             for(int ID=0;ID<particles->size();ID++){
                 Vec3f x;
@@ -3506,14 +3945,27 @@ Vec3 QTurbineSimulationData::calculateWakeInduction (Vec3 EvalPt, VortexPanel *p
 
 
         if (m_QSim->m_bincludeGround){
-            for(int ID=0;ID<lines->size();ID++){
-                if (lines->at(ID)->Gamma != 0){
-                R1 = EvalPt - Vec3(lines->at(ID)->pL->x, lines->at(ID)->pL->y, -lines->at(ID)->pL->z);
-                R2 = EvalPt - Vec3(lines->at(ID)->pT->x, lines->at(ID)->pT->y, -lines->at(ID)->pT->z);
-                gamma_cont =  biotSavartLineKernel(R1,R2,-lines->at(ID)->Gamma,lines->at(ID)->coreSizeSquared);
-                VGamma_total += gamma_cont;
+            if (isPacked){
+                for(int ID=0;ID<arr.size();ID++){
+                    R1.Set(EvalPt.x - arr.x1[ID], EvalPt.y - arr.y1[ID], EvalPt.z + arr.z1[ID]);
+                    R2.Set(EvalPt.x - arr.x2[ID], EvalPt.y - arr.y2[ID], EvalPt.z + arr.z2[ID]);
+                    gamma_cont = biotSavartLineKernel(R1,R2,-arr.gamma[ID],arr.coreSizeSquared[ID]);
+                    VGamma_total += gamma_cont;
                     if (panel){
-                        if (lines->at(ID)->isShed && (panel == lines->at(ID)->rightPanel) && ((m_currentTimeStep - lines->at(ID)->fromTimestep)*m_dT*panel->m_V_relative.VAbs())<8*panel->chord) panel->m_V_Shed += gamma_cont;
+                        if (panel == arr.shedPanel[ID] && (arr.shedAge[ID]*m_dT*panel->m_V_relative.VAbs())<8*panel->chord) panel->m_V_Shed += gamma_cont;
+                    }
+                }
+            }
+            else{
+                for(int ID=0;ID<lines->size();ID++){
+                    if (lines->at(ID)->Gamma != 0){
+                    R1 = EvalPt - Vec3(lines->at(ID)->pL->x, lines->at(ID)->pL->y, -lines->at(ID)->pL->z);
+                    R2 = EvalPt - Vec3(lines->at(ID)->pT->x, lines->at(ID)->pT->y, -lines->at(ID)->pT->z);
+                    gamma_cont =  biotSavartLineKernel(R1,R2,-lines->at(ID)->Gamma,lines->at(ID)->coreSizeSquared);
+                    VGamma_total += gamma_cont;
+                        if (panel){
+                            if (lines->at(ID)->isShed && (panel == lines->at(ID)->rightPanel) && ((m_currentTimeStep - lines->at(ID)->fromTimestep)*m_dT*panel->m_V_relative.VAbs())<8*panel->chord) panel->m_V_Shed += gamma_cont;
+                        }
                     }
                 }
             }
@@ -3699,173 +4151,7 @@ void QTurbineSimulationData::assignVelocitiesToWakeElements(QList<Vec3> *velocit
     }
 }
 
-Vec3 QTurbineSimulationData::calculateBladeInduction(Vec3 EvalPt, bool indWing){
-
-    QList<VortexPanel*> *panels;
-    if (m_QSim->isWakeInteraction())
-        panels = &m_QSim->m_globalBladePanel;
-    else
-        panels = &m_BladePanel;
-
-    QList<VortexPanel*> *strutPanels;
-    if (m_QSim->isWakeInteraction())
-        strutPanels = &m_QSim->m_globalStrutPanel;
-    else
-        strutPanels = &m_StrutPanel;
-
-    Vec3 VGamma_total(0,0,0);
-    VortexNode R1, R2, R3, R4;  // EvalPt-P1
-    /////////////
-    //Wing Panels
-    /////////////
-
-    for (int ID = 0; ID < panels->size(); ++ID) {
-            if (panels->at(ID)->m_Gamma != 0){
-
-            double coreSizeSquared = pow(panels->at(ID)->chord*m_QTurbine->m_coreRadiusChordFractionBound,2);
-
-            //calc vector P1234 -> EvalPt on WingPanels
-            R1 = EvalPt - panels->at(ID)->VortPtA;  // EvalPt-P1
-            R2 = EvalPt - panels->at(ID)->VortPtB;  // EvalPt-P2
-            R3 = EvalPt - *panels->at(ID)->pTB;  // EvalPt-P3
-            R4 = EvalPt - *panels->at(ID)->pTA;  // EvalPt-P4
-    //        /////////////////////////////////////
-    //        //calc induction of wing Panels
-    //        /////////////////////////////////////
-            //Induction Vortexelement 1-2 on WingPanels
-            if (m_QTurbine->m_bShed || indWing){
-                Vec3 ind = biotSavartLineKernel(R1,R2,panels->at(ID)->m_Gamma,coreSizeSquared);
-                VGamma_total += ind;
-            }
-            if (m_QTurbine->m_bShed) {
-                if ((m_WakeLine.size() + m_WakeParticles.size()) == 0) {
-                    //Induction Vortexelement 3-4 on WingPanels
-                    Vec3 ind = biotSavartLineKernel(R3,R4,panels->at(ID)->m_Gamma,coreSizeSquared);
-                    VGamma_total += ind;
-                 }
-            }
-            if (m_QTurbine->m_bTrailing || indWing){
-                //Induction Vortexelement 4-1 on WingPanels
-            VGamma_total += biotSavartLineKernel(R4,R1,panels->at(ID)->m_Gamma,coreSizeSquared);
-            //Induction Vortexelement 2-3 on WingPanels
-            VGamma_total += biotSavartLineKernel(R2,R3,panels->at(ID)->m_Gamma,coreSizeSquared);}
-        }
-    }
-
-    if (m_QSim->m_bincludeGround) {
-        for (int ID = 0; ID < panels->size(); ++ID) {
-            if (panels->at(ID)->m_Gamma != 0){
-
-                double coreSizeSquared = pow(panels->at(ID)->chord*m_QTurbine->m_coreRadiusChordFractionBound,2);
-
-                //calc vector P1234 -> EvalPt on WingPanels
-                R1 = EvalPt - Vec3(panels->at(ID)->VortPtA.x, panels->at(ID)->VortPtA.y, -panels->at(ID)->VortPtA.z);
-                R2 = EvalPt - Vec3(panels->at(ID)->VortPtB.x, panels->at(ID)->VortPtB.y, -panels->at(ID)->VortPtB.z);
-                R3 = EvalPt - Vec3(panels->at(ID)->pTB->x, panels->at(ID)->pTB->y, -panels->at(ID)->pTB->z);
-                R4 = EvalPt - Vec3(panels->at(ID)->pTA->x, panels->at(ID)->pTA->y, -panels->at(ID)->pTA->z);
-                /////////////////////////////////////
-                //calc induction of wing Panels mirrored at the ground
-                /////////////////////////////////////
-                //Induction Vortexelement 1-2 on WingPanels
-                if (m_QTurbine->m_bShed || indWing){
-                    Vec3 ind = biotSavartLineKernel(R1,R2,-panels->at(ID)->m_Gamma,coreSizeSquared);
-                    VGamma_total += ind;
-                }
-                if (m_QTurbine->m_bShed){
-                    if ((m_WakeLine.size() + m_WakeParticles.size()) == 0){
-                        //Induction Vortexelement 3-4 on WingPanels
-                        Vec3 ind = biotSavartLineKernel(R3,R4,-panels->at(ID)->m_Gamma,coreSizeSquared);
-                        VGamma_total += ind;
-                    }
-                }
-                //Induction Vortexelement 4-1 on WingPanels
-                if (m_QTurbine->m_bTrailing || indWing){
-                VGamma_total += biotSavartLineKernel(R4,R1,-panels->at(ID)->m_Gamma,coreSizeSquared);
-                //Induction Vortexelement 2-3 on WingPanels
-                VGamma_total += biotSavartLineKernel(R2,R3,-panels->at(ID)->m_Gamma,coreSizeSquared);}
-
-            }
-        }
-    }
-
-    /////////////
-    //Strut Panels
-    /////////////
-
-    if (m_QTurbine->m_bcalculateStrutLift){
-        for (int ID = 0; ID < strutPanels->size(); ++ID) {
-                if (strutPanels->at(ID)->m_Gamma != 0){
-
-                double coreSizeSquared = pow(strutPanels->at(ID)->chord*m_QTurbine->m_coreRadiusChordFractionBound,2);
-
-                //calc vector P1234 -> EvalPt on WingPanels
-                R1 = EvalPt - strutPanels->at(ID)->VortPtA;  // EvalPt-P1
-                R2 = EvalPt - strutPanels->at(ID)->VortPtB;  // EvalPt-P2
-                R3 = EvalPt - *strutPanels->at(ID)->pTB;  // EvalPt-P3
-                R4 = EvalPt - *strutPanels->at(ID)->pTA;  // EvalPt-P4
-        //        /////////////////////////////////////
-        //        //calc induction of wing Panels
-        //        /////////////////////////////////////
-                //Induction Vortexelement 1-2 on WingPanels
-                if (m_QTurbine->m_bShed || indWing){
-                    Vec3 ind = biotSavartLineKernel(R1,R2,strutPanels->at(ID)->m_Gamma,coreSizeSquared);
-                    VGamma_total += ind;
-                }
-                if (m_QTurbine->m_bShed) {
-                    if (m_WakeLine.size() == 0) {
-                        //Induction Vortexelement 3-4 on WingPanels
-                        Vec3 ind = biotSavartLineKernel(R3,R4,strutPanels->at(ID)->m_Gamma,coreSizeSquared);
-                        VGamma_total += ind;
-                     }
-                }
-                if (m_QTurbine->m_bTrailing || indWing){
-                    //Induction Vortexelement 4-1 on WingPanels
-                VGamma_total += biotSavartLineKernel(R4,R1,strutPanels->at(ID)->m_Gamma,coreSizeSquared);
-                //Induction Vortexelement 2-3 on WingPanels
-                VGamma_total += biotSavartLineKernel(R2,R3,strutPanels->at(ID)->m_Gamma,coreSizeSquared);}
-
-            }
-        }
-
-        if (m_QSim->m_bincludeGround) {
-            for (int ID = 0; ID < strutPanels->size(); ++ID) {
-                if (strutPanels->at(ID)->m_Gamma != 0){
-
-                    double coreSizeSquared = pow(strutPanels->at(ID)->chord*m_QTurbine->m_coreRadiusChordFractionBound,2);
-
-                    //calc vector P1234 -> EvalPt on WingPanels
-                    R1 = EvalPt - Vec3(strutPanels->at(ID)->VortPtA.x, strutPanels->at(ID)->VortPtA.y, -strutPanels->at(ID)->VortPtA.z);
-                    R2 = EvalPt - Vec3(strutPanels->at(ID)->VortPtB.x, strutPanels->at(ID)->VortPtB.y, -strutPanels->at(ID)->VortPtB.z);
-                    R3 = EvalPt - Vec3(strutPanels->at(ID)->pTB->x, strutPanels->at(ID)->pTB->y, -strutPanels->at(ID)->pTB->z);
-                    R4 = EvalPt - Vec3(strutPanels->at(ID)->pTA->x, strutPanels->at(ID)->pTA->y, -strutPanels->at(ID)->pTA->z);
-                    /////////////////////////////////////
-                    //calc induction of wing Panels mirrored at the ground
-                    /////////////////////////////////////
-                    //Induction Vortexelement 1-2 on WingPanels
-                    if (m_QTurbine->m_bShed || indWing){
-                        Vec3 ind = biotSavartLineKernel(R1,R2,-strutPanels->at(ID)->m_Gamma,coreSizeSquared);
-                        VGamma_total += ind;
-                    }
-                    if (m_QTurbine->m_bShed){
-                        if (m_WakeLine.size() == 0){
-                            //Induction Vortexelement 3-4 on WingPanels
-                            Vec3 ind = biotSavartLineKernel(R3,R4,-strutPanels->at(ID)->m_Gamma,coreSizeSquared);
-                            VGamma_total += ind;
-                        }
-                    }
-                    //Induction Vortexelement 4-1 on WingPanels
-                    if (m_QTurbine->m_bTrailing || indWing){
-                    VGamma_total += biotSavartLineKernel(R4,R1,-strutPanels->at(ID)->m_Gamma,coreSizeSquared);
-                    //Induction Vortexelement 2-3 on WingPanels
-                    VGamma_total += biotSavartLineKernel(R2,R3,-strutPanels->at(ID)->m_Gamma,coreSizeSquared);}
-                }
-            }
-        }
-    }
-    return VGamma_total;
-}
-
-void QTurbineSimulationData::steadyStateBEMIterationDTU(double tsr){
+void QTurbineSimulationData::steadyStateBEMIterationDTU(double tsr, QVector<Vec3> *induction){
 
     m_CurrentOmega = tsr/m_QTurbine->m_Blade->getRotorRadius()*m_steadyBEMVelocity;
     m_QTurbine->m_DemandedOmega = tsr/m_QTurbine->m_Blade->getRotorRadius()*m_steadyBEMVelocity;
@@ -3884,6 +4170,11 @@ void QTurbineSimulationData::steadyStateBEMIterationDTU(double tsr){
         }
     }
 
+    // the induction of a neighbouring operating point is a much better initial guess than zero induction
+
+    const bool warmStart = induction && induction->size() == panels.size();
+    if (induction && !warmStart) induction->resize(panels.size());
+
         for (int i=0;i<panels.size();i++){
 
             bool converged = false;
@@ -3892,6 +4183,13 @@ void QTurbineSimulationData::steadyStateBEMIterationDTU(double tsr){
             double aa_old = 0, at_old = 0, ar_old = 0;
             double aa = 0, at = 0, ar = 0;
 
+            if (warmStart){
+                aa = induction->at(i).x;
+                at = induction->at(i).y;
+                ar = induction->at(i).z;
+                panels.at(i)->m_V_sampled = getFreeStream(panels.at(i)->CtrlPt);
+            }
+
             while ((converged == false) && (iterations < m_QTurbine->m_maxIterations)){
 
                 aa_old = aa;
@@ -3973,6 +4271,8 @@ void QTurbineSimulationData::steadyStateBEMIterationDTU(double tsr){
 
                 panels.at(i)->iterations = iterations++;
             }
+
+            if (induction) (*induction)[i] = Vec3(aa,at,ar);
         }
 
 
@@ -3983,7 +4283,7 @@ void QTurbineSimulationData::steadyStateBEMIterationDTU(double tsr){
 
 }
 
-void QTurbineSimulationData::steadyStateBEMIterationClassic(double tsr){
+void QTurbineSimulationData::steadyStateBEMIterationClassic(double tsr, QVector<Vec3> *induction){
 
     m_CurrentOmega = tsr/m_QTurbine->m_Blade->getRotorRadius()*m_steadyBEMVelocity;
     m_QTurbine->m_DemandedOmega = tsr/m_QTurbine->m_Blade->getRotorRadius()*m_steadyBEMVelocity;
@@ -4002,6 +4302,11 @@ void QTurbineSimulationData::steadyStateBEMIterationClassic(double tsr){
         }
     }
 
+    // the induction of a neighbouring operating point is a much better initial guess than zero induction
+
+    const bool warmStart = induction && induction->size() == panels.size();
+    if (induction && !warmStart) induction->resize(panels.size());
+
 
         for (int i=0;i<panels.size();i++){
 
@@ -4011,6 +4316,13 @@ void QTurbineSimulationData::steadyStateBEMIterationClassic(double tsr){
             double aa_old = 0, at_old = 0, ar_old = 0;
             double aa = 0, at = 0, ar = 0;
 
+            if (warmStart){
+                aa = induction->at(i).x;
+                at = induction->at(i).y;
+                ar = induction->at(i).z;
+                panels.at(i)->m_V_sampled = getFreeStream(panels.at(i)->CtrlPt);
+            }
+
             while ((converged == false) && (iterations < m_QTurbine->m_maxIterations)){
 
                 aa_old = aa;
@@ -4099,6 +4411,8 @@ void QTurbineSimulationData::steadyStateBEMIterationClassic(double tsr){
 
                 panels.at(i)->iterations = iterations++;
             }
+
+            if (induction) (*induction)[i] = Vec3(aa,at,ar);
         }
 
 
@@ -4120,8 +4434,20 @@ void QTurbineSimulationData::gammaBoundFixedPointIteration()
     if (debugTurbine) qDebug() << "QTurbine: Start Gamma Bound Fixed Point Iteration";
 
 
+    QElapsedTimer iterationTimer;
+    iterationTimer.start();
+
     m_iterations = 0;
     m_bAllConverged = false;
+
+    // the bound vortex geometry does not change during the iteration, the blade self induction is
+    // evaluated from the influence matrix and the circulation is updated with Anderson acceleration
+    if (m_QTurbine->m_wakeType != U_BEM || m_StrutPanel.size()) assembleBoundInfluenceMatrix();
+    m_AndersonDX.clear();
+    m_AndersonDF.clear();
+    m_AndersonX.clear();
+    m_AndersonF.clear();
+
     // starting value for iteration comes from last wake timestep
     for(int i = 0; i < m_BladePanel.size(); ++i) m_BladePanel[i]->m_Gamma_last_iteration = m_BladePanel[i]->m_Gamma_t_minus_1;
     for(int i = 0; i < m_StrutPanel.size(); ++i) m_StrutPanel[i]->m_Gamma_last_iteration = m_StrutPanel[i]->m_Gamma_t_minus_1;
@@ -4155,6 +4481,7 @@ void QTurbineSimulationData::gammaBoundFixedPointIteration()
 
 
     m_QTurbine->m_numIterations.append(m_iterations);
+    m_gammaIterationTime = iterationTimer.nsecsElapsed()/1.0e6;
 
     if (!m_bAllConverged){
         QVector<float> problems;
@@ -4346,11 +4673,27 @@ void QTurbineSimulationData::calcUnsteadyBEMInduction(){
         accelf2 = 20;
     }
 
+    // the free stream at the polar grid points and the hub is sampled once for the whole grid
+
+    QVector<Vec3> gridPositions, gridFreeStream;
+    for (int i=0;i<polarGrid.size();i++)
+        for (int j=0;j<polarGrid.at(i).size();j++)
+            gridPositions.append(polarGrid.at(i).at(j).position);
+    gridPositions.append(m_QTurbine->m_hubCoordsFixed.Origin);
+
+    getFreeStream(gridPositions, gridFreeStream);
+
+    const double hubFreeStream = gridFreeStream.last().VAbs();
+
     // polar grid calculations
 
+        int gridIndex = 0;
+
         for (int i=0;i<polarGrid.size();i++){
             for (int j=0;j<polarGrid.at(i).size();j++){
 
+                const Vec3 V_free = gridFreeStream.at(gridIndex++);
+
                 // find the two closest blades at this azimuthal position
                 double pos[2]; pos[0] = 360; pos[1] = 370;
                 double num[2]; num[0] = 0; num[1] = 0;
@@ -4377,14 +4720,14 @@ void QTurbineSimulationData::calcUnsteadyBEMInduction(){
                 // calculation of tip loss factor
                 double Ft = 1, Fr = 1, F = 1;
                 if (m_QTurbine->m_BEMTipLoss){
-                    double TSR = omega *m_QTurbine->m_Blade->getRotorRadius() / m_QTurbine->getFreeStream(m_QTurbine->m_hubCoordsFixed.Origin ).VAbs();
+                    double TSR = omega *m_QTurbine->m_Blade->getRotorRadius() / hubFreeStream;
                     double r = polarGrid[i][j].radius / m_QTurbine->m_Blade->getRotorRadius();
                     double phi = atan( (1-polarGrid[i][j].aa)/(1+polarGrid[i][j].at) / r / TSR);
                     Ft = 2.0/PI_*acos(exp(-m_QTurbine->m_numBlades/2.0*(1-r)/r/sin(phi)));
                     if (std::isnan(Ft) || std::isinf(Ft) || Ft == 0) Ft = 0.01;
                 }
                 if (m_QTurbine->m_BEMTipLoss){
-                    double TSR = omega *m_QTurbine->m_Blade->getRotorRadius() / m_QTurbine->getFreeStream(m_QTurbine->m_hubCoordsFixed.Origin ).VAbs();
+                    double TSR = omega *m_QTurbine->m_Blade->getRotorRadius() / hubFreeStream;
                     double r = (m_QTurbine->m_Blade->getRotorRadius() - polarGrid[i][j].radius) / m_QTurbine->m_Blade->getRotorRadius();
                     double phi = atan( (1-polarGrid[i][j].aa)/(1+polarGrid[i][j].at) / r / TSR);
                     Fr = 2.0/PI_*acos(exp(-m_QTurbine->m_numBlades/2.0*(1-r)/r/sin(phi)));
@@ -4398,20 +4741,20 @@ void QTurbineSimulationData::calcUnsteadyBEMInduction(){
 
                 //calculate CQ and CT for blade1
                 double V_relative1;
-                Vec3 ClCd1 = getLiftDragVectorForUBEM(sortedBlades.at(num[0]).at(i), getFreeStream(polarGrid.at(i).at(j).position), polarGrid.at(i).at(j).aa,polarGrid.at(i).at(j).azi-sortedBlades.at(num[0]).at(i)->angularPos, V_relative1);
+                Vec3 ClCd1 = getLiftDragVectorForUBEM(sortedBlades.at(num[0]).at(i), V_free, polarGrid.at(i).at(j).aa,polarGrid.at(i).at(j).azi-sortedBlades.at(num[0]).at(i)->angularPos, V_relative1);
                 Cq1 = ClCd1.dot(sortedBlades.at(num[0]).at(i)->tangentialVector);
                 Ct1 = ClCd1.dot(m_hubCoords.X);
-                CT1 = Ct1 * sigma * pow(V_relative1,2) / pow(getFreeStream(polarGrid.at(i).at(j).position).VAbs(),2);
-                CQ1 = Cq1 * sigma * pow(V_relative1,2) / pow(getFreeStream(polarGrid.at(i).at(j).position).VAbs(),2);
+                CT1 = Ct1 * sigma * pow(V_relative1,2) / pow(V_free.VAbs(),2);
+                CQ1 = Cq1 * sigma * pow(V_relative1,2) / pow(V_free.VAbs(),2);
 
                 if (sortedBlades.size() > 1){
                     //calculate CQ and CT for blade2
                     double V_relative2;
-                    Vec3 ClCd2 = getLiftDragVectorForUBEM(sortedBlades.at(num[1]).at(i), getFreeStream(polarGrid.at(i).at(j).position), polarGrid.at(i).at(j).aa,polarGrid.at(i).at(j).azi-sortedBlades.at(num[1]).at(i)->angularPos, V_relative2);
+                    Vec3 ClCd2 = getLiftDragVectorForUBEM(sortedBlades.at(num[1]).at(i), V_free, polarGrid.at(i).at(j).aa,polarGrid.at(i).at(j).azi-sortedBlades.at(num[1]).at(i)->angularPos, V_relative2);
                     Cq2 = ClCd2.dot(sortedBlades.at(num[1]).at(i)->tangentialVector);
                     Ct2 = ClCd2.dot(m_hubCoords.X);
-                    CT2 = Ct2 * sigma * pow(V_relative2,2) / pow(getFreeStream(polarGrid.at(i).at(j).position).VAbs(),2);
-                    CQ2 = Cq2 * sigma * pow(V_relative2,2) / pow(getFreeStream(polarGrid.at(i).at(j).position).VAbs(),2);
+                    CT2 = Ct2 * sigma * pow(V_relative2,2) / pow(V_free.VAbs(),2);
+                    CQ2 = Cq2 * sigma * pow(V_relative2,2) / pow(V_free.VAbs(),2);
 
                     // interpolate CQ and CT from blade 1 and blade 2 onto the grid points
                     polarGrid[i][j].CT = (CT1*pos[0] + CT2*pos[1]) / (pos[0] + pos[1]) / F;
@@ -4573,7 +4916,7 @@ Vec3 QTurbineSimulationData::getLiftDragVectorForUBEM(VortexPanel *panel, Vec3 f
 
     double tsr = m_QTurbine->m_CurrentOmega * m_QTurbine->m_Blade->getRotorRadius() / freestream.VAbs();
 
-    QList<double> parameters = m_QTurbine->m_Blade->getBladeParameters(panel->fromBladelength,panel->m_AoA75,true,panel->chord*V_inPlane.VAbs()/m_kinematicViscosity,m_QTurbine->m_bincludeHimmelskamp,tsr,&m_AFCList[panel->fromBlade],0,panel->fromBlade);
+    BladeParameters parameters = m_QTurbine->m_Blade->getBladeParameters(panel->fromBladelength,panel->m_AoA75,true,panel->chord*V_inPlane.VAbs()/m_kinematicViscosity,m_QTurbine->m_bincludeHimmelskamp,tsr,&m_AFCList[panel->fromBlade],0,panel->fromBlade);
 
     double CL = parameters.at(0);
     double CD = parameters.at(1);
@@ -4704,11 +5047,14 @@ void QTurbineSimulationData::calcBladePanelVelocities() {
             for (int i=0;i<m_BladePanel.size();i++) m_BladePanel.at(i)->m_Store_Wake = velocities.at(i);
         }
         else{
+            packWakeArrays();
             #pragma omp parallel default (none)
             {
             #pragma omp for
             for(int ID = 0; ID < m_BladePanel.size(); ++ID) m_BladePanel[ID]->m_Store_Wake = calculateWakeInduction(m_BladePanel[ID]->CtrlPt, m_BladePanel[ID]);
             }
+            m_WakeLineArrays.Invalidate();
+            m_WakeParticleArrays.Invalidate();
         }
     }
 
@@ -4718,10 +5064,14 @@ void QTurbineSimulationData::calcBladePanelVelocities() {
         #pragma omp parallel default (none)
         {
         #pragma omp for
-            for(int ID = 0; ID < m_BladePanel.size(); ++ID) m_BladePanel[ID]->m_V_induced = calculateBladeInduction(m_BladePanel[ID]->CtrlPt, true);
+            for(int ID = 0; ID < m_BladePanel.size(); ++ID) m_BladePanel[ID]->m_V_induced = calculateBladeInductionFromMatrix(ID);
         }
     }
 
+    QVector<Vec3> ctrlPts(m_BladePanel.size()), V_sampled;
+    for(int ID = 0; ID < m_BladePanel.size(); ++ID) ctrlPts[ID] = m_BladePanel[ID]->CtrlPt;
+    getFreeStream(ctrlPts, V_sampled);
+
     for(int ID = 0; ID < m_BladePanel.size(); ++ID) {
         //calcs m_V_induced for every WingPanel in WingPanel Control Point
         if ((m_currentTimeStep)%m_QTurbine->m_nthWakeStep == 0) {
@@ -4733,7 +5083,7 @@ void QTurbineSimulationData::calcBladePanelVelocities() {
             m_BladePanel[ID]->m_V_induced += m_BladePanel[ID]->m_oldInducedVelocities.at(m_BladePanel[ID]->m_oldInducedVelocities.size()-1);
         }
 
-        m_BladePanel[ID]->m_V_sampled = getFreeStream(m_BladePanel[ID]->CtrlPt);
+        m_BladePanel[ID]->m_V_sampled = V_sampled.at(ID);
 
         m_BladePanel[ID]->m_V_relative = m_BladePanel[ID]->getRelativeVelocityAt25(m_hubCoordsFixed.X,m_QTurbine->m_CurrentOmega,m_QTurbine->m_dT, m_QTurbine->m_bisReversed);
         m_BladePanel[ID]->m_V_relative75 = m_BladePanel[ID]->getRelativeVelocityAt75(m_hubCoordsFixed.X,m_QTurbine->m_CurrentOmega,m_QTurbine->m_dT, m_QTurbine->m_bisReversed);
@@ -4762,7 +5112,7 @@ void QTurbineSimulationData::calcSteadyBladePanelCoefficients()
             else{
                 tsr = m_QTurbine->m_CurrentOmega *m_QTurbine->m_Blade->m_MaxRadius / getFreeStream(m_QTurbine->m_hubCoordsFixed.Origin ).VAbs();
             }
-            QList<double> parameters = m_QTurbine->m_Blade->getBladeParameters(m_BladePanel[i]->fromBladelength,m_BladePanel[i]->m_AoA75,true,m_BladePanel[i]->chord*m_BladePanel[i]->m_V_inPlane.VAbs()/m_kinematicViscosity,m_QTurbine->m_bincludeHimmelskamp,tsr,&m_AFCList[m_BladePanel[i]->fromBlade],0,m_BladePanel[i]->fromBlade);
+            BladeParameters parameters = m_QTurbine->m_Blade->getBladeParameters(m_BladePanel[i]->fromBladelength,m_BladePanel[i]->m_AoA75,true,m_BladePanel[i]->chord*m_BladePanel[i]->m_V_inPlane.VAbs()/m_kinematicViscosity,m_QTurbine->m_bincludeHimmelskamp,tsr,&m_AFCList[m_BladePanel[i]->fromBlade],0,m_BladePanel[i]->fromBlade);
 
             m_BladePanel[i]->m_CL = parameters.at(0);
             m_BladePanel[i]->m_CD = parameters.at(1);
@@ -4847,23 +5197,30 @@ void QTurbineSimulationData::calcStrutPanelVelocities(){
 
         }
         else{
+            packWakeArrays();
             #pragma omp parallel default (none)
             {
             #pragma omp for
             for(int ID = 0; ID < m_StrutPanel.size(); ++ID) m_StrutPanel[ID]->m_Store_Wake = calculateWakeInduction(m_StrutPanel[ID]->CtrlPt, m_StrutPanel[ID]);
             }
+            m_WakeLineArrays.Invalidate();
+            m_WakeParticleArrays.Invalidate();
         }
     }
 
 
-    #pragma omp parallel default (none)
+    QVector<Vec3> ctrlPts(m_StrutPanel.size()), V_sampled;
+    for(int ID = 0; ID < m_StrutPanel.size(); ++ID) ctrlPts[ID] = m_StrutPanel[ID]->CtrlPt;
+    getFreeStream(ctrlPts, V_sampled);
+
+    #pragma omp parallel default (none) shared (V_sampled)
     {
     #pragma omp for
         for(int ID = 0; ID < m_StrutPanel.size(); ++ID) {
 
             //calcs m_V_induced for every WingPanel in WingPanel Control Point
 
-            m_StrutPanel[ID]->m_V_induced = calculateBladeInduction(m_StrutPanel[ID]->CtrlPt, true);
+            m_StrutPanel[ID]->m_V_induced = calculateBladeInductionFromMatrix(m_BladePanel.size()+ID);
 
             if ((m_currentTimeStep)%m_QTurbine->m_nthWakeStep == 0) {
                 if (m_iterations == 0 && m_QSim->m_bisOpenCl && (m_QTurbine->m_dynamicStallType == GORMONT || m_QTurbine->m_dynamicStallType == ATEFLAP))  calculatePanelShedVelocities(m_StrutPanel[ID]);
@@ -4876,7 +5233,7 @@ void QTurbineSimulationData::calcStrutPanelVelocities(){
             m_StrutPanel[ID]->m_V_relative = m_StrutPanel[ID]->getRelativeVelocityAt25(m_hubCoordsFixed.X,m_QTurbine->m_CurrentOmega,m_QTurbine->m_dT,m_QTurbine->m_bisReversed);
             m_StrutPanel[ID]->m_V_relative75 = m_StrutPanel[ID]->getRelativeVelocityAt75(m_hubCoordsFixed.X,m_QTurbine->m_CurrentOmega,m_QTurbine->m_dT,m_QTurbine->m_bisReversed);
 
-            m_StrutPanel[ID]->m_V_sampled = getFreeStream(m_StrutPanel[ID]->CtrlPt);
+            m_StrutPanel[ID]->m_V_sampled = V_sampled.at(ID);
 
             m_StrutPanel[ID]->m_V_total = calcTowerInfluence(m_StrutPanel[ID]->CtrlPt, m_StrutPanel[ID]->m_V_sampled + m_StrutPanel[ID]->m_V_induced) - m_StrutPanel[ID]->m_V_relative;
             m_StrutPanel[ID]->m_V_total75 = m_StrutPanel[ID]->m_V_total + m_StrutPanel[ID]->m_V_relative - m_StrutPanel[ID]->m_V_relative75;
@@ -4899,7 +5256,7 @@ void QTurbineSimulationData::calcSteadyStrutPanelCoefficients(){
 
         double length = (m_StrutPanel[i]->fromStation+0.5) / m_QTurbine->m_numStrutPanels;
 
-        QList<double> parameters = m_QTurbine->m_Blade->getStrutParameters(m_StrutPanel[i]->fromStrut,m_StrutPanel[i]->m_AoA75,reynolds,length);
+        BladeParameters parameters = m_QTurbine->m_Blade->getStrutParameters(m_StrutPanel[i]->fromStrut,m_StrutPanel[i]->m_AoA75,reynolds,length);
 
         m_StrutPanel[i]->m_CL = parameters.at(0);
         m_StrutPanel[i]->m_CD = parameters.at(1);
@@ -4932,30 +5289,194 @@ void QTurbineSimulationData::gammaConvergenceCheck(bool iterateBEM){
 
     if (m_QTurbine->m_wakeType == U_BEM && !iterateBEM) return; //the unsteady BEM does not require iteration;
 
+    QList<VortexPanel*> panels = m_BladePanel;
+    if (m_QTurbine->m_bcalculateStrutLift) panels.append(m_StrutPanel);
+
+    QVector<double> gamma(panels.size()), residual(panels.size());
+    for(int i = 0; i< panels.size();i++){
+        gamma[i] = panels[i]->m_Gamma_last_iteration;
+        residual[i] = panels[i]->m_Gamma - panels[i]->m_Gamma_last_iteration;
+    }
+
+    QVector<double> gammaNew = andersonGammaUpdate(gamma, residual);
 
-    for(int i = 0; i< m_BladePanel.size();i++){
-        m_BladePanel[i]->m_isConverged = true;
-        m_BladePanel[i]->m_Gamma = m_BladePanel[i]->m_Gamma_last_iteration + m_QTurbine->m_relaxationFactor*(m_BladePanel[i]->m_Gamma - m_BladePanel[i]->m_Gamma_last_iteration);
+    // the convergence criterion is the relaxed fixed point update, independent of the acceleration
 
-        if(fabs((m_BladePanel[i]->m_Gamma - m_BladePanel[i]->m_Gamma_last_iteration)/m_BladePanel[i]->m_Gamma_last_iteration) > m_QTurbine->m_epsilon){
+    for(int i = 0; i< panels.size();i++){
+        panels[i]->m_isConverged = true;
+
+        if(fabs(m_QTurbine->m_relaxationFactor*residual[i]/gamma[i]) > m_QTurbine->m_epsilon){
             m_bAllConverged = false;
-            m_BladePanel[i]->m_isConverged = false;
+            panels[i]->m_isConverged = false;
         }
-        m_BladePanel[i]->m_Gamma_last_iteration = m_BladePanel[i]->m_Gamma;
+        panels[i]->m_Gamma = gammaNew[i];
+        panels[i]->m_Gamma_last_iteration = gammaNew[i];
     }
+}
 
-    if (m_QTurbine->m_bcalculateStrutLift){
-        for(int i = 0; i< m_StrutPanel.size();i++){
-            m_StrutPanel[i]->m_isConverged = true;
-            m_StrutPanel[i]->m_Gamma = m_StrutPanel[i]->m_Gamma_last_iteration + m_QTurbine->m_relaxationFactor*(m_StrutPanel[i]->m_Gamma - m_StrutPanel[i]->m_Gamma_last_iteration);
+QVector<double> QTurbineSimulationData::andersonGammaUpdate(QVector<double> const &gamma, QVector<double> const &residual){
+
+    // Anderson mixing of the circulation: the relaxed fixed point update gamma + w*f is corrected with the
+    // history of the last iterates, so that the least squares combination of the previous residuals is
+    // eliminated. The history is restarted when the residual grows or the least squares problem fails, in
+    // that case the plain relaxed update is used.
+
+    const int depth = 5;
+    const int num = gamma.size();
+    const double relax = m_QTurbine->m_relaxationFactor;
+
+    QVector<double> gammaNew(num);
+    for (int i=0;i<num;i++) gammaNew[i] = gamma[i] + relax*residual[i];
 
-            if(fabs((m_StrutPanel[i]->m_Gamma - m_StrutPanel[i]->m_Gamma_last_iteration)/m_StrutPanel[i]->m_Gamma_last_iteration) > m_QTurbine->m_epsilon){
-                m_bAllConverged = false;
-                m_StrutPanel[i]->m_isConverged = false;
+    if (m_AndersonX.size() == num){
+
+        double norm = 0, normOld = 0;
+        for (int i=0;i<num;i++){
+            norm += residual[i]*residual[i];
+            normOld += m_AndersonF[i]*m_AndersonF[i];
+        }
+
+        if (norm > 4.0*normOld){
+            m_AndersonDX.clear();
+            m_AndersonDF.clear();
+        }
+        else{
+            QVector<double> dx(num), df(num);
+            for (int i=0;i<num;i++){
+                dx[i] = gamma[i]-m_AndersonX[i];
+                df[i] = residual[i]-m_AndersonF[i];
+            }
+            m_AndersonDX.append(dx);
+            m_AndersonDF.append(df);
+            if (m_AndersonDX.size() > depth){
+                m_AndersonDX.removeFirst();
+                m_AndersonDF.removeFirst();
             }
-            m_StrutPanel[i]->m_Gamma_last_iteration = m_StrutPanel[i]->m_Gamma;
         }
     }
+
+    m_AndersonX = gamma;
+    m_AndersonF = residual;
+
+    const int m = m_AndersonDF.size();
+    if (!m) return gammaNew;
+
+    Eigen::MatrixXd DF(num,m);
+    Eigen::VectorXd F(num);
+    for (int i=0;i<num;i++){
+        F(i) = residual[i];
+        for (int j=0;j<m;j++) DF(i,j) = m_AndersonDF[j][i];
+    }
+
+    Eigen::VectorXd coeff = DF.colPivHouseholderQr().solve(F);
+
+    QVector<double> gammaAcc = gammaNew;
+    for (int j=0;j<m;j++)
+        for (int i=0;i<num;i++)
+            gammaAcc[i] -= (m_AndersonDX[j][i] + relax*m_AndersonDF[j][i])*coeff(j);
+
+    for (int i=0;i<num;i++){
+        if (std::isnan(gammaAcc[i]) || std::isinf(gammaAcc[i])){
+            m_AndersonDX.clear();
+            m_AndersonDF.clear();
+            return gammaNew;
+        }
+    }
+
+    return gammaAcc;
+}
+
+void QTurbineSimulationData::assembleBoundInfluenceMatrix(){
+
+    // the induction of the bound vorticity is linear in the panel circulation, for the fixed geometry of a
+    // timestep the blade self induction is stored as matrix of unit circulation velocities; rows are the
+    // blade and strut control points of this turbine, columns are the blade and (if strut lift is enabled)
+    // strut panels
+
+    QList<VortexPanel*> *panels;
+    if (m_QSim->isWakeInteraction())
+        panels = &m_QSim->m_globalBladePanel;
+    else
+        panels = &m_BladePanel;
+
+    QList<VortexPanel*> *strutPanels;
+    if (m_QSim->isWakeInteraction())
+        strutPanels = &m_QSim->m_globalStrutPanel;
+    else
+        strutPanels = &m_StrutPanel;
+
+    m_BoundInfluencePanels = *panels;
+    if (m_QTurbine->m_bcalculateStrutLift) m_BoundInfluencePanels.append(*strutPanels);
+
+    int numBladeColumns = panels->size();
+    int numColumns = m_BoundInfluencePanels.size();
+    int numRows = m_BladePanel.size() + m_StrutPanel.size();
+
+    if (m_BoundInfluence.size() < numRows*numColumns) m_BoundInfluence.resize(numRows*numColumns);
+    Vec3 *influence = m_BoundInfluence.data();
+
+    #pragma omp parallel default (none) shared (influence, numBladeColumns, numColumns, numRows)
+    {
+    #pragma omp for
+        for (int row=0;row<numRows;row++){
+            Vec3 EvalPt;
+            if (row < m_BladePanel.size()) EvalPt = m_BladePanel.at(row)->CtrlPt;
+            else EvalPt = m_StrutPanel.at(row-m_BladePanel.size())->CtrlPt;
+
+            for (int col=0;col<numColumns;col++)
+                influence[row*numColumns+col] = boundPanelInfluence(EvalPt,m_BoundInfluencePanels.at(col),col >= numBladeColumns);
+        }
+    }
+}
+
+Vec3 QTurbineSimulationData::boundPanelInfluence(Vec3 EvalPt, VortexPanel *panel, bool isStrut){
+
+    // induction of a single panel with unit circulation, same elements as packed in packBoundLineArrays(true)
+
+    double coreSizeSquared = pow(panel->chord*m_QTurbine->m_coreRadiusChordFractionBound,2);
+
+    bool closingLine;
+    if (isStrut) closingLine = m_QTurbine->m_bShed && m_WakeLine.size() == 0;
+    else closingLine = m_QTurbine->m_bShed && (m_WakeLine.size() + m_WakeParticles.size()) == 0;
+
+    Vec3 influence(0,0,0);
+
+    int numImages = m_QSim->m_bincludeGround ? 2 : 1;
+
+    for (int k=0;k<numImages;k++){
+
+        // k == 1: panel mirrored at the ground with opposite circulation
+        double sign = k ? -1.0 : 1.0;
+
+        Vec3 R1 = EvalPt - Vec3(panel->VortPtA.x, panel->VortPtA.y, sign*panel->VortPtA.z);
+        Vec3 R2 = EvalPt - Vec3(panel->VortPtB.x, panel->VortPtB.y, sign*panel->VortPtB.z);
+        Vec3 R3 = EvalPt - Vec3(panel->pTB->x, panel->pTB->y, sign*panel->pTB->z);
+        Vec3 R4 = EvalPt - Vec3(panel->pTA->x, panel->pTA->y, sign*panel->pTA->z);
+
+        influence += biotSavartLineKernel(R1,R2,sign,coreSizeSquared);
+        if (closingLine) influence += biotSavartLineKernel(R3,R4,sign,coreSizeSquared);
+        influence += biotSavartLineKernel(R4,R1,sign,coreSizeSquared);
+        influence += biotSavartLineKernel(R2,R3,sign,coreSizeSquared);
+    }
+
+    return influence;
+}
+
+Vec3 QTurbineSimulationData::calculateBladeInductionFromMatrix(int row){
+
+    const int numColumns = m_BoundInfluencePanels.size();
+    const Vec3 *influence = m_BoundInfluence.constData() + row*numColumns;
+
+    double vx = 0, vy = 0, vz = 0;
+
+    for (int col=0;col<numColumns;col++){
+        const double gamma = m_BoundInfluencePanels.at(col)->m_Gamma;
+        vx += influence[col].x*gamma;
+        vy += influence[col].y*gamma;
+        vz += influence[col].z*gamma;
+    }
+
+    return Vec3(vx,vy,vz);
 }
 
 void QTurbineSimulationData::strutIterationLoop(){
@@ -4979,7 +5500,7 @@ void QTurbineSimulationData::calcDynamicBladeCoefficients(){
             tsr = m_QTurbine->m_CurrentOmega *m_QTurbine->m_Blade->m_MaxRadius / getFreeStream(m_QTurbine->m_hubCoordsFixed.Origin).VAbs();
         }
 
-        QList<double> parameters = m_QTurbine->m_Blade->getBladeParameters(m_BladePanel[i]->fromBladelength,m_BladePanel[i]->m_AoA75,true,m_BladePanel[i]->chord*m_BladePanel[i]->m_V_inPlane.VAbs()/m_kinematicViscosity,m_QTurbine->m_bincludeHimmelskamp,tsr,&m_AFCList[m_BladePanel[i]->fromBlade],0,m_BladePanel[i]->fromBlade);
+        BladeParameters parameters = m_QTurbine->m_Blade->getBladeParameters(m_BladePanel[i]->fromBladelength,m_BladePanel[i]->m_AoA75,true,m_BladePanel[i]->chord*m_BladePanel[i]->m_V_inPlane.VAbs()/m_kinematicViscosity,m_QTurbine->m_bincludeHimmelskamp,tsr,&m_AFCList[m_BladePanel[i]->fromBlade],0,m_BladePanel[i]->fromBlade);
 
         if (parameters.at(9)==true && m_QTurbine->m_dynamicStallType == ATEFLAP)
             CalcATEFLAPDynamicStall(parameters, m_BladePanel[i]);
@@ -5173,7 +5694,7 @@ void QTurbineSimulationData::calcDynamicStrutCoefficients(){
 
         double length = (m_StrutPanel[i]->fromStation+0.5) / m_QTurbine->m_numStrutPanels;
 
-        QList<double> parameters = m_QTurbine->m_Blade->getStrutParameters(m_StrutPanel[i]->fromStrut,m_StrutPanel[i]->m_AoA75,reynolds,length);
+        BladeParameters parameters = m_QTurbine->m_Blade->getStrutParameters(m_StrutPanel[i]->fromStrut,m_StrutPanel[i]->m_AoA75,reynolds,length);
 
         if (parameters.at(9)==true && m_QTurbine->m_dynamicStallType == ATEFLAP)
             CalcATEFLAPDynamicStall(parameters, m_BladePanel[i]);
@@ -5202,7 +5723,7 @@ void QTurbineSimulationData::calcDynamicStrutCoefficients(){
 
 }
 
-void QTurbineSimulationData::CalcOyeDynamicStall(QList<double> parameters, VortexPanel *panel){
+void QTurbineSimulationData::CalcOyeDynamicStall(BladeParameters parameters, VortexPanel *panel){
 
     double slope = parameters.at(8);
 
@@ -5241,7 +5762,7 @@ void QTurbineSimulationData::CalcOyeDynamicStall(QList<double> parameters, Vorte
 
 }
 
-void QTurbineSimulationData::CalcATEFLAPDynamicStall(QList<double> parameters, VortexPanel *panel){
+void QTurbineSimulationData::CalcATEFLAPDynamicStall(BladeParameters parameters, VortexPanel *panel){
 
     double ClE = parameters.at(0);
     double CdE = parameters.at(1);
@@ -5316,7 +5837,7 @@ void QTurbineSimulationData::CalcATEFLAPDynamicStall(QList<double> parameters, V
         double angleE = angleQS*(1-A1-A2-A3) + panel->x[3] + panel->x[4] + panel->x[5];
 
         // GET PROPERTIES
-        QList<double> noFlapParams;
+        BladeParameters noFlapParams;
         if (panel->m_AFC){//parameters at eff. beta
             if (m_currentTimeStep == 0) panel->m_AFC->state_eff = panel->m_AFC->state;
             parameters = m_QTurbine->m_Blade->getBladeParameters(panel->fromBladelength,angleE,true,panel->chord*panel->m_V_inPlane.VAbs()/m_kinematicViscosity,m_QTurbine->m_bincludeHimmelskamp,tsr,&m_AFCList[panel->fromBlade],panel->m_AFC->state,panel->fromBlade);
@@ -5569,7 +6090,7 @@ void QTurbineSimulationData::CalcATEFLAPDynamicStall(QList<double> parameters, V
 
 }
 
-void QTurbineSimulationData::CalcGormontBergDynamicStall(QList<double> parameters, VortexPanel *panel){
+void QTurbineSimulationData::CalcGormontBergDynamicStall(BladeParameters parameters, VortexPanel *panel){
 
     double ClE = parameters.at(0);
     double CdE = parameters.at(1);
@@ -5862,13 +6383,14 @@ double QTurbineSimulationData::PanelLengthToIntegrate(VortexPanel* panel, double
 
 void QTurbineSimulationData::ComputeCutPlaneVelocitiesOpenMP(QVelocityCutPlane *plane, int timestep){
 
+    packSavedGeometryArrays(timestep);
 
     #pragma omp parallel default (none) shared (plane, timestep)
     {
         #pragma omp for
         for (int i=0;i<plane->m_points.size();i++){
             for (int j=0;j<plane->m_points.at(i).size();j++){
-                plane->m_velocities[i][j] += CalculateWakeInductionFromSavedGeometry(Vec3(plane->m_points[i][j]),timestep);
+                plane->m_velocities[i][j] += CalculateWakeInductionFromSavedArrays(Vec3(plane->m_points[i][j]));
             }
         }
     }
@@ -6017,6 +6539,39 @@ Vec3 QTurbineSimulationData::CalculateWakeInductionFromSavedGeometry (Vec3 EvalP
     return VGamma_total;
 }
 
+void QTurbineSimulationData::packSavedGeometryArrays(int timeStep){
+
+    // packs the stored vortex lines and particles of a timestep for CalculateWakeInductionFromSavedArrays()
+
+    m_SavedLineArrays.Clear();
+    m_SavedParticleArrays.Clear();
+
+    if (timeStep >= m_savedBladeVortexLines.size()) return;
+
+    for(int ID=0;ID<m_savedBladeVortexLines.at(timeStep).size();ID++){
+        const DummyLine &line = m_savedBladeVortexLines.at(timeStep).at(ID);
+        m_SavedLineArrays.Append(Vec3(line.Lx,line.Ly,line.Lz),Vec3(line.Tx,line.Ty,line.Tz),line.Gamma,line.CoreSizeSquared);
+    }
+
+    for(int ID=0;ID<m_savedWakeLines.at(timeStep).size();ID++){
+        const DummyLine &line = m_savedWakeLines.at(timeStep).at(ID);
+        m_SavedLineArrays.Append(Vec3(line.Lx,line.Ly,line.Lz),Vec3(line.Tx,line.Ty,line.Tz),line.Gamma,line.CoreSizeSquared);
+    }
+
+    m_SavedParticleArrays.Pack(m_savedWakeParticles.at(timeStep));
+}
+
+Vec3 QTurbineSimulationData::CalculateWakeInductionFromSavedArrays (Vec3 EvalPt) {
+
+    // vectorized version of CalculateWakeInductionFromSavedGeometry(), the arrays are filled in packSavedGeometryArrays()
+
+    Vec3 VGamma_total = biotSavartLineInduction(m_SavedLineArrays,EvalPt) + biotSavartParticleInduction(m_SavedParticleArrays,EvalPt);
+
+    if (m_QTurbine->m_QSim->m_bincludeGround)
+        VGamma_total += biotSavartLineInduction(m_SavedLineArrays,EvalPt,true) + biotSavartParticleInduction(m_SavedParticleArrays,EvalPt,true);
+
+    return VGamma_total;
+}
 
 void QTurbineSimulationData::ComputeVolumeWakeLineVelocitiesOpenCL(Vec3*** positions, Vec3*** velocities, int XSTART, int XEND, int YR, int ZR, int timestep){
 
@@ -6104,6 +6659,8 @@ void QTurbineSimulationData::ComputeVolumeWakeLineVelocitiesOpenCL(Vec3*** posit
 
 void QTurbineSimulationData::ComputeVolumeVelocitiesOpenMP(Vec3*** positions, Vec3*** velocities, int XSTART, int XEND, int YR, int ZR, int timestep){
 
+    packSavedGeometryArrays(timestep);
+
     int XDELTA = XEND-XSTART;
     #pragma omp parallel default (none) shared (positions, velocities, YR, ZR, timestep, XDELTA, XSTART)
     {
@@ -6111,7 +6668,7 @@ void QTurbineSimulationData::ComputeVolumeVelocitiesOpenMP(Vec3*** positions, Ve
         for (int i=0;i<XDELTA;i++){
             for (int j=0;j<YR;j++){
                 for (int k=0;k<ZR;k++){
-                velocities[i+XSTART][j][k] += CalculateWakeInductionFromSavedGeometry(positions[i+XSTART][j][k],timestep);
+                velocities[i+XSTART][j][k] += CalculateWakeInductionFromSavedArrays(positions[i+XSTART][j][k]);
                 }
             }
         }
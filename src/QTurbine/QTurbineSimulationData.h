@@ -23,6 +23,7 @@
 #include "src/VortexObjects/VortexLine.h"
 #include "src/VortexObjects/DummyLine.h"
 #include "src/VortexObjects/VortexParticle.h"
+#include "src/VortexObjects/VortexLineArrays.h"
 #include "src/QBEM/AFC.h"
 #include "src/OpenCLSetup.h"
 #include "src/QControl/QControl.h"
@@ -32,6 +33,7 @@ class VortexPanel;
 class QTurbine;
 class QSimulation;
 class QVelocityCutPlane;
+struct BladeParameters;
 
 
 class QTurbineSimulationData
@@ -52,6 +54,7 @@ public:
     double m_AzimuthAtStart;
     int m_iterations;
     bool m_bAllConverged;
+    float m_gammaIterationTime;     // wall time of the last gamma iteration [ms]
 
     bool m_bAbort;
     bool m_bStrModelInitialized;
@@ -65,6 +68,15 @@ public:
     QList <VortexNode *> m_WakeNode;
     QList <VortexNode *> m_StrutNode;
     QList <VortexParticle *> m_WakeParticles;
+    VortexLineArrays m_WakeLineArrays;  //packed copy of the wake lines, only valid during the induction evaluation
+    VortexParticleArrays m_WakeParticleArrays;  //packed copy of the wake particles, only valid during the induction evaluation
+    VortexLineArrays m_BoundLineArrays;  //packed bound and near wake vortex lines of the blade and strut panels
+    VortexLineArrays m_SavedLineArrays;  //packed lines of a stored timestep, used for the cut planes and volumes
+    VortexParticleArrays m_SavedParticleArrays;
+    QVector<Vec3> m_BoundInfluence;  //influence matrix of the bound vorticity on the blade and strut control points, assembled once per timestep
+    QList<VortexPanel *> m_BoundInfluencePanels;  //panels that form the columns of the influence matrix
+    QList<QVector<double> > m_AndersonDX, m_AndersonDF;  //Anderson acceleration history of the gamma iteration
+    QVector<double> m_AndersonX, m_AndersonF;
     QList<QList <VortexParticle> > m_savedWakeParticles;
     QList<QList <DummyLine> > m_savedBladeVortexLines;
     QList<QList <DummyLine> > m_savedWakeLines;
@@ -141,6 +153,7 @@ public:
     void InitializePanelPositions();
     bool UpdateRotorGeometry();
     void storeGeometry(bool storeReplay = false);
+    void trimReplayData(int numSteps);
     Vec3 CorrespondingAxisPoint(Vec3 Point, Vec3 Line1, Vec3 Line2);
     QList<double> GetCurrentPlatformOrientation(double time);
 
@@ -179,13 +192,16 @@ public:
     void checkWakeForSanity();
     void PC2BIntegration();
     void gammaBoundFixedPointIteration();
-    void steadyStateBEMIterationDTU(double tsr);
-    void steadyStateBEMIterationClassic(double tsr);
+    void steadyStateBEMIterationDTU(double tsr, QVector<Vec3> *induction = NULL);       // induction: (axial, tangential, radial) factors of the blade panels,
+    void steadyStateBEMIterationClassic(double tsr, QVector<Vec3> *induction = NULL);   // used as initial guess if the size matches and overwritten with the result
     void assignVelocitiesToWakeElements(QList<Vec3> *velocities);
     void wakeInductionOpenMP(QList<Vec3> *positions, QList<Vec3> *velocities);
     void wakeInductionSingleCore(QList<Vec3> *positions, QList<Vec3> *velocities);
+    void wakeInductionTreecode(QList<Vec3> *positions, QList<Vec3> *velocities);
+    void packWakeArrays();
     void addFreestreamVelocities(QList<Vec3> *positions, QList<Vec3> *velocities);
     void addBladeInductionVelocities(QList<Vec3> *positions, QList<Vec3> *velocities);
+    void packBoundLineArrays(bool indWing = false);
     void wakeLineInductionOpenCL(QList<Vec3> *positions, QList<Vec3> *velocities, bool includeWake = true, bool includeBlade = true);
     void executeClKernel(cl_float3 *Positions, cl_float3 *Velocities, cl_float4 *Vort1, cl_float4 *Vort2, int num_pos, int num_elems, int loc_size);    void fillWakePositionAndVelocityLists(QList<Vec3> *positions, QList<Vec3> *velocities);
     void calcBladePanelVelocities();
@@ -196,6 +212,10 @@ public:
     void calcStrutPanelVelocities();
     void calcStrutCirculation();
     void gammaConvergenceCheck(bool iterateBEM);
+    void assembleBoundInfluenceMatrix();
+    Vec3 boundPanelInfluence(Vec3 EvalPt, VortexPanel *panel, bool isStrut);
+    Vec3 calculateBladeInductionFromMatrix(int row);
+    QVector<double> andersonGammaUpdate(QVector<double> const &gamma, QVector<double> const &residual);
     void CheckNaNCdCl(int i, bool blade = true) ;
     void CheckNaNVelocity(int i, bool blade = true);
 
@@ -203,9 +223,9 @@ public:
     void calcDynamicStrutCoefficients();
     void strutIterationLoop();
 
-    void CalcOyeDynamicStall(QList<double> parameters, VortexPanel *panel);
-    void CalcGormontBergDynamicStall(QList<double> parameters, VortexPanel *panel);
-    void CalcATEFLAPDynamicStall(QList<double> parameters, VortexPanel *panel);
+    void CalcOyeDynamicStall(BladeParameters parameters, VortexPanel *panel);
+    void CalcGormontBergDynamicStall(BladeParameters parameters, VortexPanel *panel);
+    void CalcATEFLAPDynamicStall(BladeParameters parameters, VortexPanel *panel);
 
     void storeDSVars();
     void assignGammaToWingLines();
@@ -246,11 +266,11 @@ public:
 
 
     Vec3 calculateWakeInduction(Vec3 EvalPt, VortexPanel *panel = NULL, VortexParticle *particle = NULL);
-    Vec3 calculateBladeInduction(Vec3 EvalPt, bool indWing = false);
     Vec3 biotSavartLineKernel(Vec3 r1, Vec3 r2, float Gamma, float coreSizeSquared);
     Vec3 biotSavartParticleKernel(Vec3f x, VortexParticle *particle_q, int k_type, VortexParticle *particle_p);
     Vec3 calcTowerInfluence (Vec3 EvalPt, Vec3 V_ref, int timestep = -1);
     Vec3 getFreeStream(Vec3 EvalPt, double time = -1);
+    void getFreeStream(QVector<Vec3> const &EvalPts, QVector<Vec3> &V_free, double time = -1);
     Vec3 getFreeStreamAcceleration (Vec3 EvalPt, double time);
     Vec3 getMeanFreeStream(Vec3 EvalPt);
 
@@ -259,6 +279,8 @@ public:
     void ComputeVolumeVelocitiesOpenMP(Vec3*** positions, Vec3*** velocities, int XSTART, int XEND, int YR, int ZR, int timestep);
     void ComputeVolumeWakeLineVelocitiesOpenCL(Vec3*** positions, Vec3*** velocities, int XSTART, int XEND, int YR, int ZR, int timestep);
     Vec3 CalculateWakeInductionFromSavedGeometry (Vec3 EvalPt, int timeStep);
+    void packSavedGeometryArrays(int timeStep);
+    Vec3 CalculateWakeInductionFromSavedArrays (Vec3 EvalPt);
 
 
     double m_steadyBEMVelocity;
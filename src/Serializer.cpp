@@ -22,6 +22,7 @@
 #include <QColor>
 #include <QPen>
 #include <QBitArray>
+#include <QtEndian>
 #include "src/Globals.h"
 #include "src/GlobalFunctions.h"
 #include "StorableObject.h"
@@ -232,16 +233,6 @@ void Serializer::readOrWriteCVectorArray3D (Vec3 ****array, int dim1, int dim2,
     }
 }
 
-void Serializer::readOrWriteCVectoriArray3D (Vec3i ****array, int dim1, int dim2, int dim3) {
-    if (m_isReadMode) {
-        *array = new Vec3i**[dim1];
-    }
-
-    for (int i = 0; i < dim1; ++i) {
-        readOrWriteCVectoriArray2D (&((*array)[i]), dim2, dim3);
-    }
-}
-
 void Serializer::readOrWriteCVectorfVector2D(QVector< QVector< Vec3f > > *vector){
     if (m_isReadMode) {
         int n = readInt();
@@ -769,8 +760,121 @@ void Serializer::readOrWriteCompressedVortexParticleList2D(QList<QList<VortexPar
 
 }
 
+// Block format of the compressed results (archive format >= 310009): the values are quantized to 16 bit as in the
+// previous format, delta encoded and deflated (qCompress) as one block instead of being streamed value by value.
+// A block holds one or more channels as [int32 size, float slope, float intercept, size * int16 delta], little endian.
+// The blocks of a 2D or 3D results vector are independent, so they are encoded and decoded in parallel.
+
+static void appendResultsRecord(QByteArray &raw, const QVector<float> &vector){
+
+    float min = 0, max = 0;
+    if (vector.size()){
+        min = max = vector.at(0);
+        for (int i=1;i<vector.size();i++){
+            if (vector.at(i) < min) min = vector.at(i);
+            if (vector.at(i) > max) max = vector.at(i);
+        }
+    }
+
+    double dmin = min, dmax = max;
+    if (dmin == dmax) dmin = dmax - 1.;
+    float slope = 65535.0 / ( dmax - dmin );
+    float intercept = - 32768 - slope * dmin;
+
+    const int offset = raw.size();
+    raw.resize(offset + 3*4 + 2*vector.size());
+    uchar *data = reinterpret_cast<uchar *>(raw.data() + offset);
+
+    quint32 bits;
+    qToLittleEndian<qint32>(vector.size(), data);
+    memcpy(&bits, &slope, 4);
+    qToLittleEndian<quint32>(bits, data+4);
+    memcpy(&bits, &intercept, 4);
+    qToLittleEndian<quint32>(bits, data+8);
+
+    data += 12;
+    quint16 previous = 0;
+    for (int i=0;i<vector.size();i++){
+        int test = vector.at(i) * slope + intercept;
+        if (test > 32767) test = 32767; // prevent overflow
+        const quint16 value = quint16(qint16(test));
+        qToLittleEndian<quint16>(quint16(value - previous), data + 2*i);
+        previous = value;
+    }
+}
+
+static bool readResultsRecord(const uchar *&data, const uchar *end, QVector<float> &vector){
+
+    if (end - data < 12) return false;
+
+    const int n = qFromLittleEndian<qint32>(data);
+    quint32 bits;
+    float slope, intercept;
+    bits = qFromLittleEndian<quint32>(data+4);
+    memcpy(&slope, &bits, 4);
+    bits = qFromLittleEndian<quint32>(data+8);
+    memcpy(&intercept, &bits, 4);
+    data += 12;
+
+    if (n < 0 || end - data < 2*n) return false;
+
+    vector.resize(n);
+    float *out = vector.data();
+    quint16 value = 0;
+    for (int i=0;i<n;i++){
+        value += qFromLittleEndian<quint16>(data + 2*i);
+        out[i] = float(qint16(value) - intercept) / slope;
+    }
+    data += 2*n;
+
+    return true;
+}
+
+static QByteArray encodeResultsBlock(const QVector<float> *channels, int num){
+
+    QByteArray raw(4, 0);
+    qToLittleEndian<qint32>(num, reinterpret_cast<uchar *>(raw.data()));
+    for (int i=0;i<num;i++) appendResultsRecord(raw, channels[i]);
+
+    return qCompress(raw, 1);
+}
+
+static bool decodeResultsBlock(const QByteArray &block, QVector<QVector<float> > &channels){
+
+    const QByteArray raw = qUncompress(block);
+    if (raw.size() < 4) return false;
+
+    const uchar *data = reinterpret_cast<const uchar *>(raw.constData());
+    const uchar *end = data + raw.size();
+
+    const int num = qFromLittleEndian<qint32>(data);
+    data += 4;
+    if (num < 0) return false;
+
+    channels.resize(num);
+    for (int i=0;i<num;i++)
+        if (!readResultsRecord(data, end, channels[i])) return false;
+
+    return true;
+}
+
 void Serializer::readOrWriteCompressedResultsVector1D(QVector<float> *resultsVector){
 
+    if (m_archiveFormat >= 310009){
+
+        if (m_isReadMode){
+            QByteArray block;
+            *m_stream >> block;
+            QVector<QVector<float> > channels;
+            if (!decodeResultsBlock(block, channels) || channels.size() != 1) throw Exception("Corrupted results block in project file!");
+            resultsVector->append(channels.at(0));
+        }
+        else{
+            *m_stream << encodeResultsBlock(resultsVector, 1);
+        }
+        return;
+    }
+
     float intercept;
     float slope;
 
@@ -810,6 +914,51 @@ void Serializer::readOrWriteCompressedResultsVector1D(QVector<float> *resultsVec
 
 void Serializer::readOrWriteCompressedResultsVector2D(QVector<QVector<float> > *resultsVector){
 
+    if (m_archiveFormat >= 310009){
+
+        // one block per channel
+
+        if (m_isReadMode){
+            int n = readInt();
+            QVector<QByteArray> blocks(n);
+            for (int i=0;i<n;i++) *m_stream >> blocks[i];
+
+            const int offset = resultsVector->size();
+            resultsVector->resize(offset+n);
+            QVector<float> *channels = resultsVector->data() + offset;
+            bool valid = true;
+
+            #pragma omp parallel default (none) shared (n, blocks, channels) reduction (&&:valid)
+            {
+                #pragma omp for schedule(dynamic)
+                for (int i=0;i<n;i++){
+                    QVector<QVector<float> > decoded;
+                    if (decodeResultsBlock(blocks.at(i), decoded) && decoded.size() == 1) channels[i] = decoded.at(0);
+                    else valid = false;
+                }
+            }
+
+            if (!valid) throw Exception("Corrupted results block in project file!");
+        }
+        else{
+            int n = resultsVector->size();
+            QVector<QByteArray> blocks(n);
+            QByteArray *blockData = blocks.data();
+            const QVector<float> *channels = resultsVector->constData();
+
+            #pragma omp parallel default (none) shared (n, blockData, channels)
+            {
+                #pragma omp for schedule(dynamic)
+                for (int i=0;i<n;i++)
+                    blockData[i] = encodeResultsBlock(channels+i, 1);
+            }
+
+            writeInt(n);
+            for (int i=0;i<n;i++) *m_stream << blocks.at(i);
+        }
+        return;
+    }
+
     if (m_isReadMode){
         int n = readInt();
         for (int i = 0; i < n; ++i) {
@@ -827,7 +976,65 @@ void Serializer::readOrWriteCompressedResultsVector2D(QVector<QVector<float> > *
 
 }
 
-void Serializer::readOrWriteCompressedResultsVector3D(QVector<QVector<QVector<float> > > *resultsVector){
+bool Serializer::decodeCompressedResultsBlocks(const QVector<QByteArray> &blocks, QVector<QVector<QVector<float> > > *resultsVector){
+
+    const int n = blocks.size();
+    const int offset = resultsVector->size();
+    resultsVector->resize(offset+n);
+    QVector<QVector<float> > *entries = resultsVector->data() + offset;
+    bool valid = true;
+
+    #pragma omp parallel default (none) shared (n, blocks, entries) reduction (&&:valid)
+    {
+        #pragma omp for schedule(dynamic)
+        for (int i=0;i<n;i++)
+            if (!decodeResultsBlock(blocks.at(i), entries[i])) valid = false;
+    }
+
+    return valid;
+}
+
+void Serializer::readOrWriteCompressedResultsVector3D(QVector<QVector<QVector<float> > > *resultsVector, QVector<QByteArray> *lazyBlocks){
+
+    if (m_archiveFormat >= 310009){
+
+        // one block per entry of the outer dimension (the timesteps of the blade data); if lazyBlocks is given the
+        // blocks are only read into it and decoded on first access with decodeCompressedResultsBlocks(), blocks that
+        // are still pending when the object is written are stored as they are, in front of the decoded entries
+
+        if (m_isReadMode){
+            int n = readInt();
+            QVector<QByteArray> blocks(n);
+            for (int i=0;i<n;i++) *m_stream >> blocks[i];
+
+            if (lazyBlocks){
+                lazyBlocks->append(blocks);
+                return;
+            }
+
+            if (!decodeCompressedResultsBlocks(blocks, resultsVector)) throw Exception("Corrupted results block in project file!");
+        }
+        else{
+            int n = resultsVector->size();
+            QVector<QByteArray> blocks(n);
+            QByteArray *blockData = blocks.data();
+            const QVector<QVector<float> > *entries = resultsVector->constData();
+
+            #pragma omp parallel default (none) shared (n, blockData, entries)
+            {
+                #pragma omp for schedule(dynamic)
+                for (int i=0;i<n;i++)
+                    blockData[i] = encodeResultsBlock(entries[i].constData(), entries[i].size());
+            }
+
+            const int numPending = lazyBlocks ? lazyBlocks->size() : 0;
+
+            writeInt(numPending+n);
+            for (int i=0;i<numPending;i++) *m_stream << lazyBlocks->at(i);
+            for (int i=0;i<n;i++) *m_stream << blocks.at(i);
+        }
+        return;
+    }
 
     if (m_isReadMode){
         int n = readInt();
@@ -81,7 +81,6 @@ public:
     void readOrWriteCVectorArray2D (Vec3***, int, int);
     void readOrWriteCVectoriArray2D (Vec3i***, int, int);
     void readOrWriteCVectorArray3D (Vec3****, int, int, int);
-    void readOrWriteCVectoriArray3D (Vec3i****, int, int, int);
     void readOrWriteCVectorVector1D(QVector< Vec3 > *vector);
     void readOrWriteCVectorVector2D(QVector< QVector< Vec3 > > *vector);
     void readOrWriteCVectorfVector2D(QVector< QVector< Vec3f > > *vector);
@@ -110,7 +109,8 @@ public:
 	void readOrWriteBitArray (QBitArray*);
     void readOrWriteCompressedResultsVector1D(QVector<float> *resultsVector);
     void readOrWriteCompressedResultsVector2D(QVector<QVector<float> > *resultsVector);
-    void readOrWriteCompressedResultsVector3D(QVector<QVector<QVector<float> > > *resultsVector);
+    void readOrWriteCompressedResultsVector3D(QVector<QVector<QVector<float> > > *resultsVector, QVector<QByteArray> *lazyBlocks = NULL);
+    static bool decodeCompressedResultsBlocks(const QVector<QByteArray> &blocks, QVector<QVector<QVector<float> > > *resultsVector);
     void readOrWriteDummyLineList2D(QList<QList<DummyLine> > &lineList);
     void readOrWriteVortexParticleList2D(QList<QList<VortexParticle> > &particlelist);
     void readOrWriteVizBeamList2D(QList<QList<VizBeam>> &beamlist);
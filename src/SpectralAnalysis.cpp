@@ -0,0 +1,230 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "SpectralAnalysis.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <cmath>
+
+#include "src/Globals.h"
+
+static QHash<int, QSharedPointer<FFTPlan> > planCache;
+static QMutex planCacheMutex;
+
+QSharedPointer<FFTPlan> FFTPlan::getPlan(int size){
+
+    {
+        QMutexLocker locker(&planCacheMutex);
+        if (planCache.contains(size)) return planCache.value(size);
+    }
+
+    // the plan is constructed outside of the lock, a Bluestein plan requests the plan of its convolution length
+
+    QSharedPointer<FFTPlan> plan(new FFTPlan(size));
+
+    QMutexLocker locker(&planCacheMutex);
+    if (planCache.contains(size)) return planCache.value(size);
+    if (planCache.size() >= 32) planCache.clear(); // plans that are still in use are kept alive by their shared pointers
+    planCache.insert(size, plan);
+
+    return plan;
+}
+
+void FFTPlan::clearCache(){
+
+    QMutexLocker locker(&planCacheMutex);
+    planCache.clear();
+}
+
+FFTPlan::FFTPlan(int size){
+
+    m_size = size;
+    m_isRadix2 = (size & (size-1)) == 0;
+
+    if (size < 2) return;
+
+    if (m_isRadix2){
+
+        for (int i = 1, j = 0; i < size; i++){
+            int bit = size >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j){
+                m_swapFrom.append(i);
+                m_swapTo.append(j);
+            }
+        }
+
+        // the twiddle factors are evaluated once for the full length to avoid the error growth of a recursion
+        m_twiddle.resize(size/2);
+        for (int k = 0; k < size/2; k++)
+            m_twiddle[k] = std::complex<double>(cos(2.0*PI_*k/size), -sin(2.0*PI_*k/size));
+    }
+    else{
+
+        int conv = 1;
+        while (conv < 2*size-1) conv <<= 1;
+
+        m_convPlan = getPlan(conv);
+
+        // chirp w_n = exp(-i pi n^2 / N), n^2 is reduced modulo 2N to keep the argument accurate
+        m_chirp.resize(size);
+        for (int n = 0; n < size; n++){
+            const double arg = PI_ * double((qint64(n)*n) % (2*qint64(size))) / size;
+            m_chirp[n] = std::complex<double>(cos(arg), -sin(arg));
+        }
+
+        // transformed convolution filter, scaled with the normalization of the inverse transform
+        m_filter.fill(std::complex<double>(0,0), conv);
+        m_filter[0] = std::conj(m_chirp[0]);
+        for (int n = 1; n < size; n++) m_filter[n] = m_filter[conv-n] = std::conj(m_chirp[n]);
+        m_convPlan->Transform(m_filter.data());
+        for (int n = 0; n < conv; n++) m_filter[n] /= double(conv);
+    }
+}
+
+void FFTPlan::Transform(std::complex<double> *data, bool inverse) const{
+
+    // X_k = sum_n x_n exp(-+ 2 pi i k n / N), the inverse is evaluated as conj(FFT(conj(x)))
+
+    if (m_size < 2) return;
+
+    if (inverse) for (int i = 0; i < m_size; i++) data[i] = std::conj(data[i]);
+
+    if (m_isRadix2) TransformRadix2(data);
+    else TransformBluestein(data);
+
+    if (inverse) for (int i = 0; i < m_size; i++) data[i] = std::conj(data[i]);
+}
+
+void FFTPlan::TransformRadix2(std::complex<double> *data) const{
+
+    for (int i = 0; i < m_swapFrom.size(); i++) std::swap(data[m_swapFrom[i]], data[m_swapTo[i]]);
+
+    const std::complex<double> *twiddle = m_twiddle.constData();
+
+    for (int len = 2; len <= m_size; len <<= 1){
+        const int half = len/2;
+        const int stride = m_size/len;
+        for (int i = 0; i < m_size; i += len){
+            for (int k = 0; k < half; k++){
+                const std::complex<double> u = data[i+k];
+                const std::complex<double> v = data[i+k+half]*twiddle[k*stride];
+                data[i+k] = u+v;
+                data[i+k+half] = u-v;
+            }
+        }
+    }
+}
+
+void FFTPlan::TransformBluestein(std::complex<double> *data) const{
+
+    const int conv = m_convPlan->size();
+
+    QVector<std::complex<double> > a(conv, std::complex<double>(0,0));
+    for (int n = 0; n < m_size; n++) a[n] = data[n]*m_chirp[n];
+
+    m_convPlan->Transform(a.data());
+    for (int n = 0; n < conv; n++) a[n] *= m_filter[n];
+    m_convPlan->Transform(a.data(), true);
+
+    for (int n = 0; n < m_size; n++) data[n] = a[n]*m_chirp[n];
+}
+
+static double WindowFunction(int window, int n, int length){
+
+    switch (window){
+        case WINDOW_HANN: return 0.5 - 0.5*cos(2.0*PI_*n/length);
+        case WINDOW_HAMMING: return 0.54 - 0.46*cos(2.0*PI_*n/length);
+        default: return 1.0;
+    }
+}
+
+void CalculateWelchPSD(const float *data, int size, double dT, QVector<float> &freq, QVector<float> &psd, int segmentLength, double overlap, int window){
+
+    freq.clear();
+    psd.clear();
+
+    if (size < 2 || dT <= 0) return;
+
+    overlap = qBound(0.0, overlap, 0.95);
+
+    // default: 8 segments
+    if (segmentLength <= 0) segmentLength = int(size / (1.0 + 7.0*(1.0-overlap)));
+    segmentLength = qBound(2, segmentLength, size);
+
+    const int step = qMax(1, segmentLength - int(segmentLength*overlap));
+    const int numSegments = (size - segmentLength) / step + 1;
+    const int numBins = segmentLength/2+1;
+
+    QSharedPointer<FFTPlan> plan = FFTPlan::getPlan(segmentLength);
+
+    QVector<double> weights(segmentLength);
+    double windowPower = 0;
+    for (int n = 0; n < segmentLength; n++){
+        weights[n] = WindowFunction(window, n, segmentLength);
+        windowPower += weights[n]*weights[n];
+    }
+
+    QVector<double> accumulated(numBins, 0);
+    QVector<std::complex<double> > segment(segmentLength);
+
+    for (int s = 0; s < numSegments; s++){
+
+        const float *start = data + s*step;
+
+        double mean = 0;
+        for (int n = 0; n < segmentLength; n++) mean += start[n];
+        mean /= segmentLength;
+
+        for (int n = 0; n < segmentLength; n++) segment[n] = std::complex<double>((start[n]-mean)*weights[n], 0);
+
+        plan->Transform(segment.data());
+
+        for (int k = 0; k < numBins; k++) accumulated[k] += std::norm(segment[k]);
+    }
+
+    // one-sided normalization, the DC and Nyquist bins are not doubled
+    const double scale = dT / windowPower / numSegments;
+
+    freq.reserve(numBins-1);
+    psd.reserve(numBins-1);
+
+    for (int k = 1; k < numBins; k++){
+        const bool isNyquist = (segmentLength % 2 == 0) && (k == segmentLength/2);
+        freq.append(float(k / (segmentLength*dT)));
+        psd.append(float(accumulated[k] * scale * (isNyquist ? 1.0 : 2.0)));
+    }
+}
+
+void CalculateWelchPSDBatch(QList<QVector<float> > const &data, QList<double> const &dT, QList<QVector<float> > &freq, QList<QVector<float> > &psd, int segmentLength, double overlap, int window){
+
+    const int num = data.size();
+
+    QVector<QVector<float> > freqResult(num), psdResult(num);
+    QVector<float> *freqData = freqResult.data();
+    QVector<float> *psdData = psdResult.data();
+
+    #pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < num; i++)
+        CalculateWelchPSD(data.at(i).constData(), data.at(i).size(), dT.at(i), freqData[i], psdData[i], segmentLength, overlap, window);
+
+    freq = freqResult.toList();
+    psd = psdResult.toList();
+}
@@ -0,0 +1,70 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef SPECTRALANALYSIS_H
+#define SPECTRALANALYSIS_H
+
+#include <QVector>
+#include <QList>
+#include <QSharedPointer>
+#include <complex>
+
+// FFT based spectral analysis of time series. The FFT plans (bit reversal table, twiddle factors and
+// for non power of two lengths the Bluestein chirp and its transformed filter) are cached per signal
+// length, so that repeated evaluations of signals with the same length, e.g. redraws of a PSD graph,
+// only perform the transforms themselves.
+
+enum SPECTRALWINDOW {WINDOW_RECTANGULAR, WINDOW_HANN, WINDOW_HAMMING};
+
+class FFTPlan
+{
+public:
+    static QSharedPointer<FFTPlan> getPlan(int size);
+    static void clearCache();
+
+    void Transform(std::complex<double> *data, bool inverse = false) const;   // unnormalized in-place transform
+    int size() const { return m_size; }
+
+    FFTPlan(int size);
+
+private:
+    void TransformRadix2(std::complex<double> *data) const;
+    void TransformBluestein(std::complex<double> *data) const;
+
+    int m_size;
+    bool m_isRadix2;
+
+    // radix-2
+    QVector<int> m_swapFrom, m_swapTo;
+    QVector<std::complex<double> > m_twiddle;
+
+    // Bluestein
+    QSharedPointer<FFTPlan> m_convPlan;
+    QVector<std::complex<double> > m_chirp, m_filter;
+};
+
+// Welch estimate of the one-sided power spectral density [unit^2/Hz], the signal is split into
+// overlapping segments that are detrended (mean removed), windowed and transformed, the periodograms
+// are averaged; segmentLength = 0 selects 8 segments for the given overlap. The DC bin is omitted.
+void CalculateWelchPSD(const float *data, int size, double dT, QVector<float> &freq, QVector<float> &psd,
+                       int segmentLength = 0, double overlap = 0.5, int window = WINDOW_HANN);
+
+// PSD of several channels, evaluated in parallel
+void CalculateWelchPSDBatch(QList<QVector<float> > const &data, QList<double> const &dT, QList<QVector<float> > &freq, QList<QVector<float> > &psd,
+                            int segmentLength = 0, double overlap = 0.5, int window = WINDOW_HANN);
+
+#endif // SPECTRALANALYSIS_H
@@ -98,7 +98,8 @@ Store<T>::~Store() {
 template <class T>
 bool Store<T>::isLockedMessage() {
 	if (m_locked) {
-		QMessageBox::critical(g_mainFrame, tr("Warning"), m_lockMessage, QMessageBox::Ok);
+        if (isGUI) QMessageBox::critical(g_mainFrame, tr("Warning"), m_lockMessage, QMessageBox::Ok);
+        else qDebug().noquote() << "..." + m_lockMessage;
 		return true;
 	}
 	return false;
@@ -237,6 +238,15 @@ bool Store<T>::rename (T *objectToRename, QString newName) {
 		}
 	}
 	
+    if (!isGUI){
+        // no rename dialog without GUI, the object is stored under the next free name instead
+        QString baseName = newName.size() ? newName : objectToRename->getName();
+        int i = 1;
+        do newName = baseName + " (" + QString().number(i++) + ")";
+        while (isNameExisting(newName, objectToRename->getParent()));
+        return rename (objectToRename, newName);
+    }
+
 	bool renamed = false;
     RenameDialog<T> *dialog = new RenameDialog<T> (objectToRename, this, forceSaving, noOverwriting, newName);
     dialog->setWindowFlags(Qt::Dialog);
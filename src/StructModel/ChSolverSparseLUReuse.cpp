@@ -0,0 +1,97 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "ChSolverSparseLUReuse.h"
+
+namespace chrono {
+
+ChSolverSparseLUReuse::ChSolverSparseLUReuse() {
+    m_reuseFactorization = false;
+    m_factorizationReused = false;
+    m_isFactorized = false;
+    m_isAnalyzed = false;
+    m_analyzedDim = 0;
+    m_analyzedNonZeros = 0;
+    m_numFactorizations = 0;
+    m_numAnalyses = 0;
+}
+
+bool ChSolverSparseLUReuse::Setup(ChSystemDescriptor& sysd) {
+
+    // the old factorization is only reused if the problem size did not change and no update of the sparsity pattern
+    // was requested (this happens after structural failures or when constraints are removed)
+
+    m_factorizationReused = false;
+
+    if (m_reuseFactorization && m_isFactorized && !m_force_update){
+        if (sysd.CountActiveVariables() + sysd.CountActiveConstraints() == m_dim){
+            m_factorizationReused = true;
+            return true;
+        }
+    }
+
+    // a new sparsity pattern always requires a new symbolic factorization
+
+    if (m_force_update) m_isAnalyzed = false;
+
+    return ChDirectSolverLS::Setup(sysd);
+}
+
+bool ChSolverSparseLUReuse::FactorizeMatrix() {
+
+    // the column ordering and elimination tree only depend on the sparsity pattern; with a locked pattern the entries
+    // are only ever added, so an unchanged size and number of nonzeros means that the pattern is unchanged
+
+    if (!m_isAnalyzed || m_mat.rows() != m_analyzedDim || m_mat.nonZeros() != m_analyzedNonZeros){
+        m_engine.analyzePattern(m_mat);
+        m_analyzedDim = m_mat.rows();
+        m_analyzedNonZeros = m_mat.nonZeros();
+        m_isAnalyzed = true;
+        m_numAnalyses++;
+    }
+
+    m_engine.factorize(m_mat);
+    m_numFactorizations++;
+
+    m_isFactorized = (m_engine.info() == Eigen::Success);
+    if (!m_isFactorized) m_isAnalyzed = false;
+
+    return m_isFactorized;
+}
+
+bool ChSolverSparseLUReuse::SolveSystem() {
+    m_sol = m_engine.solve(m_rhs);
+    return (m_engine.info() == Eigen::Success);
+}
+
+void ChSolverSparseLUReuse::PrintErrorMessage() {
+    switch (m_engine.info()) {
+        case Eigen::Success:
+            GetLog() << "computation was successful\n";
+            break;
+        case Eigen::NumericalIssue:
+            GetLog() << "LU factorization reported a problem, zero diagonal for instance\n";
+            break;
+        case Eigen::InvalidInput:
+            GetLog() << "inputs are invalid, or the algorithm has been improperly called\n";
+            break;
+        default:
+            break;
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,58 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef CHSOLVERSPARSELUREUSE_H
+#define CHSOLVERSPARSELUREUSE_H
+
+#include "chrono/solver/ChDirectSolverLS.h"
+
+namespace chrono {
+
+// Sparse LU solver (Eigen SparseLU, as ChSolverSparseLU) that keeps the symbolic factorization as long as the sparsity
+// pattern of the system matrix does not change. With SetReuseFactorization(true) the numerical factorization of a
+// previous Setup() call is reused as well, the time integrator then performs a modified Newton iteration with the
+// Jacobian of an earlier step.
+
+class ChSolverSparseLUReuse : public ChDirectSolverLS {
+public:
+    ChSolverSparseLUReuse();
+    ~ChSolverSparseLUReuse() {}
+    virtual Type GetType() const override { return Type::SPARSE_LU; }
+
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+
+    void SetReuseFactorization(bool val) { m_reuseFactorization = val; }
+    bool IsFactorizationReused() const { return m_factorizationReused; }   // true if the last Setup() call skipped the factorization
+    int GetNumFactorizations() const { return m_numFactorizations; }
+    int GetNumPatternAnalyses() const { return m_numAnalyses; }
+
+private:
+    virtual bool FactorizeMatrix() override;
+    virtual bool SolveSystem() override;
+    virtual void PrintErrorMessage() override;
+
+    Eigen::SparseLU<ChSparseMatrix, Eigen::COLAMDOrdering<int>> m_engine;
+
+    bool m_reuseFactorization, m_factorizationReused;
+    bool m_isFactorized, m_isAnalyzed;
+    int m_analyzedDim, m_analyzedNonZeros;
+    int m_numFactorizations, m_numAnalyses;
+};
+
+}  // end namespace chrono
+
+#endif // CHSOLVERSPARSELUREUSE_H
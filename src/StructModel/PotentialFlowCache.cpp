@@ -0,0 +1,242 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "PotentialFlowCache.h"
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QThread>
+#include <QDebug>
+#include <QFile>
+#include <QDir>
+
+#include "StrModel.h"
+#include "src/Globals.h"
+#include "src/GlobalFunctions.h"
+
+#define POTFLOWCACHE_MAGIC 0x50464331
+#define POTFLOWCACHE_FORMAT 1
+#define POTFLOWCACHE_MAXSIZE_MB 4096.0
+
+static bool s_enabled = true;
+
+// the matrices are stored as raw memory blocks, the cache is only valid on machines with the same byte order
+
+template <typename Matrix>
+static void writeMatrix(QDataStream &stream, Matrix const &matrix){
+
+    stream << qint32(matrix.rows()) << qint32(matrix.cols());
+    stream.writeRawData((const char *) matrix.data(), int(matrix.size()*sizeof(typename Matrix::Scalar)));
+}
+
+template <typename Matrix>
+static bool readMatrix(QDataStream &stream, Matrix &matrix){
+
+    qint32 rows = -1, cols = -1;
+    stream >> rows >> cols;
+
+    if (stream.status() != QDataStream::Ok || rows < 0 || cols < 0) return false;
+    if (Matrix::RowsAtCompileTime != Eigen::Dynamic && rows != Matrix::RowsAtCompileTime) return false;
+    if (Matrix::ColsAtCompileTime != Eigen::Dynamic && cols != Matrix::ColsAtCompileTime) return false;
+
+    matrix.resize(rows, cols);
+
+    const int bytes = int(matrix.size()*sizeof(typename Matrix::Scalar));
+    return stream.readRawData((char *) matrix.data(), bytes) == bytes;
+}
+
+template <typename Matrix>
+static void writeMatrixList(QDataStream &stream, QVector<Matrix> const &list){
+
+    stream << qint32(list.size());
+    for (int i=0;i<list.size();i++) writeMatrix(stream, list.at(i));
+}
+
+template <typename Matrix>
+static bool readMatrixList(QDataStream &stream, QVector<Matrix> &list){
+
+    qint32 size = -1;
+    stream >> size;
+    if (stream.status() != QDataStream::Ok || size < 0) return false;
+
+    list.resize(size);
+    for (int i=0;i<size;i++) if (!readMatrix(stream, list[i])) return false;
+
+    return true;
+}
+
+template <typename T>
+static void writeArray(QDataStream &stream, const T *data, int size){
+
+    stream << qint32(size);
+    stream.writeRawData((const char *) data, int(size*sizeof(T)));
+}
+
+template <typename T, typename Container>
+static bool readArray(QDataStream &stream, Container &container){
+
+    qint32 size = -1;
+    stream >> size;
+    if (stream.status() != QDataStream::Ok || size < 0) return false;
+
+    container.resize(size);
+
+    const int bytes = int(size*sizeof(T));
+    return stream.readRawData((char *) container.data(), bytes) == bytes;
+}
+
+bool PotentialFlowCache::lookup(QString const &key, potentialFlowBodyData &data){
+
+    if (!s_enabled || key.isEmpty()) return false;
+
+    const QString fileName = QDir(getCacheDirectory()).absoluteFilePath(key + ".pfc");
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) return false;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    qint32 magic = 0, format = 0, byteOrder = 0;
+    stream >> magic >> format >> byteOrder;
+
+    if (magic != POTFLOWCACHE_MAGIC || format != POTFLOWCACHE_FORMAT || byteOrder != Q_BYTE_ORDER) return false;
+
+    // the entry is read into a copy, so that a corrupted file leaves the body data untouched
+
+    potentialFlowBodyData entry;
+
+    bool valid = readMatrix(stream, entry.k_1) && readMatrix(stream, entry.k_2) && readMatrix(stream, entry.k_3) &&
+                 readMatrix(stream, entry.k_4) && readMatrix(stream, entry.k_5) && readMatrix(stream, entry.k_6) &&
+                 readArray<std::complex<double> >(stream, entry.radSSPole) && readArray<std::complex<double> >(stream, entry.radSSResidue) &&
+                 readArray<int>(stream, entry.radSSInput) && readArray<int>(stream, entry.radSSOutput) && readMatrix(stream, entry.radSSFitError) &&
+                 readArray<float>(stream, entry.waveDir) && readMatrixList(stream, entry.H_ij) &&
+                 readMatrixList(stream, entry.QTF_s) && readMatrixList(stream, entry.QTF_s_L) && readMatrixList(stream, entry.QTF_s_R) &&
+                 readMatrixList(stream, entry.QTF_d) && readMatrixList(stream, entry.QTF_d_L) && readMatrixList(stream, entry.QTF_d_R);
+
+    file.close();
+
+    if (!valid || stream.status() != QDataStream::Ok) return false;
+
+    TouchCacheFile(fileName);
+
+    data.k_1 = entry.k_1;
+    data.k_2 = entry.k_2;
+    data.k_3 = entry.k_3;
+    data.k_4 = entry.k_4;
+    data.k_5 = entry.k_5;
+    data.k_6 = entry.k_6;
+    data.radSSPole = entry.radSSPole;
+    data.radSSResidue = entry.radSSResidue;
+    data.radSSState.assign(entry.radSSPole.size(),0.0);
+    data.radSSInput = entry.radSSInput;
+    data.radSSOutput = entry.radSSOutput;
+    data.radSSFitError = entry.radSSFitError;
+    data.waveDir = entry.waveDir;
+    data.H_ij = entry.H_ij;
+    data.QTF_s = entry.QTF_s;
+    data.QTF_s_L = entry.QTF_s_L;
+    data.QTF_s_R = entry.QTF_s_R;
+    data.QTF_d = entry.QTF_d;
+    data.QTF_d_L = entry.QTF_d_L;
+    data.QTF_d_R = entry.QTF_d_R;
+
+    return true;
+}
+
+void PotentialFlowCache::store(QString const &key, potentialFlowBodyData const &data){
+
+    if (!s_enabled || key.isEmpty()) return;
+
+    QDir directory(getCacheDirectory());
+    if (!directory.exists() && !QDir().mkpath(directory.absolutePath())){
+        qDebug().noquote() << "...cant create the potential flow cache directory"<<directory.absolutePath()<<", the preprocessed data is not stored";
+        return;
+    }
+
+    // written to a temporary file first, so that simulations that are initialized in parallel never read a partial entry
+
+    QString fileName = directory.absoluteFilePath(key + ".pfc");
+    QFile tempFile(fileName + "." + QString().number(QCoreApplication::applicationPid()) + "_" + QString().number(quintptr(QThread::currentThreadId())) + ".tmp");
+
+    if (!tempFile.open(QIODevice::WriteOnly)){
+        qDebug().noquote() << "...cant write to the potential flow cache"<<directory.absolutePath()<<", the preprocessed data is not stored";
+        return;
+    }
+
+    QDataStream stream(&tempFile);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    stream << qint32(POTFLOWCACHE_MAGIC) << qint32(POTFLOWCACHE_FORMAT) << qint32(Q_BYTE_ORDER);
+
+    writeMatrix(stream, data.k_1);
+    writeMatrix(stream, data.k_2);
+    writeMatrix(stream, data.k_3);
+    writeMatrix(stream, data.k_4);
+    writeMatrix(stream, data.k_5);
+    writeMatrix(stream, data.k_6);
+    writeArray(stream, data.radSSPole.data(), int(data.radSSPole.size()));
+    writeArray(stream, data.radSSResidue.data(), int(data.radSSResidue.size()));
+    writeArray(stream, data.radSSInput.data(), int(data.radSSInput.size()));
+    writeArray(stream, data.radSSOutput.data(), int(data.radSSOutput.size()));
+    writeMatrix(stream, data.radSSFitError);
+    writeArray(stream, data.waveDir.constData(), data.waveDir.size());
+    writeMatrixList(stream, data.H_ij);
+    writeMatrixList(stream, data.QTF_s);
+    writeMatrixList(stream, data.QTF_s_L);
+    writeMatrixList(stream, data.QTF_s_R);
+    writeMatrixList(stream, data.QTF_d);
+    writeMatrixList(stream, data.QTF_d_L);
+    writeMatrixList(stream, data.QTF_d_R);
+
+    bool success = (stream.status() == QDataStream::Ok);
+    tempFile.close();
+
+    if (!success){
+        qDebug().noquote() << "...cant write to the potential flow cache"<<directory.absolutePath()<<", the preprocessed data is not stored";
+        tempFile.remove();
+        return;
+    }
+
+    // the least recently used entries are removed to make room for the new entry, the cache stays below POTFLOWCACHE_MAXSIZE_MB
+
+    EvictCacheFiles(directory.absolutePath(), QStringList("*.pfc"), POTFLOWCACHE_MAXSIZE_MB, tempFile.size() / 1024.0 / 1024.0);
+
+    // if the rename fails the same entry has just been stored by another simulation
+
+    if (!tempFile.rename(fileName)) tempFile.remove();
+}
+
+bool PotentialFlowCache::isEnabled(){
+    return s_enabled;
+}
+
+void PotentialFlowCache::setEnabled(bool enabled){
+    s_enabled = enabled;
+}
+
+void PotentialFlowCache::clear(){
+
+    QDir directory(getCacheDirectory());
+    if (directory.exists()) directory.removeRecursively();
+
+    if (debugStruct) qDebug().noquote() << "...potential flow cache cleared";
+}
+
+QString PotentialFlowCache::getCacheDirectory(){
+    return GetUserCacheDirectory("PotentialFlowCache");
+}
@@ -0,0 +1,45 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef POTENTIALFLOWCACHE_H
+#define POTENTIALFLOWCACHE_H
+
+#include <QString>
+
+struct potentialFlowBodyData;
+
+// Persistent cache of the preprocessed potential flow data of a floating body. Reading the WAMIT, NEMOH or
+// BEMuse databases, computing the radiation and diffraction IRF's, the radiation state space fit and the
+// interpolation (and compression) of the QTF's is performed once; the result is stored in a binary file
+// that is keyed by a hash of the database contents and all settings that enter the preprocessing (see
+// StrModel::POTFLOW_GetCacheKey()). The quantities that depend on the simulation state (elevation
+// histories, mean drift forces) are not cached and are evaluated after a lookup. The files are kept in the
+// per-user cache location, the least recently used entries are removed when the cache exceeds its size limit.
+
+class PotentialFlowCache
+{
+public:
+    static bool lookup(QString const &key, potentialFlowBodyData &data);
+    static void store(QString const &key, potentialFlowBodyData const &data);
+
+    static bool isEnabled();
+    static void setEnabled(bool enabled);       // disabled: the data is always preprocessed and nothing is stored
+    static void clear();                        // invalidates all stored entries
+    static QString getCacheDirectory();
+};
+
+#endif // POTENTIALFLOWCACHE_H
@@ -39,6 +39,7 @@ AeroHydroElement::AeroHydroElement(){
     isBuoyancy = 0;
     isMCFC = 0;
     seaElevation = 0;
+    m_bDeferLoads = false;
 
     aeroCd = 0;
     coveredDia1 = 0;
@@ -172,6 +173,15 @@ Vec3 AeroHydroElement::GetAccAt(double Nlength){
 
 void AeroHydroElement::AddForceAt(Vec3 force, double appNlength){
 
+    if (m_bDeferLoads){
+        DeferredLoad load;
+        load.type = DEFERRED_FORCE;
+        load.load = force;
+        load.appNlength = appNlength;
+        m_deferredLoads.append(load);
+        return;
+    }
+
     if (appNlength < 0) appNlength = 0;
     if (appNlength > 1) appNlength = 1;
 
@@ -193,6 +203,15 @@ void AeroHydroElement::AddForceAt(Vec3 force, double appNlength){
 
 void AeroHydroElement::AddTorqueAt(Vec3 torque, double appNlength){
 
+    if (m_bDeferLoads){
+        DeferredLoad load;
+        load.type = DEFERRED_TORQUE;
+        load.load = torque;
+        load.appNlength = appNlength;
+        m_deferredLoads.append(load);
+        return;
+    }
+
     if (appNlength < 0) appNlength = 0;
     if (appNlength > 1) appNlength = 1;
 
@@ -214,6 +233,15 @@ void AeroHydroElement::AddTorqueAt(Vec3 torque, double appNlength){
 
 void AeroHydroElement::SetMassAt(double mass, double appNlength){
 
+    if (m_bDeferLoads){
+        DeferredLoad load;
+        load.type = DEFERRED_MASS;
+        load.mass = mass;
+        load.appNlength = appNlength;
+        m_deferredLoads.append(load);
+        return;
+    }
+
     if (appNlength < 0) appNlength = 0;
     if (appNlength > 1) appNlength = 1;
 
@@ -234,6 +262,47 @@ void AeroHydroElement::SetMassAt(double mass, double appNlength){
 
 }
 
+void AeroHydroElement::AddAddedMassAt(Eigen::Matrix<double, 3, 3> addedMass, double appNlength){
+
+    if (m_bDeferLoads){
+        DeferredLoad load;
+        load.type = DEFERRED_ADDEDMASS;
+        load.addedMass = addedMass;
+        load.appNlength = appNlength;
+        m_deferredLoads.append(load);
+        return;
+    }
+
+    std::shared_ptr<chrono::fea::ChNodeFEAxyzrotAddedMass> node = std::dynamic_pointer_cast<chrono::fea::ChNodeFEAxyzrotAddedMass>(appNlength < 0.5 ? m_node1 : m_node2);
+
+    if (!node) return;
+
+    Eigen::Matrix<double, 6, 6> nodeMass = node->VariablesBodyAddedMass().GetMfullmass();
+
+    for (int i=0;i<3;i++)
+        for (int j=0;j<3;j++)
+            nodeMass(i,j) += addedMass(i,j);
+
+    node->SetMfullmass(nodeMass);
+}
+
+void AeroHydroElement::FlushDeferredLoads(){
+
+    const bool defer = m_bDeferLoads;
+    m_bDeferLoads = false;
+
+    for (int i=0;i<m_deferredLoads.size();i++){
+        const DeferredLoad &load = m_deferredLoads.at(i);
+        if (load.type == DEFERRED_FORCE) AddForceAt(load.load,load.appNlength);
+        else if (load.type == DEFERRED_TORQUE) AddTorqueAt(load.load,load.appNlength);
+        else if (load.type == DEFERRED_MASS) SetMassAt(load.mass,load.appNlength);
+        else if (load.type == DEFERRED_ADDEDMASS) AddAddedMassAt(load.addedMass,load.appNlength);
+    }
+
+    m_deferredLoads.resize(0);
+    m_bDeferLoads = defer;
+}
+
 void AeroHydroElement::AddAerodynamicDrag(){
 
     if (aeroCd == 0) return;
@@ -331,18 +400,8 @@ void AeroHydroElement::AddRotorAddedMass(){
     Eigen::Matrix<double, 3, 3> globalAddedMass1 = transToGlobal1*loc_cylinder*transToGlobal1.transpose();
     Eigen::Matrix<double, 3, 3> globalAddedMass2 = transToGlobal2*loc_cylinder*transToGlobal2.transpose();
 
-    Eigen::Matrix<double, 6, 6> node1mass = node1->VariablesBodyAddedMass().GetMfullmass();
-    Eigen::Matrix<double, 6, 6> node2mass = node2->VariablesBodyAddedMass().GetMfullmass();
-
-    for (int i=0;i<3;i++){
-        for (int j=0;j<3;j++){
-            node1mass(i,j) += (globalAddedMass1(i,j));
-            node2mass(i,j) += (globalAddedMass2(i,j));
-        }
-    }
-
-    node1->SetMfullmass(node1mass);
-    node2->SetMfullmass(node2mass);
+    AddAddedMassAt(globalAddedMass1,0);
+    AddAddedMassAt(globalAddedMass2,1);
 
     Vec3 acceleration = sim->m_QTurbine->getFreeStreamAcceleration(GetPosAt(0.5),sim->m_currentTime);
 
@@ -474,18 +533,9 @@ void AeroHydroElement::AddMorisonForces(double factor, Vec3 appPoint){
             loc_cylinder(1,1) = addedMass * 0.5; //half contribution on each node
 
             Eigen::Matrix<double, 3, 3> globalAddedMass = transToGlobal*loc_cylinder*transToGlobal.transpose();
-            Eigen::Matrix<double, 6, 6> node1mass = node1->VariablesBodyAddedMass().GetMfullmass();
-            Eigen::Matrix<double, 6, 6> node2mass = node2->VariablesBodyAddedMass().GetMfullmass();
-
-            for (int i=0;i<3;i++){
-                for (int j=0;j<3;j++){
-                    node1mass(i,j) += globalAddedMass(i,j);
-                    node2mass(i,j) += globalAddedMass(i,j);
-                }
-            }
 
-            node1->SetMfullmass(node1mass);
-            node2->SetMfullmass(node2mass);
+            AddAddedMassAt(globalAddedMass,0);
+            AddAddedMassAt(globalAddedMass,1);
         }
     }
 
@@ -541,13 +591,7 @@ void AeroHydroElement::AddMorisonForces(double factor, Vec3 appPoint){
 
                 Eigen::Matrix<double, 3, 3> globalAddedMass = transToGlobal*localAddedMass*transToGlobal.transpose();
 
-                Eigen::Matrix<double, 6, 6> nodeMass = node1->VariablesBodyAddedMass().GetMfullmass();
-
-                for (int i=0;i<3;i++)
-                    for (int j=0;j<3;j++)
-                        nodeMass(i,j) += (globalAddedMass(i,j));
-
-                node1->SetMfullmass(nodeMass);
+                AddAddedMassAt(globalAddedMass,0);
             }
         }
     }
@@ -602,13 +646,7 @@ void AeroHydroElement::AddMorisonForces(double factor, Vec3 appPoint){
 
             Eigen::Matrix<double, 3, 3> globalAddedMass = transToGlobal*localAddedMass*transToGlobal.transpose();
 
-            Eigen::Matrix<double, 6, 6> nodeMass = node2->VariablesBodyAddedMass().GetMfullmass();
-
-            for (int i=0;i<3;i++)
-                for (int j=0;j<3;j++)
-                    nodeMass(i,j) += (globalAddedMass(i,j));
-
-            node2->SetMfullmass(nodeMass);
+            AddAddedMassAt(globalAddedMass,1);
             }
         }
     }
@@ -27,6 +27,15 @@
 
 class ChLoadDistributedAero;
 
+enum DEFERREDLOADTYPE {DEFERRED_FORCE, DEFERRED_TORQUE, DEFERRED_MASS, DEFERRED_ADDEDMASS};
+
+struct DeferredLoad{
+    int type;
+    Vec3 load;
+    double mass, appNlength;
+    Eigen::Matrix<double, 3, 3> addedMass;
+};
+
 class AeroHydroElement
 {
 
@@ -62,6 +71,13 @@ public:
     void AddForceAt(Vec3 force, double appNlength);
     void AddTorqueAt(Vec3 torque, double appNlength);
     void SetMassAt(double mass, double appNlength);
+    void AddAddedMassAt(Eigen::Matrix<double, 3, 3> addedMass, double appNlength); // appNlength is 0 (node1) or 1 (node2)
+
+    // while m_bDeferLoads is set the nodal loads are only recorded, so that the elements can be evaluated in
+    // parallel without writing to shared nodes; FlushDeferredLoads() applies the recorded loads in their original order
+    bool m_bDeferLoads;
+    QVector<DeferredLoad> m_deferredLoads;
+    void FlushDeferredLoads();
 
     void AddAerodynamicDrag();
     void AddMorisonForces(double factor, Vec3 appPoint);
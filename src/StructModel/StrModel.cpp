@@ -17,6 +17,7 @@
 
 #include "StrModel.h"
 #include <QtOpenGL>
+#include <QCryptographicHash>
 #include "src/GlobalFunctions.h"
 #include "src/Serializer.h"
 #include "src/QTurbine/QTurbine.h"
@@ -24,6 +25,8 @@
 #include "src/Globals.h"
 #include "src/GLWidget.h"
 #include "src/ImportExport.h"
+#include "src/SpectralAnalysis.h"
+#include "PotentialFlowCache.h"
 
 /////chrono includes
 
@@ -88,6 +91,7 @@ StrModel::StrModel(QTurbine *sim)
     m_ChSystem = NULL;
     m_ChMesh = NULL;
     m_ChLoadContainer = NULL;
+    m_numAeroLoadSteps = 0;
 }
 
 void StrModel::CreateCoordinateSystemsVAWT(){
@@ -435,6 +439,8 @@ void StrModel::InitializeModel(){
 
     CalcMassAndInertiaInfo();
 
+    CreateLoadElementLists();
+
     if (!vizBeams.size()) StoreGeometry();
 
      m_ChSystem->DoFullAssembly();
@@ -1010,7 +1016,7 @@ void StrModel::PrepareSolver(){
 
     ChSystemNSC *sys = (ChSystemNSC *) m_ChSystem;
 
-    m_ChSparseLUSolver = chrono_types::make_shared<ChSolverSparseLU>();
+    m_ChSparseLUSolver = chrono_types::make_shared<ChSolverSparseLUReuse>();
 
     sys->SetSolver(m_ChSparseLUSolver);
 
@@ -1020,8 +1026,17 @@ void StrModel::PrepareSolver(){
 
     m_ChSparseLUSolver->LeverageRhsSparsity(true);
 
+    // the pattern is only relearned after a ForceSparsityPatternUpdate(), so that the symbolic factorization is reused
+    m_ChSparseLUSolver->LockSparsityPattern(true);
+
     m_ChSparseLUSolver->ForceSparsityPatternUpdate();
 
+    m_stepsSinceFactorization = 0;
+    m_numTimestepFactorizations = 0;
+    m_bRefreshJacobian = true;
+
+    m_numAeroLoadSteps = 0;
+
 }
 
 void StrModel::PretensionCableElements(){
@@ -1065,7 +1080,7 @@ void StrModel::RelaxModel(){
 
     if (m_ChSystem->GetTimestepperType() == ChTimestepper::Type::HHT){
         auto mystepper = std::dynamic_pointer_cast<ChTimestepperHHT>(m_ChSystem->GetTimestepper());
-        mystepper->SetModifiedNewton(false);
+        mystepper->SetModifiedNewton(jacobianRefreshSteps > 0);
     }
 
 }
@@ -1465,12 +1480,93 @@ void StrModel::CalculateChronoDynamics(double time){
 
         SetBoundaryConditionsAndControl(step);
 
-        if (!m_ChSystem->DoStepDynamics(step)) break; // ***  Single integration step,
+        if (m_QTurbine->m_QSim) if (m_QTurbine->m_QSim->m_aeroCouplingType == AEROCOUPLING_EXTRAPOLATE) ExtrapolateAtomicAeroLoads(m_ChSystem->GetChTime()+step);
+
+        // modified Newton: the factorization of an earlier step is reused for at most jacobianRefreshSteps steps, it is
+        // refreshed earlier if the last step diverged or needed more than jacobianRefreshIterations iterations
+
+        bool isHHT = (m_ChSystem->GetTimestepperType() == ChTimestepper::Type::HHT);
+        bool isModifiedNewton = isHHT && jacobianRefreshSteps > 0;
+        bool reuseFactorization = isModifiedNewton && !m_bRefreshJacobian && m_stepsSinceFactorization < jacobianRefreshSteps;
+
+        // the state before a step with a reused factorization is saved; if that step diverges or reaches the iteration
+        // limit it is repeated from the saved state with a fresh factorization, instead of accepting the step
+
+        ChState savedX;
+        ChStateDelta savedV, savedA;
+        ChVectorDynamic<> savedL;
+        double savedT = 0;
+
+        if (reuseFactorization){
+            m_ChSystem->Setup();
+            savedX.setZero(m_ChSystem->GetNcoords_x(), m_ChSystem);
+            savedV.setZero(m_ChSystem->GetNcoords_v(), m_ChSystem);
+            savedA.setZero(m_ChSystem->GetNcoords_v(), m_ChSystem);
+            savedL.setZero(m_ChSystem->GetNconstr());
+            m_ChSystem->StateGather(savedX, savedV, savedT);
+            m_ChSystem->StateGatherAcceleration(savedA);
+            m_ChSystem->StateGatherReactions(savedL);
+        }
+
+        m_ChSparseLUSolver->SetReuseFactorization(reuseFactorization);
+
+        bool success = m_ChSystem->DoStepDynamics(step); // ***  Single integration step,
+
+        m_ChSparseLUSolver->SetReuseFactorization(false);
+
+        bool isReused = m_ChSparseLUSolver->IsFactorizationReused();
+        bool isFailed = isModifiedNewton && !IsStepConverged();
+
+        if (isReused && isFailed){
+
+            if (debugStruct) qDebug().noquote() << "Structural Model: step with reused factorization failed, repeating it with a fresh factorization at" << QString().number(savedT,'f',5) << "[s]";
+
+            m_ChSystem->StateScatter(savedX, savedV, savedT, true);
+            m_ChSystem->StateScatterAcceleration(savedA);
+            m_ChSystem->StateScatterReactions(savedL);
+
+            success = m_ChSystem->DoStepDynamics(step);
+
+            isReused = m_ChSparseLUSolver->IsFactorizationReused();
+            isFailed = !IsStepConverged();
+        }
+
+        if (isReused) m_stepsSinceFactorization++;
+        else m_stepsSinceFactorization = 1;
+
+        // a step that fails with a fresh factorization is accepted as before (no step control), the next step refactorizes
+
+        m_bRefreshJacobian = isFailed;
+        if (isFailed && debugStruct) qDebug().noquote() << "Structural Model: Jacobian refresh requested at" << QString().number(m_ChSystem->GetChTime(),'f',5) << "[s]";
+
+        if (!success) break;
 
         UpdateAzimuthalAngle();
     }
 }
 
+bool StrModel::IsStepConverged(){
+
+    // the last HHT step converged within the iteration limit of the Jacobian reuse policy
+
+    auto mystepper = std::dynamic_pointer_cast<ChTimestepperHHT>(m_ChSystem->GetTimestepper());
+    if (!mystepper) return true;
+
+    int iterationLimit = jacobianRefreshIterations;
+    if (iterationLimit <= 0) iterationLimit = m_QTurbine->m_structuralIterations - 1;
+
+    if (!mystepper->GetConvergenceFlag() || mystepper->GetNumIterations() > iterationLimit){
+        if (debugStruct) qDebug().noquote() << "Structural Model: step not converged within"<< iterationLimit << "iterations ("<< mystepper->GetNumIterations() << ")";
+        return false;
+    }
+
+    return true;
+}
+
+int StrModel::GetNumFactorizations(){
+    return m_numTimestepFactorizations;
+}
+
 double StrModel::GetRpmLSS(){
     if (drivetrain)
         return drivetrain->LSS_shaft->GetPos_dt()/PI_/2.0*60.0;
@@ -3693,8 +3789,13 @@ void StrModel::AdvanceToTime(double time, double tstart){
 
     PreAdvanceToTime(tstart);
 
+    // only the factorizations of the time integration are counted, not those of the initialization and ramp-up
+    int factorizations = m_ChSparseLUSolver->GetNumFactorizations();
+
     CalculateChronoDynamics(time);
 
+    m_numTimestepFactorizations += m_ChSparseLUSolver->GetNumFactorizations() - factorizations;
+
     PostAdvanceToTime(tstart);
 
 }
@@ -3873,6 +3974,28 @@ void StrModel::AddAtomicAeroLoads(){
 
     if (!m_QTurbine->m_bincludeAero) return;
 
+    // the loads of the previous aero timesteps are kept for the extrapolation over the structural substeps, a repeated call at
+    // the same time only replaces the latest loads
+
+    int numPanels = m_QTurbine->m_BladePanel.size() + m_QTurbine->m_StrutPanel.size();
+
+    double time = m_ChSystem->GetChTime();
+
+    if (m_numAeroLoadSteps == 0 || m_aeroForceHistory[0].size() != numPanels || time < m_aeroLoadTime[0]) m_numAeroLoadSteps = 0;
+    else if (time == m_aeroLoadTime[0]) m_numAeroLoadSteps--;
+    else{
+        for (int k=2;k>0;k--){
+            m_aeroForceHistory[k] = m_aeroForceHistory[k-1];
+            m_aeroTorqueHistory[k] = m_aeroTorqueHistory[k-1];
+            m_aeroLoadTime[k] = m_aeroLoadTime[k-1];
+        }
+    }
+
+    m_aeroForceHistory[0].resize(numPanels);
+    m_aeroTorqueHistory[0].resize(numPanels);
+    m_aeroLoadTime[0] = time;
+    if (m_numAeroLoadSteps < 3) m_numAeroLoadSteps++;
+
     for (int i=0;i<m_QTurbine->m_BladePanel.size();i++){
 
         VortexPanel *panel = m_QTurbine->m_BladePanel[i];
@@ -3901,6 +4024,9 @@ void StrModel::AddAtomicAeroLoads(){
             m_AeroPanelLoads.at(index)->loader.SetTorque(ChVecFromVec3(locTorque));
             m_AeroPanelLoads.at(index)->loader.SetTorqueGradient(ChVecFromVec3(locd_Torque));
         }
+
+        m_aeroForceHistory[0][index] = locForce;
+        m_aeroTorqueHistory[0][index] = m_QTurbine->m_bisReversed ? locTorque*(-1.0) : locTorque;
         m_AeroPanelLoads.at(index)->loader.SetReferenceRotation(GetBody(bodyType,panel->fromBlade)->GetChronoRotationAt(panel->getRelPos()));
     }
 
@@ -3932,10 +4058,53 @@ void StrModel::AddAtomicAeroLoads(){
             m_AeroPanelLoads.at(index)->loader.SetTorque(ChVecFromVec3(locTorque));
             m_AeroPanelLoads.at(index)->loader.SetTorqueGradient(ChVecFromVec3(locd_Torque));
         }
+
+        m_aeroForceHistory[0][index] = locForce;
+        m_aeroTorqueHistory[0][index] = m_QTurbine->m_bisReversed ? locTorque*(-1.0) : locTorque;
         m_AeroPanelLoads.at(index)->loader.SetReferenceRotation(GetBody(bodyType,panel->fromBlade,panel->fromStrut)->GetChronoRotationAt(panel->getRelPos()));
     }
+}
 
+void StrModel::ExtrapolateAtomicAeroLoads(double time){
 
+    // multi-rate coupling: the panel loads are linearly extrapolated from the last two aero timesteps to the end of the current
+    // structural substep. Panels with a load that changed its direction of change between the last aero timesteps are held
+    // constant and the extrapolated increment is limited to m_aeroCouplingLimit times the last aero load. The load gradients
+    // and reference rotations are held, as set in AddAtomicAeroLoads()
+
+    if (!m_QTurbine->m_bincludeAero || m_numAeroLoadSteps < 2) return;
+
+    double dT = m_aeroLoadTime[0] - m_aeroLoadTime[1];
+    if (dT <= 0) return;
+
+    double s = (time - m_aeroLoadTime[0]) / dT;
+    if (s < 0) s = 0;
+    if (s > 1) s = 1;
+
+    double limit = m_QTurbine->m_QSim->m_aeroCouplingLimit;
+
+    for (int i=0;i<m_aeroForceHistory[0].size() && i<m_AeroPanelLoads.size();i++){
+
+        Vec3 dForce = m_aeroForceHistory[0][i] - m_aeroForceHistory[1][i];
+        Vec3 dTorque = m_aeroTorqueHistory[0][i] - m_aeroTorqueHistory[1][i];
+
+        if (m_numAeroLoadSteps > 2){
+            if (dForce.dot(m_aeroForceHistory[1][i] - m_aeroForceHistory[2][i]) < 0) dForce.Set(0,0,0);
+            if (dTorque.dot(m_aeroTorqueHistory[1][i] - m_aeroTorqueHistory[2][i]) < 0) dTorque.Set(0,0,0);
+        }
+
+        dForce *= s;
+        dTorque *= s;
+
+        double maxForce = limit * m_aeroForceHistory[0][i].VAbs();
+        if (dForce.VAbs() > maxForce) dForce *= maxForce / dForce.VAbs();
+
+        double maxTorque = limit * m_aeroTorqueHistory[0][i].VAbs();
+        if (dTorque.VAbs() > maxTorque) dTorque *= maxTorque / dTorque.VAbs();
+
+        m_AeroPanelLoads.at(i)->loader.SetForce(ChVecFromVec3(m_aeroForceHistory[0][i] + dForce));
+        m_AeroPanelLoads.at(i)->loader.SetTorque(ChVecFromVec3(m_aeroTorqueHistory[0][i] + dTorque));
+    }
 }
 
 void StrModel::ApplyExternalForcesAndMoments(){
@@ -3946,6 +4115,7 @@ void StrModel::ApplyExternalForcesAndMoments(){
 
     AddAtomicAeroLoads();
 
+    // the rotor added mass stays serial, since the free stream acceleration sets the boundary conditions of the simulation
     for (int i=0;i<m_Bodies.size();i++){
         if (m_Bodies.at(i)->Btype == BLADE || m_Bodies.at(i)->Btype == STRUT){
             for (int j = 0;j<m_Bodies.at(i)->Elements.size();j++){
@@ -3960,28 +4130,11 @@ void StrModel::ApplyExternalForcesAndMoments(){
 
     SUBSTRUCTURE_AssignElementSeaState();
 
-    for (int i=0;i<m_Bodies.size();i++){
-        for (int j=0;j<m_Bodies.at(i)->Elements.size();j++){
-            if (m_QTurbine->m_bincludeAero) m_Bodies.at(i)->Elements.at(j)->AddAerodynamicDrag();
-            if (isAdvancedBuoyancy) m_Bodies.at(i)->Elements.at(j)->AddBuoyancyAdvanced(isStaticBuoyancy);
-            else m_Bodies.at(i)->Elements.at(j)->AddBuoyancy(isStaticBuoyancy);
-        }
-    }
+    AssembleElementLoads(m_dragBuoyancyElements, DRAG_BUOYANCY_LOADS);
 
-    for (int i=0;i<m_Cables.size();i++){
-        for (int j=0;j<m_Cables.at(i)->Elements.size();j++){
-            if (m_QTurbine->m_bincludeAero) m_Cables.at(i)->Elements.at(j)->AddAerodynamicDrag();
-            m_Cables.at(i)->Elements.at(j)->AddBuoyancy(isStaticBuoyancy);
-        }
-    }
+    AssembleElementLoads(m_cableLoadElements, CABLE_DRAG_BUOYANCY_LOADS);
 
-    for (int i=0;i<m_RigidBodies.size();i++){
-        for (int j=0;j<m_RigidBodies.at(i)->Elements.size();j++){
-            if (m_QTurbine->m_bincludeAero) m_RigidBodies.at(i)->Elements.at(j)->AddAerodynamicDrag();
-            if (isAdvancedBuoyancy) m_RigidBodies.at(i)->Elements.at(j)->AddBuoyancyAdvanced(isStaticBuoyancy);
-            else m_RigidBodies.at(i)->Elements.at(j)->AddBuoyancy(isStaticBuoyancy);
-        }
-    }
+    AssembleElementLoads(m_rigidDragBuoyancyElements, DRAG_BUOYANCY_LOADS);
 
     // this factor relaxes the hydrodynamic forces and cable extension during precomp and speeds up the "settling" of mooring lines
     double factor = 1;
@@ -3994,23 +4147,117 @@ void StrModel::ApplyExternalForcesAndMoments(){
             for (int j=0;j<m_Cables.at(i)->Elements.size();j++)
                 m_Cables.at(i)->Elements.at(j)->SetRestLength(m_Cables.at(i)->initialLength+m_Cables.at(i)->deltaLength * factor);
 
+    AssembleElementLoads(m_mooringElements, MOORING_LOADS, factor);
+
+    if (m_QTurbine->m_bincludeHydro) POTFLOW_ApplyForces();
+}
+
+void StrModel::CreateLoadElementLists(){
+
+    // the element lists of the load assembly passes are built once when the model is initialized, the elements
+    // of the beams, cables and rigid bodies do not change during a simulation
+
+    m_dragBuoyancyElements.clear();
+    for (int i=0;i<m_Bodies.size();i++)
+        for (int j=0;j<m_Bodies.at(i)->Elements.size();j++)
+            m_dragBuoyancyElements.append(m_Bodies.at(i)->Elements.at(j).get());
+
+    m_cableLoadElements.clear();
+    m_mooringElements.clear();
     for (int i=0;i<m_Cables.size();i++){
-        if (m_Cables.at(i)->Btype == MOORING){
-            for (int j=0;j<m_Cables.at(i)->Elements.size();j++){
+        for (int j=0;j<m_Cables.at(i)->Elements.size();j++){
+            m_cableLoadElements.append(m_Cables.at(i)->Elements.at(j).get());
+            if (m_Cables.at(i)->Btype == MOORING) m_mooringElements.append(m_Cables.at(i)->Elements.at(j).get());
+        }
+    }
+
+    m_rigidDragBuoyancyElements.clear();
+    for (int i=0;i<m_RigidBodies.size();i++)
+        for (int j=0;j<m_RigidBodies.at(i)->Elements.size();j++)
+            m_rigidDragBuoyancyElements.append(m_RigidBodies.at(i)->Elements.at(j).get());
+
+    m_morisonElements.clear();
+    for (int i=0;i<m_ChMesh->GetElements().size();i++){
+        std::shared_ptr<StrElem> strElem = std::dynamic_pointer_cast<StrElem>(m_ChMesh->GetElements().at(i));
+        if (strElem) m_morisonElements.append(strElem.get());
+    }
+    for (int i=0;i<m_ChSystem->GetAssembly().Get_bodylist().size();i++){
+        std::shared_ptr<RigidElem> rgdElem = std::dynamic_pointer_cast<RigidElem>(m_ChSystem->GetAssembly().Get_bodylist().at(i));
+        if (rgdElem) m_morisonElements.append(rgdElem.get());
+    }
+}
+
+void StrModel::AssembleElementLoads(QVector<AeroHydroElement *> &loadElements, int pass, double factor, Vec3 refPos){
 
-                if (m_QTurbine->m_bincludeHydro) m_Cables.at(i)->Elements.at(j)->AddCableMorisonForces(factor);
+    // the elements in loadElements are evaluated in parallel; the elements only record their nodal loads, since
+    // neighbouring elements share nodes. With deterministicLoads the recorded loads are applied in the element order
+    // after the parallel pass, which gives results that are identical to a serial evaluation. Otherwise each thread
+    // applies the loads of its elements as soon as it is done, in an order that depends on the thread scheduling.
+    // Small lists are evaluated serially, the thread startup costs more than the element loads.
 
-                m_Cables.at(i)->Elements.at(j)->AddSeabedStiffnessFriction(m_QTurbine->m_QSim->m_waterDepth,
-                                                                           m_QTurbine->m_QSim->m_seabedStiffness,
-                                                                           m_QTurbine->m_QSim->m_seabedDampFactor,
-                                                                           m_QTurbine->m_QSim->m_seabedShearFactor);
+    if (!loadElements.size()) return;
+
+    AeroHydroElement **elements = loadElements.data();
+    int num = loadElements.size();
+    bool ordered = deterministicLoads;
+    bool includeAero = m_QTurbine->m_bincludeAero;
+    bool includeHydro = m_QTurbine->m_bincludeHydro;
+    bool advancedBuoyancy = isAdvancedBuoyancy;
+    bool staticBuoyancy = isStaticBuoyancy;
+    double waterDepth = m_QTurbine->m_QSim->m_waterDepth;
+    double seabedStiffness = m_QTurbine->m_QSim->m_seabedStiffness;
+    double seabedDampFactor = m_QTurbine->m_QSim->m_seabedDampFactor;
+    double seabedShearFactor = m_QTurbine->m_QSim->m_seabedShearFactor;
+
+    #pragma omp parallel if (num > 64) default (none) shared (elements, num, ordered, pass, factor, refPos, includeAero, includeHydro, advancedBuoyancy, staticBuoyancy, waterDepth, seabedStiffness, seabedDampFactor, seabedShearFactor)
+    {
+        QVector<int> threadElements;
+
+        #pragma omp for
+        for (int i=0;i<num;i++){
+
+            AeroHydroElement *elem = elements[i];
+            elem->m_bDeferLoads = true;
+
+            if (pass == MORISON_LOADS){
+                elem->EvaluateSeastateElementQuantities();
+                elem->AddMorisonForces(1.0,refPos);
+            }
+            else if (pass == DRAG_BUOYANCY_LOADS){
+                if (includeAero) elem->AddAerodynamicDrag();
+                if (advancedBuoyancy) elem->AddBuoyancyAdvanced(staticBuoyancy);
+                else elem->AddBuoyancy(staticBuoyancy);
+            }
+            else if (pass == CABLE_DRAG_BUOYANCY_LOADS){
+                if (includeAero) elem->AddAerodynamicDrag();
+                elem->AddBuoyancy(staticBuoyancy);
+            }
+            else if (pass == MOORING_LOADS){
+                // this pass only contains mooring cable elements
+                CabElem *cabElem = static_cast<CabElem *>(elem);
+                if (includeHydro) cabElem->AddCableMorisonForces(factor);
+                cabElem->AddSeabedStiffnessFriction(waterDepth,seabedStiffness,seabedDampFactor,seabedShearFactor);
+            }
+
+            elem->m_bDeferLoads = false;
+            if (!ordered) threadElements.append(i);
+        }
+
+        if (!ordered){
+            #pragma omp critical
+            {
+                for (int i=0;i<threadElements.size();i++)
+                    elements[threadElements.at(i)]->FlushDeferredLoads();
             }
         }
     }
 
-    if (m_QTurbine->m_bincludeHydro) POTFLOW_ApplyForces();
+    if (ordered)
+        for (int i=0;i<num;i++)
+            elements[i]->FlushDeferredLoads();
 }
 
+
 Vec3 StrModel::GetCoGAt(double relPos, int numBody, bool fromStrut){
 
     int i = numBody;
@@ -8122,6 +8369,36 @@ bool StrModel::ReadStrModelMultiFiles(){
         }
     }
 
+    jacobianRefreshSteps = 0;
+    value = "JACOBIAN_REFRESH";
+    strong = FindValueInFile(value,inputStream,&error_msg,false,&found);
+    if (found){
+        jacobianRefreshSteps = strong.toInt(&converted);
+        if(!converted){
+            error_msg.append("\n"+value+" could not be converted");
+        }
+        else if (debugStruct) qDebug().noquote()<<"Structural Model:"  << value+" "+strong + "  read!";
+    }
+
+    jacobianRefreshIterations = 0;
+    value = "JACOBIAN_MAXITER";
+    strong = FindValueInFile(value,inputStream,&error_msg,false,&found);
+    if (found){
+        jacobianRefreshIterations = strong.toInt(&converted);
+        if(!converted){
+            error_msg.append("\n"+value+" could not be converted");
+        }
+        else if (debugStruct) qDebug().noquote()<<"Structural Model:"  << value+" "+strong + "  read!";
+    }
+
+    deterministicLoads = true;
+    value = "DETERMINISTIC_LOADS";
+    strong = FindValueInFile(value,inputStream,&error_msg,false,&found);
+    if (found){
+        if (strong == "false" || strong == "FALSE" || strong == "False" || strong == "0") deterministicLoads = false;
+        if (debugStruct) qDebug().noquote()<<"Structural Model:"  << value+" "+strong + "  read!";
+    }
+
     for (int i=0;i<bladeStreams.size();i++){
 
         bladeDiscFromStruct.append(false);
@@ -9491,7 +9768,7 @@ void StrModel::SetTimeIntegrator(int i){
         mystepper->SetStepControl(false);
         mystepper->SetMaxiters(m_QTurbine->m_structuralIterations);
         mystepper->SetMode(ChTimestepperHHT::HHT_Mode::ACCELERATION);
-        mystepper->SetModifiedNewton(false);
+        mystepper->SetModifiedNewton(jacobianRefreshSteps > 0);
         mystepper->SetScaling(true);
     }
 
@@ -10076,17 +10353,21 @@ void StrModel::SUBSTRUCTURE_AssignElementSeaState(){
 
     if (m_QTurbine->m_QSim->m_linearWave) { // wave and buoyancy calcs
 
+        // the kinematics of all hydrodynamic nodes are evaluated in one batch
+
+        m_waveKinematicsNodes.clear();
+        m_waveKinematics.Resize(0);
+
         for (int i=0;i<m_ChMesh->GetNodes().size();i++){
 
             std::shared_ptr<StrNode> sNode = std::dynamic_pointer_cast<StrNode>(m_ChMesh->GetNodes().at(i));
             std::shared_ptr<CabNode> cNode = std::dynamic_pointer_cast<CabNode>(m_ChMesh->GetNodes().at(i));
 
-            Vec3 pos, vel(0,0,0), acc(0,0,0);
-            float dynamicPressure = 0;
+            Vec3 pos;
             bool isHydro = false;
             if (sNode){
                 if (sNode->CdAx >0 || sNode->CaAx > 0  || sNode->CpAx > 0) isHydro = true;
-                pos = Vec3FromChVec(sNode->GetPos());
+                pos = sNode->waveKinEvalPos;
             }
             if (cNode){
                 isHydro = cNode->isMooring;
@@ -10094,25 +10375,39 @@ void StrModel::SUBSTRUCTURE_AssignElementSeaState(){
             }
 
             if (isHydro){
+                m_waveKinematicsNodes.append(i);
+                m_waveKinematics.x.append(pos.x);
+                m_waveKinematics.y.append(pos.y);
+                m_waveKinematics.z.append(pos.z);
+                m_waveKinematics.evalElevation.append(sNode ? 1 : 0);
+            }
+        }
 
-                if (sNode){
-                    double elevation = m_QTurbine->m_QSim->m_linearWave->GetElevation(sNode->waveKinEvalPos,m_QTurbine->m_QSim->m_currentTime);
-                    m_QTurbine->m_QSim->m_linearWave->GetVelocityAndAcceleration(sNode->waveKinEvalPos,m_QTurbine->m_QSim->m_currentTime,elevation,m_QTurbine->m_QSim->m_waterDepth,m_QTurbine->m_QSim->m_waveStretchingType,&vel,&acc,&dynamicPressure);
-                    vel += m_QTurbine->m_QSim->getOceanCurrentAt(sNode->waveKinEvalPos,elevation);
-                    sNode->elevation = elevation;
-                    sNode->waterAcc = acc;
-                    sNode->waterVel = vel;
-                    sNode->dynP = dynamicPressure * m_QTurbine->m_QSim->m_waterDensity * m_QTurbine->m_QSim->m_gravity;
+        m_QTurbine->m_QSim->getWaveKinematics(m_waveKinematics,m_QTurbine->m_QSim->m_currentTime,true);
 
-                }
-                if (cNode){
-                    m_QTurbine->m_QSim->m_linearWave->GetVelocityAndAcceleration(pos,m_QTurbine->m_QSim->m_currentTime,0,m_QTurbine->m_QSim->m_waterDepth,m_QTurbine->m_QSim->m_waveStretchingType,&vel,&acc,&dynamicPressure);
-                    vel += m_QTurbine->m_QSim->getOceanCurrentAt(pos,0);
-                    cNode->waterAcc = acc;
-                    cNode->waterVel = vel;
-                    cNode->dynP = dynamicPressure * m_QTurbine->m_QSim->m_waterDensity * m_QTurbine->m_QSim->m_gravity;
+        const double pressureFactor = m_QTurbine->m_QSim->m_waterDensity * m_QTurbine->m_QSim->m_gravity;
 
-                }
+        for (int j=0;j<m_waveKinematicsNodes.size();j++){
+
+            std::shared_ptr<StrNode> sNode = std::dynamic_pointer_cast<StrNode>(m_ChMesh->GetNodes().at(m_waveKinematicsNodes.at(j)));
+            std::shared_ptr<CabNode> cNode = std::dynamic_pointer_cast<CabNode>(m_ChMesh->GetNodes().at(m_waveKinematicsNodes.at(j)));
+
+            Vec3 vel(m_waveKinematics.velX.at(j), m_waveKinematics.velY.at(j), m_waveKinematics.velZ.at(j));
+            Vec3 acc(m_waveKinematics.accX.at(j), m_waveKinematics.accY.at(j), m_waveKinematics.accZ.at(j));
+
+            if (sNode){
+                double elevation = m_waveKinematics.elevation.at(j);
+                vel += m_QTurbine->m_QSim->getOceanCurrentAt(sNode->waveKinEvalPos,elevation);
+                sNode->elevation = elevation;
+                sNode->waterAcc = acc;
+                sNode->waterVel = vel;
+                sNode->dynP = m_waveKinematics.dynP.at(j) * pressureFactor;
+            }
+            if (cNode){
+                vel += m_QTurbine->m_QSim->getOceanCurrentAt(Vec3FromChVec(cNode->GetPos()),0);
+                cNode->waterAcc = acc;
+                cNode->waterVel = vel;
+                cNode->dynP = m_waveKinematics.dynP.at(j) * pressureFactor;
             }
         }
 
@@ -10132,21 +10427,7 @@ void StrModel::SUBSTRUCTURE_AssignElementSeaState(){
     Vec3 refPos(0,0,0);
     if (potFlowBodyData.size()) refPos = potFlowBodyData[0].posHYDRO;
 
-    for (int i=0;i<m_ChMesh->GetElements().size();i++){
-        std::shared_ptr<StrElem> strElem = std::dynamic_pointer_cast<StrElem>(m_ChMesh->GetElements().at(i));
-        if (strElem){
-            strElem->EvaluateSeastateElementQuantities();
-            strElem->AddMorisonForces(1.0,refPos);
-        }
-    }
-
-    for (int i=0;i<m_ChSystem->GetAssembly().Get_bodylist().size();i++){
-        std::shared_ptr<RigidElem> rgdElem = std::dynamic_pointer_cast<RigidElem>(m_ChSystem->GetAssembly().Get_bodylist().at(i));
-        if (rgdElem){
-            rgdElem->EvaluateSeastateElementQuantities();
-            rgdElem->AddMorisonForces(1.0,refPos);
-        }
-    }
+    AssembleElementLoads(m_morisonElements, MORISON_LOADS, 1.0, refPos);
 
 }
 
@@ -10269,6 +10550,12 @@ void StrModel::SUBSTRUCTURE_ReadSubStructureData(QString *error_msg){
     useNewmanApproximation = false;
     useMeanDrift = false;
     useSumFrequencies = false;
+    useFastQTF = true;
+    qtfLowRankTolerance = 0;
+    useRadiationStateSpace = false;
+    usePrecomputedDiffraction = false;
+    radSSMaxOrder = 20;
+    radSSTolerance = 0.01;
     waveKinEvalTypeMor = LOCALEVAL;
     waveKinEvalTypePot = REFEVAL;
     waveKinTau = 30;
@@ -10314,6 +10601,31 @@ void StrModel::SUBSTRUCTURE_ReadSubStructureData(QString *error_msg){
             useRadiation = true;
     }
 
+    value = "USE_RAD_STATESPACE";
+    strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
+    if (found){
+        if (strong == "true" || strong == "TRUE" || strong == "True" || strong == "1")
+            useRadiationStateSpace = true;
+    }
+
+    value = "RAD_SS_MAXORDER";
+    strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
+    if (found){
+        radSSMaxOrder = strong.toInt(&converted);
+        if(!converted){
+            error_msg->append("\n"+value+" could not be converted");
+        }
+    }
+
+    value = "RAD_SS_TOL";
+    strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
+    if (found){
+        radSSTolerance = strong.toDouble(&converted);
+        if(!converted){
+            error_msg->append("\n"+value+" could not be converted");
+        }
+    }
+
     value = "USE_EXCITATION";
     strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
     if (found){
@@ -10328,6 +10640,13 @@ void StrModel::SUBSTRUCTURE_ReadSubStructureData(QString *error_msg){
             useDiffFrequencies = true;
     }
 
+    value = "USE_PRECOMP_EXC";
+    strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
+    if (found){
+        if (strong == "true" || strong == "TRUE" || strong == "True" || strong == "1")
+            usePrecomputedDiffraction = true;
+    }
+
     value = "DIFFRACTION_OFFSET";
     strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
     if (found){
@@ -10367,6 +10686,22 @@ void StrModel::SUBSTRUCTURE_ReadSubStructureData(QString *error_msg){
             useMeanDrift = true;
     }
 
+    value = "USE_FAST_QTF";
+    strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
+    if (found){
+        if (strong == "false" || strong == "FALSE" || strong == "False" || strong == "0")
+            useFastQTF = false;
+    }
+
+    value = "QTF_LOWRANK_TOL";
+    strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
+    if (found){
+        qtfLowRankTolerance = strong.toDouble(&converted);
+        if(!converted){
+            error_msg->append("\n"+value+" could not be converted");
+        }
+    }
+
     value = "DELTA_FREQ_RAD";
     strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
     if (found){
@@ -10471,6 +10806,14 @@ void StrModel::SUBSTRUCTURE_ReadSubStructureData(QString *error_msg){
         }
     }
 
+    // the precomputed excitation series is only valid for a fixed evaluation point, with a local or lagged evaluation
+    // the point moves every step and the series would be computed for the whole run and discarded in the first step
+
+    if (usePrecomputedDiffraction && waveKinEvalTypePot != REFEVAL){
+        usePrecomputedDiffraction = false;
+        qDebug().noquote() << "...USE_PRECOMP_EXC requires WAVEKINEVAL_POT = 1 (reference position), the diffraction forces are evaluated by convolution";
+    }
+
     value = "WAVEKINTAU";
     strong = FindValueInFile(value,subStructureStream,error_msg,false,&found);
     if (found){
@@ -11068,6 +11411,7 @@ StrModel::StrModel()
     m_ChSystem = NULL;
     m_ChMesh = NULL;
     m_ChLoadContainer = NULL;
+    m_numAeroLoadSteps = 0;
     yaw_motor = NULL;
     m_YawNodeFree = NULL;
     m_HubNodeLSS = NULL;
@@ -11235,7 +11579,7 @@ void StrModel::POTFLOW_ApplyForces(){
 
             potFlowBodyData[i].diffraction_forces = POTFLOW_CalcDiffractionForces(potFlowBodyData[i]);
 
-            POTFLOW_CalcSecondOrder_Forces(potFlowBodyData[i].sum_forces,potFlowBodyData[i].difference_forces,potFlowBodyData[i].QTF_d,potFlowBodyData[i].QTF_s,potFlowBodyData[i].floaterHYDRO->waveKinEvalPos);
+            POTFLOW_CalcSecondOrder_Forces(potFlowBodyData[i],potFlowBodyData[i].floaterHYDRO->waveKinEvalPos);
 
             if (useMeanDrift) potFlowBodyData[i].difference_forces = potFlowBodyData[i].meanDrift_forces;
 
@@ -13351,6 +13695,17 @@ void StrModel::POTFLOW_Initialize()
 
         //initialization stuff
         potFlowBodyData[i].FloaterHistory.clear();
+        potFlowBodyData[i].FloaterHistoryHead = 0;
+        potFlowBodyData[i].radSSPole.clear();
+        potFlowBodyData[i].radSSResidue.clear();
+        potFlowBodyData[i].radSSState.clear();
+        potFlowBodyData[i].radSSInput.clear();
+        potFlowBodyData[i].radSSOutput.clear();
+        potFlowBodyData[i].radSSFitError.setZero();
+        potFlowBodyData[i].diffractionSeries.clear();
+        potFlowBodyData[i].offsetDiffractionSeries.clear();
+        potFlowBodyData[i].diffractionSeriesStart = 0;
+        potFlowBodyData[i].diffractionSeriesEvaluated = false;
         potFlowBodyData[i].k_1.resize(0);
         potFlowBodyData[i].k_2.resize(0);
         potFlowBodyData[i].k_3.resize(0);
@@ -13358,6 +13713,28 @@ void StrModel::POTFLOW_Initialize()
         potFlowBodyData[i].k_5.resize(0);
         potFlowBodyData[i].k_6.resize(0);
 
+        int potFlowType = BEMUSE;
+        if (potentialRADFileNames.size() > i){
+            if (potentialRADFileNames[i].contains(".tec")) potFlowType = NEMOH;
+            if (potentialRADFileNames[i].contains(".1")) potFlowType = WAMIT;
+        }
+
+        // the preprocessed IRF's and QTF's are reused if the databases and settings did not change
+
+        QString cacheKey;
+        if (PotentialFlowCache::isEnabled() && (useRadiation || useDiffraction || useSumFrequencies || useDiffFrequencies || useNewmanApproximation || useMeanDrift))
+            cacheKey = POTFLOW_GetCacheKey(i,potFlowType);
+
+        if (PotentialFlowCache::lookup(cacheKey,potFlowBodyData[i])){
+
+            if (debugStruct) qDebug() << "POTFLOW: Loaded preprocessed data of body" << i << "from the cache";
+
+            if (useDiffraction) POTFLOW_Diffraction_Interpolate(potFlowBodyData[i]);
+            if (potFlowBodyData[i].QTF_d.size()) POTFLOW_CalculateMeanDriftForces(potFlowBodyData[i].QTF_d,potFlowBodyData[i].meanDrift_forces);
+
+            continue;
+        }
+
         // create variables
         QVector<Eigen::MatrixXf> B_ij;
         QVector<Eigen::MatrixXf> B_ij_int;
@@ -13375,12 +13752,6 @@ void StrModel::POTFLOW_Initialize()
 
         if (useRadiation || useDiffraction){
 
-            int potFlowType = BEMUSE;
-            if (potentialRADFileNames.size() > i){
-                if (potentialRADFileNames[i].contains(".tec")) potFlowType = NEMOH;
-                if (potentialRADFileNames[i].contains(".1")) potFlowType = WAMIT;
-            }
-
             if (potFlowType == BEMUSE && RADStreamPtr->size() > i) POTFLOW_ReadBEMuse(B_ij, A_ij, X_ij, w, (*RADStreamPtr)[i],potFlowBodyData[i]);
             else if (potFlowType == NEMOH && EXCStreamPtr->size() > i && RADStreamPtr->size() > i) POTFLOW_ReadNemoh(B_ij, A_ij, X_ij, w, (*RADStreamPtr)[i],(*EXCStreamPtr)[i],potFlowBodyData[i]);
             else if (potFlowType == WAMIT && EXCStreamPtr->size() > i && RADStreamPtr->size() > i) POTFLOW_ReadWamit(B_ij, A_ij, X_ij, w, (*RADStreamPtr)[i],(*EXCStreamPtr)[i],potFlowBodyData[i]);
@@ -13388,6 +13759,7 @@ void StrModel::POTFLOW_Initialize()
             if (useRadiation){
                 POTFLOW_InterpolateDampingCoefficients(B_ij,B_ij_int,w,w_rad);
                 POTFLOW_Radiation_IRF(w_rad, B_ij_int,potFlowBodyData[i]);
+                if (useRadiationStateSpace) POTFLOW_Radiation_StateSpace(potFlowBodyData[i]);
             }
 
             if (useDiffraction){
@@ -13400,20 +13772,79 @@ void StrModel::POTFLOW_Initialize()
         if (useSumFrequencies && SUMStreamPtr->size() > i){
             POTFLOW_ReadWamit_SUM_QTF(qtf_s,w_i,w_j,(*SUMStreamPtr)[i]);
             POTFLOW_Interpolate2ndOrderCoefficients(qtf_s,potFlowBodyData[i].QTF_s,w_i, w_j);
+            if (useFastQTF && qtfLowRankTolerance > 0) POTFLOW_CompressQTF(potFlowBodyData[i].QTF_s,potFlowBodyData[i].QTF_s_L,potFlowBodyData[i].QTF_s_R);
         }
 
         if ((useDiffFrequencies || useNewmanApproximation || useMeanDrift) && DIFFStreamPtr->size() > i){
             POTFLOW_ReadWamit_DIFF_QTF(qtf_d,w_i,w_j,(*DIFFStreamPtr)[i]);
             POTFLOW_Interpolate2ndOrderCoefficients(qtf_d,potFlowBodyData[i].QTF_d,w_i, w_j);
             POTFLOW_CalculateMeanDriftForces(potFlowBodyData[i].QTF_d,potFlowBodyData[i].meanDrift_forces);
+            if (useFastQTF && qtfLowRankTolerance > 0) POTFLOW_CompressQTF(potFlowBodyData[i].QTF_d,potFlowBodyData[i].QTF_d_L,potFlowBodyData[i].QTF_d_R);
         }
 
+        PotentialFlowCache::store(cacheKey,potFlowBodyData[i]);
+
     }
 
     POTFLOW_CreateGraphData();
 
 }
 
+QString StrModel::POTFLOW_GetCacheKey(int body, int potFlowType){
+
+    // hash of the database contents and of all settings that enter the preprocessing of a body, the wave
+    // frequencies only enter the key if QTF's are interpolated to them
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+
+    double density = designDensity, gravity = 9.81, timestep = d_t_irf;
+    if (m_QTurbine->m_QSim){
+        density = m_QTurbine->m_QSim->m_waterDensity;
+        gravity = m_QTurbine->m_QSim->m_gravity;
+        timestep = float(m_QTurbine->m_QSim->m_timestepSize);
+    }
+
+    QVector<double> settings;
+    settings << potFlowType << density << gravity << timestep << unitLengthWAMIT << d_f_radiation << d_f_diffraction << t_trunc_rad << t_trunc_diff
+             << useRadiation << useDiffraction << useRadiationStateSpace << radSSMaxOrder << radSSTolerance
+             << useSumFrequencies << useDiffFrequencies << useNewmanApproximation << useMeanDrift << useFastQTF << qtfLowRankTolerance;
+
+    hash.addData((const char *) settings.constData(), settings.size()*sizeof(double));
+
+    auto addStream = [&hash] (QList<QStringList> *streams, int index){
+        if (streams->size() > index) hash.addData(streams->at(index).join("\n").toUtf8());
+        hash.addData("|", 1);
+    };
+
+    bool secondOrder = false;
+
+    if (useRadiation || useDiffraction){
+        addStream(RADStreamPtr,body);
+        addStream(EXCStreamPtr,body);
+    }
+    if (useSumFrequencies){
+        addStream(SUMStreamPtr,body);
+        secondOrder = (SUMStreamPtr->size() > body);
+    }
+    if (useDiffFrequencies || useNewmanApproximation || useMeanDrift){
+        addStream(DIFFStreamPtr,body);
+        secondOrder = secondOrder || (DIFFStreamPtr->size() > body);
+    }
+
+    if (secondOrder){
+        if (!m_QTurbine->m_QSim || !m_QTurbine->m_QSim->m_linearWave) return QString();
+        QVector<float> omega;
+        for (int n = 0; n < m_QTurbine->m_QSim->m_linearWave->waveTrains.size(); n++)
+            omega.append(m_QTurbine->m_QSim->m_linearWave->waveTrains.at(n).omega);
+        hash.addData((const char *) omega.constData(), omega.size()*sizeof(float));
+    }
+
+    int format = 1;
+    hash.addData((const char *) &format, sizeof(int));
+
+    return QString(hash.result().toHex());
+}
+
 void StrModel::POTFLOW_CalculateMeanDriftForces(QVector<Eigen::MatrixXcf> &QTF_d, Eigen::Matrix<float, 6, 1> &F_Mean){
 
     if (QTF_d.size()){
@@ -13428,9 +13859,48 @@ void StrModel::POTFLOW_CalculateMeanDriftForces(QVector<Eigen::MatrixXcf> &QTF_d
     }
 }
 
-void StrModel::POTFLOW_CalcSecondOrder_Forces(Eigen::Matrix<float, 6, 1> &F_Sum, Eigen::Matrix<float, 6, 1> &F_Diff, QVector<Eigen::MatrixXcf> &QTF_d, QVector<Eigen::MatrixXcf> &QTF_s, Vec3 &floaterPosition)
+void StrModel::POTFLOW_CompressQTF(QVector<Eigen::MatrixXcf> &QTF, QVector<Eigen::MatrixXcf> &L, QVector<Eigen::MatrixXcf> &R){
+
+    // the QTF of each dof is replaced by a truncated SVD: QTF = U*S*V^H ~ L*R^H with L = U_r*S_r and R = V_r,
+    // all singular values below qtfLowRankTolerance*s_max are dropped. If the rank reduction does not pay off
+    // (2*r >= N) the factors of this dof are left empty and the full matrix is used
+
+    L.clear();
+    R.clear();
+
+    for (int dof=0; dof<QTF.size(); dof++){
+
+        Eigen::MatrixXcf Ldof, Rdof;
+        const int size = QTF[dof].rows();
+
+        if (size){
+            Eigen::BDCSVD<Eigen::MatrixXcf> svd(QTF[dof], Eigen::ComputeThinU | Eigen::ComputeThinV);
+            const Eigen::VectorXf &sigma = svd.singularValues();
+
+            int rank = 0;
+            while (rank < sigma.size() && sigma(rank) > qtfLowRankTolerance*sigma(0)) rank++;
+
+            if (2*rank < size){
+                Ldof = svd.matrixU().leftCols(rank)*sigma.head(rank).asDiagonal();
+                Rdof = svd.matrixV().leftCols(rank);
+            }
+
+            if (debugStruct) qDebug() << "POTFLOW: QTF dof" << dof << "size" << size << "rank" << rank << "truncation error" << (rank < sigma.size() ? sigma(rank)/sigma(0) : 0) << (2*rank < size ? "compressed" : "not compressed");
+        }
+
+        L.append(Ldof);
+        R.append(Rdof);
+    }
+}
+
+void StrModel::POTFLOW_CalcSecondOrder_Forces(potentialFlowBodyData &data, Vec3 &floaterPosition)
 {
 
+    Eigen::Matrix<float, 6, 1> &F_Sum = data.sum_forces;
+    Eigen::Matrix<float, 6, 1> &F_Diff = data.difference_forces;
+    QVector<Eigen::MatrixXcf> &QTF_d = data.QTF_d;
+    QVector<Eigen::MatrixXcf> &QTF_s = data.QTF_s;
+
     if (!QTF_d.size() && !QTF_s.size()) return;
 
     if (!m_QTurbine) return;
@@ -13462,9 +13932,43 @@ void StrModel::POTFLOW_CalcSecondOrder_Forces(Eigen::Matrix<float, 6, 1> &F_Sum,
     bool DIFF = QTF_d.size() && !useNewmanApproximation && useDiffFrequencies && !useMeanDrift;
     bool SUM = QTF_s.size();
 
+    //FAST QTF
+
+    if ((DIFF || SUM) && useFastQTF){
+
+        // with the wave phasors a_i = Zeta_i*exp(i*(omega_i*T+epsilon_i)) the double sums factorize into
+        // F_Sum = Re(a^T*QTF_s*a) and F_Diff = Re(a^H*QTF_d*a), so only one complex exponential per wave train
+        // is needed and each dof is a (vectorized) quadratic form, or two projections if the QTF is compressed
+
+        const double time = m_QTurbine->m_QSim->m_currentTime+m_QTurbine->m_QSim->m_linearWave->timeoffset;
+
+        Eigen::VectorXcf a(size);
+        for (int i = 0; i < size; i++){
+            const double phase = omega_i[i]*time+epsilon_i[i];
+            a(i) = std::complex<float>(Zeta_ij[i]*cos(phase), Zeta_ij[i]*sin(phase));
+        }
+
+        for (int dof = 0; dof < 6; dof++)
+        {
+            if (SUM){
+                if (data.QTF_s_L.size() > dof && data.QTF_s_L[dof].cols())
+                    F_Sum[dof] = std::real((data.QTF_s_L[dof].transpose()*a).cwiseProduct(data.QTF_s_R[dof].adjoint()*a).sum());
+                else
+                    F_Sum[dof] = std::real(a.cwiseProduct(QTF_s[dof]*a).sum());
+            }
+
+            if (DIFF){
+                if (data.QTF_d_L.size() > dof && data.QTF_d_L[dof].cols())
+                    F_Diff[dof] = std::real((data.QTF_d_L[dof].adjoint()*a).dot(data.QTF_d_R[dof].adjoint()*a));
+                else
+                    F_Diff[dof] = std::real(a.dot(QTF_d[dof]*a));
+            }
+        }
+    }
+
     //FULL QTF
 
-    if (DIFF || SUM){
+    else if (DIFF || SUM){
         for (int dof = 0; dof < 6; dof++)
         {
             const std::complex<float> i_comp(0.0,1.0);
@@ -13657,6 +14161,34 @@ void StrModel::POTFLOW_CreateGraphData(){
             m_QTurbine->m_avaliableRadiationIRFData.append(number+"K66: ");
             m_QTurbine->m_RadiationIRFData.append(k66);
 
+            // fit quality report: IRF's reconstructed from the state space models
+
+            if (potFlowBodyData[i].radSSPole.size()){
+
+                const potentialFlowBodyData &data = potFlowBodyData[i];
+                const int length = data.k_1.rows()/6;
+
+                for (int r = 0; r < 6; r++){
+                    for (int c = 0; c < 6; c++){
+
+                        QVector<float> kss(length,0);
+                        for (int m = 0; m < data.radSSPole.size(); m++){
+                            if (data.radSSOutput[m] != r || data.radSSInput[m] != c) continue;
+                            std::complex<double> z = data.radSSResidue[m];
+                            for (int k = 0; k < length; k++){
+                                kss[k] += std::real(z);
+                                z *= data.radSSPole[m];
+                            }
+                        }
+
+                        m_QTurbine->m_avaliableRadiationIRFData.append(number+"K"+QString().number(r+1)+QString().number(c+1)+" SS: ");
+                        m_QTurbine->m_RadiationIRFData.append(kss);
+
+                        if (debugStruct) qDebug() << "POTFLOW: Radiation state space fit error K"+QString().number(r+1)+QString().number(c+1) << data.radSSFitError(r,c);
+                    }
+                }
+            }
+
         }
 
     }
@@ -13783,6 +14315,129 @@ void StrModel::POTFLOW_Radiation_IRF(QVector<float> w, QVector<Eigen::MatrixXf>
 
 }
 
+void StrModel::POTFLOW_Radiation_StateSpace(potentialFlowBodyData &data){
+
+    // Identifies a modal state space realization K_ij(t) ~ Re(sum_m r_m*exp(p_m*t)) for each radiation IRF
+    // with the Hankel singular value method (Kung). The IRF's are resampled so that the Hankel matrices stay
+    // small, the poles are then transformed back to the simulation timestep. With the discrete poles
+    // l_m = exp(p_m*dt) the convolution integral reduces to the recursion z_m = l_m*z_m + v_j, F_i = dt*Re(sum_m r_m*z_m).
+    // The order of each kernel is increased until the relative L2 error of the reconstructed IRF is below
+    // radSSTolerance; if any kernel misses the tolerance the convolution is used for this body
+
+    const int length = data.k_1.rows()/6;
+    if (length < 4) return;
+
+    if (debugStruct) qDebug() << "POTFLOW: Identify Radiation State Space Models";
+
+    float timestep = d_t_irf;
+    if(m_QTurbine->m_QSim)
+        timestep = m_QTurbine->m_QSim->m_timestepSize;
+
+    Eigen::VectorXf *K[6] = {&data.k_1, &data.k_2, &data.k_3, &data.k_4, &data.k_5, &data.k_6};
+
+    float maxK = 0;
+    for (int i = 0; i < 6; i++) maxK = std::max(maxK, K[i]->cwiseAbs().maxCoeff());
+    if (maxK == 0) return;
+
+    const int hankelSize = 100;
+    const int stride = std::max(1,(length+2*hankelSize-1)/(2*hankelSize));
+    const int samples = (length-1)/stride+1;
+    const int rows = samples/2, cols = samples-rows;
+
+    bool converged = true;
+
+    for (int i = 0; i < 6; i++){
+        for (int j = 0; j < 6; j++){
+
+            Eigen::VectorXd g(length);
+            for (int k = 0; k < length; k++) g(k) = (*K[i])(k*6+j);
+
+            // kernels that are negligible compared to the largest one are dropped
+            if (g.cwiseAbs().maxCoeff() < 1e-6*maxK) continue;
+
+            Eigen::MatrixXd H0(rows,cols), H1(rows,cols);
+            for (int r = 0; r < rows; r++){
+                for (int c = 0; c < cols; c++){
+                    H0(r,c) = g(stride*(r+c));
+                    H1(r,c) = (r+c+1 < samples) ? g(stride*(r+c+1)) : 0;
+                }
+            }
+
+            Eigen::BDCSVD<Eigen::MatrixXd> svd(H0, Eigen::ComputeThinU | Eigen::ComputeThinV);
+            const Eigen::VectorXd &sigma = svd.singularValues();
+
+            std::vector<std::complex<double>> bestPole, bestResidue;
+            double bestError = 1;
+
+            for (int order = 1; order <= std::min<int>(radSSMaxOrder,sigma.size()); order++){
+
+                if (sigma(order-1) <= 1e-12*sigma(0)) break;
+
+                Eigen::VectorXd sq = sigma.head(order).cwiseSqrt();
+                Eigen::VectorXd isq = sq.cwiseInverse();
+                Eigen::MatrixXd A = isq.asDiagonal()*svd.matrixU().leftCols(order).transpose()*H1*svd.matrixV().leftCols(order)*isq.asDiagonal();
+                Eigen::VectorXd B = sq.asDiagonal()*svd.matrixV().row(0).head(order).transpose();
+                Eigen::RowVectorXd C = svd.matrixU().row(0).head(order)*sq.asDiagonal();
+
+                Eigen::EigenSolver<Eigen::MatrixXd> eig(A);
+                Eigen::MatrixXcd W = eig.eigenvectors();
+                Eigen::VectorXcd CW = C.cast<std::complex<double>>()*W;
+                Eigen::VectorXcd WB = W.inverse()*B.cast<std::complex<double>>();
+
+                std::vector<std::complex<double>> pole, residue;
+                for (int m = 0; m < order; m++){
+                    const std::complex<double> lambda = eig.eigenvalues()(m);
+                    if (std::abs(lambda) >= 1.0 || std::abs(lambda) == 0) continue; // unstable or degenerate mode
+                    pole.push_back(std::exp(std::log(lambda)*(1.0/stride)));
+                    residue.push_back(CW(m)*WB(m));
+                }
+
+                std::vector<std::complex<double>> z(pole.size(),1.0);
+                double error = 0;
+                for (int k = 0; k < length; k++){
+                    double value = 0;
+                    for (int m = 0; m < pole.size(); m++){
+                        value += std::real(residue[m]*z[m]);
+                        z[m] *= pole[m];
+                    }
+                    error += pow(value-g(k),2);
+                }
+                error = sqrt(error)/g.norm();
+
+                if (error < bestError){
+                    bestError = error;
+                    bestPole = pole;
+                    bestResidue = residue;
+                }
+
+                if (error <= radSSTolerance) break;
+            }
+
+            data.radSSFitError(i,j) = bestError;
+            if (bestError > radSSTolerance) converged = false;
+
+            for (int m = 0; m < bestPole.size(); m++){
+                data.radSSPole.push_back(bestPole[m]);
+                data.radSSResidue.push_back(bestResidue[m]);
+                data.radSSInput.push_back(j);
+                data.radSSOutput.push_back(i);
+            }
+        }
+    }
+
+    if (debugStruct) qDebug().noquote() << "POTFLOW: Radiation state space with" << data.radSSPole.size() << "states, max. IRF fit error" << QString().number(data.radSSFitError.maxCoeff()*100.0,'f',2)+"%";
+
+    if (!converged){
+        if (debugStruct) qDebug() << "Warning!! Radiation state space fit did not reach RAD_SS_TOL, increase RAD_SS_MAXORDER - using the IRF convolution instead";
+        data.radSSPole.clear();
+        data.radSSResidue.clear();
+        data.radSSInput.clear();
+        data.radSSOutput.clear();
+    }
+
+    data.radSSState.assign(data.radSSPole.size(),0.0);
+}
+
 
 void StrModel::POTFLOW_InterpolateExcitationCoefficients (QVector<Eigen::MatrixXcf> &X_ij, QVector<Eigen::MatrixXcf> &X_ij_int, QVector<float> &w, QVector<float> &w_int, potentialFlowBodyData &data){
     // Function interpolates excitation force coefficients if boolean "interpolate_diff" is set to true
@@ -14144,25 +14799,43 @@ Eigen::Matrix< float, 6, 1 > StrModel::POTFLOW_CalcRadiationForces(potentialFlow
     pos_dt.push_back(data.floaterHYDRO->GetRot().GetZaxis().Dot(rot_dt));
 
 
-    data.FloaterHistory.insert(data.FloaterHistory.begin(),pos_dt.begin(),pos_dt.end());
+    // state space approximation of the convolution integral
 
-    // fill floaterVelociy to enable dot product
-    int fill = (data.k_1.size()) - data.FloaterHistory.size();
-    if (fill>0)
-    data.FloaterHistory.insert(data.FloaterHistory.end(),fill,0);
-    // copy floater velocity memory vector & rows of IRF_Matrix into Eigen::Array
+    if (data.radSSPole.size()){
 
-    if (data.FloaterHistory.size() > data.k_1.rows()) data.FloaterHistory.resize(data.k_1.rows());
+        std::vector<double> F(6,0);
+        for (int m = 0; m < data.radSSPole.size(); m++){
+            data.radSSState[m] = data.radSSPole[m]*data.radSSState[m] + (double) pos_dt[data.radSSInput[m]];
+            F[data.radSSOutput[m]] += std::real(data.radSSResidue[m]*data.radSSState[m]);
+        }
+
+        for (int i = 0; i < 6; i++) F_Radiation(i) = F[i]*m_QTurbine->m_QSim->m_timestepSize;
+
+        return F_Radiation;
+    }
+
+    // convolution with the IRF's, the velocity history is stored in a ring buffer so that the newest
+    // velocity is found at FloaterHistoryHead and the older ones follow (wrapping around at the end)
 
-    Eigen::VectorXf floaterV = Eigen::VectorXf::Map(data.FloaterHistory.data(), data.FloaterHistory.size());
+    const int length = data.k_1.rows();
+    if (!length) return F_Radiation;
+
+    if (data.FloaterHistory.size() != length){
+        data.FloaterHistory.assign(length,0);
+        data.FloaterHistoryHead = 0;
+    }
+
+    data.FloaterHistoryHead = (data.FloaterHistoryHead - 6 + length) % length;
+    for (int i = 0; i < 6; i++) data.FloaterHistory[data.FloaterHistoryHead+i] = pos_dt[i];
+
+    const int head = data.FloaterHistoryHead;
+    Eigen::Map<Eigen::VectorXf> floaterV(data.FloaterHistory.data(), length);
+
+    Eigen::VectorXf *K[6] = {&data.k_1, &data.k_2, &data.k_3, &data.k_4, &data.k_5, &data.k_6};
 
     // Fill Radiation damping force vector
-    F_Radiation(0) = data.k_1.dot(floaterV)*m_QTurbine->m_QSim->m_timestepSize;
-    F_Radiation(1) = data.k_2.dot(floaterV)*m_QTurbine->m_QSim->m_timestepSize;
-    F_Radiation(2) = data.k_3.dot(floaterV)*m_QTurbine->m_QSim->m_timestepSize;
-    F_Radiation(3) = data.k_4.dot(floaterV)*m_QTurbine->m_QSim->m_timestepSize;
-    F_Radiation(4) = data.k_5.dot(floaterV)*m_QTurbine->m_QSim->m_timestepSize;
-    F_Radiation(5) = data.k_6.dot(floaterV)*m_QTurbine->m_QSim->m_timestepSize;
+    for (int i = 0; i < 6; i++)
+        F_Radiation(i) = (K[i]->head(length-head).dot(floaterV.tail(length-head)) + K[i]->tail(head).dot(floaterV.head(head)))*m_QTurbine->m_QSim->m_timestepSize;
 
 //    qDebug() << "K_1.size()"<<k_1.rows()<<k_1.cols()<<floaterV.rows()<<floaterV.cols()<<k_5.dot(floaterV)*m_QTurbine->m_QSim->m_timestepSize;
 
@@ -14185,6 +14858,53 @@ Eigen::Matrix< float, 6, 1 > StrModel::POTFLOW_CalcDiffractionForces(potentialFl
 
     if (debugStruct) qDebug() << "POTFLOW: Calculate Diffraction Forces";
 
+    if (usePrecomputedDiffraction){
+
+        // for linear waves at a fixed reference point the excitation forces of the whole run are evaluated
+        // once, the series is then only interpolated at the current time
+
+        if (!data.diffractionSeriesEvaluated){
+            data.diffractionSeriesEvaluated = true;
+            data.diffractionSeriesStart = m_QTurbine->m_currentTime;
+            data.diffractionSeriesPos = data.floaterHYDRO->waveKinEvalPos;
+            POTFLOW_PrecomputeDiffractionSeries(data,data.directionalAmplitudeHistory,0,data.diffractionSeries);
+            if (data.offsetDirectionalAmplitudeHistory.size())
+                POTFLOW_PrecomputeDiffractionSeries(data,data.offsetDirectionalAmplitudeHistory,diffractionOffset,data.offsetDiffractionSeries);
+        }
+
+        if (data.diffractionSeries.size()){
+
+            const double s = (m_QTurbine->m_currentTime - data.diffractionSeriesStart) / m_QTurbine->m_QSim->m_timestepSize;
+            const int n = floor(s);
+            const bool offsetValid = !data.offsetDirectionalAmplitudeHistory.size() || data.offsetDiffractionSeries.size() == data.diffractionSeries.size();
+
+            if (data.floaterHYDRO->waveKinEvalPos == data.diffractionSeriesPos && offsetValid && n >= 0 && n+1 < data.diffractionSeries.size()){
+
+                const float frac = s - n;
+
+                F_Diffraction = data.diffractionSeries.at(n)*(1.0f-frac) + data.diffractionSeries.at(n+1)*frac;
+
+                if (data.offsetDiffractionSeries.size())
+                    data.offset_diffraction_forces = data.offsetDiffractionSeries.at(n)*(1.0f-frac) + data.offsetDiffractionSeries.at(n+1)*frac;
+
+                return F_Diffraction;
+            }
+
+            // the reference point moved or the series is exceeded: continue with the convolution, the elevation history is
+            // rebuilt as if it had been updated during all steps that were taken from the series
+
+            if (debugStruct) qDebug() << "POTFLOW: Precomputed diffraction series not valid anymore, switching to convolution";
+
+            const int steps = std::max(qRound(s),0);
+            POTFLOW_RebuildDiffractionHistory(data,data.directionalAmplitudeHistory,0,steps);
+            if (data.offsetDirectionalAmplitudeHistory.size())
+                POTFLOW_RebuildDiffractionHistory(data,data.offsetDirectionalAmplitudeHistory,diffractionOffset,steps);
+
+            data.diffractionSeries.clear();
+            data.offsetDiffractionSeries.clear();
+        }
+    }
+
     Eigen::Matrix< float, 6, 1 > d_ij = Eigen::Matrix< float, 6, 1 >::Zero();
 
     for (int tau = 0; tau < data.directionalAmplitudeHistory.size(); tau++){
@@ -14227,6 +14947,122 @@ Eigen::Matrix< float, 6, 1 > StrModel::POTFLOW_CalcDiffractionForces(potentialFl
     return F_Diffraction;
 }
 
+void StrModel::POTFLOW_PrecomputeDiffractionSeries(potentialFlowBodyData &data, QVector<QVector<float> > &history, double timeOffset, QVector<Eigen::Matrix<float, 6, 1> > &series){
+
+    // The convolution of POTFLOW_CalcDiffractionForces() at step n (time t0 + n*dt) evaluates
+    // F[n] = dT * sum_j H_j * A[L-1+n-j], where A holds the initial elevation history (oldest entry first) followed by the
+    // elevations at t0 + m*dt + t_trunc that are prepended during the run. Since the wave elevation at the reference point is
+    // known in advance, this convolution is evaluated for all steps at once with FFT's: the elevations are transformed per
+    // direction, multiplied with the transformed IRF's and summed over the directions in the frequency domain, followed by
+    // one inverse transform per DOF.
+
+    series.clear();
+
+    int L = history.size();
+    int numDir = waveDirInt.size();
+
+    if (!L || !numDir || data.H_ij_int.size() < L) return;
+
+    double dt = m_QTurbine->m_QSim->m_timestepSize;
+    double t0 = data.diffractionSeriesStart;
+    int N = std::max(m_QTurbine->m_QSim->m_numberTimesteps - qRound(t0/dt) + 2, 2);
+
+    if (debugStruct) qDebug().noquote() << "POTFLOW: Precompute Diffraction Forces for" << N << "steps";
+
+    // elevation sequence A
+
+    QVector<QVector<float> > elevation(L+N-1);
+    for (int i=0;i<L;i++) elevation[i] = history.at(L-1-i);
+
+    Vec3 pos = data.diffractionSeriesPos;
+
+    #pragma omp parallel default (none) shared (elevation, pos, L, N, t0, dt, timeOffset)
+    {
+        #pragma omp for
+        for (int m=0;m<N-1;m++)
+            elevation[L+m] = m_QTurbine->m_QSim->m_linearWave->GetElevationPerDirection(pos,t0+m*dt+t_trunc_diff+timeOffset,waveDirInt,d_a_diffraction);
+    }
+
+    int size = 1;
+    while (size < 2*L+N-2) size *= 2;
+
+    QSharedPointer<FFTPlan> plan = FFTPlan::getPlan(size);
+
+    QVector<QVector<std::complex<double> > > spectrum(6);
+    for (int d=0;d<6;d++) spectrum[d].fill(std::complex<double>(0,0),size);
+
+    double dT = m_QTurbine->m_dT;
+    bool valid = true;
+
+    #pragma omp parallel default (none) shared (data, elevation, spectrum, plan, size, L, numDir, dT) reduction (&&:valid)
+    {
+        QVector<QVector<std::complex<double> > > partial(6);
+        QVector<std::complex<double> > A(size), H(size);
+
+        #pragma omp for
+        for (int o=0;o<numDir;o++){
+
+            A.fill(std::complex<double>(0,0));
+            for (int i=0;i<elevation.size();i++){
+                if (elevation.at(i).size() != numDir){ valid = false; break; }
+                A[i] = elevation.at(i).at(o);
+            }
+            plan->Transform(A.data());
+
+            for (int d=0;d<6;d++){
+                H.fill(std::complex<double>(0,0));
+                for (int j=0;j<L;j++) H[j] = data.H_ij_int.at(j)(d,o) * dT;
+                plan->Transform(H.data());
+
+                if (!partial.at(d).size()) partial[d].fill(std::complex<double>(0,0),size);
+                for (int k=0;k<size;k++) partial[d][k] += A.at(k)*H.at(k);
+            }
+        }
+
+        #pragma omp critical
+        {
+            for (int d=0;d<6;d++)
+                for (int k=0;k<partial.at(d).size();k++) spectrum[d][k] += partial.at(d).at(k);
+        }
+    }
+
+    if (!valid) return;
+
+    #pragma omp parallel default (none) shared (spectrum, plan)
+    {
+        #pragma omp for
+        for (int d=0;d<6;d++) plan->Transform(spectrum[d].data(),true);
+    }
+
+    series.resize(N);
+    for (int n=0;n<N;n++)
+        for (int d=0;d<6;d++)
+            series[n](d) = spectrum.at(d).at(L-1+n).real() / size;
+}
+
+void StrModel::POTFLOW_RebuildDiffractionHistory(potentialFlowBodyData &data, QVector<QVector<float> > &history, double timeOffset, int steps){
+
+    // history as it would be after "steps" convolution steps from the precomputed series start, at the current evaluation point
+
+    int L = history.size();
+    double dt = m_QTurbine->m_QSim->m_timestepSize;
+    double t0 = data.diffractionSeriesStart;
+
+    QVector<QVector<float> > rebuilt(L);
+    Vec3 pos = data.floaterHYDRO->waveKinEvalPos;
+
+    #pragma omp parallel default (none) shared (history, rebuilt, pos, L, steps, t0, dt, timeOffset)
+    {
+        #pragma omp for
+        for (int j=0;j<L;j++){
+            if (j < steps) rebuilt[j] = m_QTurbine->m_QSim->m_linearWave->GetElevationPerDirection(pos,t0+(steps-1-j)*dt+t_trunc_diff+timeOffset,waveDirInt,d_a_diffraction);
+            else rebuilt[j] = history.at(j-steps);
+        }
+    }
+
+    history = rebuilt;
+}
+
 void StrModel::SUBSTRUCTURE_CalcMemberFaceInteraction(){
 
     if (!isSubStructure) return;
@@ -28,6 +28,7 @@
 #include <QLibrary>
 
 #include "../QBEM/Blade.h"
+#include "../Waves/LinearWave.h"
 #include "../StorableObject.h"
 
 #include <memory>
@@ -46,16 +47,28 @@
 #include <Eigen/Eigenvalues>
 
 #include "StrObjects.h"
+#include "ChSolverSparseLUReuse.h"
 
 class QTurbine;
 
+enum ELEMENTLOADPASS {MORISON_LOADS, DRAG_BUOYANCY_LOADS, CABLE_DRAG_BUOYANCY_LOADS, MOORING_LOADS};
+
 struct potentialFlowBodyData{
     Eigen::VectorXf k_1, k_2, k_3, k_4, k_5, k_6;
     QVector<Eigen::MatrixXf> H_ij, H_ij_int;
     QVector<Eigen::MatrixXcf> QTF_s, QTF_d;
-    std::vector<float> FloaterHistory;
+    QVector<Eigen::MatrixXcf> QTF_s_L, QTF_s_R, QTF_d_L, QTF_d_R;  // low rank factors QTF = L*R^H, empty if not compressed
+    std::vector<float> FloaterHistory;  // ring buffer of the floater velocities, the newest entry starts at FloaterHistoryHead
+    int FloaterHistoryHead;
+    std::vector<std::complex<double>> radSSPole, radSSResidue, radSSState;  // modal state space approximation of the radiation IRF's, empty if not used
+    std::vector<int> radSSInput, radSSOutput;
+    Eigen::Matrix< float, 6, 6 > radSSFitError;
     QVector<float> waveDir;
     QVector< QVector< float > > directionalAmplitudeHistory, offsetDirectionalAmplitudeHistory;
+    QVector< Eigen::Matrix< float, 6, 1 > > diffractionSeries, offsetDiffractionSeries;  // precomputed excitation forces for the whole run, empty if the convolution is evaluated
+    double diffractionSeriesStart;
+    Vec3 diffractionSeriesPos;
+    bool diffractionSeriesEvaluated;
     Eigen::Matrix< float, 6, 1 > radiation_forces, diffraction_forces, sum_forces, difference_forces, meanDrift_forces, offset_diffraction_forces;
 
     std::shared_ptr<SpringDamperLoad> hydrostaticLoad;
@@ -123,7 +136,10 @@ public:
     void RelaxModel();
     void PretensionCableElements();
     void ApplyExternalForcesAndMoments();
+    void CreateLoadElementLists();
+    void AssembleElementLoads(QVector<AeroHydroElement *> &loadElements, int pass, double factor = 1.0, Vec3 refPos = Vec3(0,0,0));
     void AddAtomicAeroLoads();
+    void ExtrapolateAtomicAeroLoads(double time);
     void AddDistributedAeroLoads();
     void RemoveElementForces();
     bool SolveEigenvalueProblem(const chrono::ChSparseMatrix& M, const chrono::ChSparseMatrix& R, const chrono::ChSparseMatrix& K, const chrono::ChSparseMatrix& Cq,
@@ -273,9 +289,20 @@ public:
     QList<QList<VizNode>> vizNodes;
     QList<std::shared_ptr<ChLoadWrenchAero>> m_AeroPanelLoads;
 
+    // local panel loads of the last three aerodynamic timesteps, index 0 is the latest, used for the multi-rate coupling
+    QVector<Vec3> m_aeroForceHistory[3], m_aeroTorqueHistory[3];
+    double m_aeroLoadTime[3];
+    int m_numAeroLoadSteps;
+
     //chrono objects
     chrono::ChSystemNSC *m_ChSystem;
-    std::shared_ptr<chrono::ChSolverSparseLU> m_ChSparseLUSolver;
+    std::shared_ptr<chrono::ChSolverSparseLUReuse> m_ChSparseLUSolver;
+    int jacobianRefreshSteps, jacobianRefreshIterations;    // Jacobian reuse policy of the modified Newton iteration, 0 steps = full Newton
+    int m_stepsSinceFactorization;
+    int m_numTimestepFactorizations;    // factorizations during AdvanceToTime(), without initialization and ramp-up
+    bool m_bRefreshJacobian;
+    int GetNumFactorizations();
+    bool IsStepConverged();
     std::shared_ptr<chrono::ChLoadContainer> m_ChLoadContainer;
     std::shared_ptr<chrono::fea::ChMesh> m_ChMesh;
 
@@ -354,6 +381,7 @@ public:
     double designDensity;
     QList< std::shared_ptr<SpringDamperLoad> > m_springDamperList;
     double designDepth, subStructureMassTuner, subStructureStiffnessTuner, subStructureBuoyancyTuner, diffractionOffset, windOffset;
+    bool deterministicLoads;
 
     void SUBSTRUCTURE_CreateChBody();
     void SUBSTRUCTURE_CalcMemberFaceInteraction();
@@ -372,6 +400,7 @@ public:
     void SUBSTRUCTURE_AssignElementSeaState();
     void SUBSTRUCTURE_AssignHydrodynamicCoefficients();
     void POTFLOW_Radiation_IRF(QVector<float> w, QVector<Eigen::MatrixXf> B_ij, potentialFlowBodyData &data);
+    void POTFLOW_Radiation_StateSpace(potentialFlowBodyData &data);
     void POTFLOW_DiffractionIRF(QVector<float> w, QVector<Eigen::MatrixXcf> X_ij, potentialFlowBodyData &data);
     void POTFLOW_ReadBEMuse (QVector<Eigen::MatrixXf> &B_ij, QVector<Eigen::MatrixXf> &A_ij, QVector<Eigen::MatrixXcf> &X_ij, QVector<float> &w, QStringList &potRADStream, potentialFlowBodyData &data);
     void POTFLOW_ReadNemoh (QVector<Eigen::MatrixXf> &B_ij, QVector<Eigen::MatrixXf> &A_ij, QVector<Eigen::MatrixXcf> &X_ij, QVector<float> &w, QStringList &potRADStream, QStringList &potEXCStream, potentialFlowBodyData &data);
@@ -381,21 +410,34 @@ public:
     int POTFLOW_sgn(std::complex<float> x);
     void POTFLOW_Interpolate2ndOrderCoefficients(QVector<Eigen::MatrixXcf> &M_input, QVector<Eigen::MatrixXcf> &M_int, QVector<float> &w_i, QVector<float> &w_j);
     void POTFLOW_Initialize();
+    QString POTFLOW_GetCacheKey(int body, int potFlowType);
     void POTFLOW_CreateGraphData();
     void POTFLOW_InterpolateDampingCoefficients (QVector<Eigen::MatrixXf> &B_ij, QVector<Eigen::MatrixXf> &B_ij_int, QVector<float> &w, QVector<float> &w_int);
     void POTFLOW_InterpolateExcitationCoefficients (QVector<Eigen::MatrixXcf> &X_ij, QVector<Eigen::MatrixXcf> &X_ij_int, QVector<float> &w, QVector<float> &w_int, potentialFlowBodyData &data);
-    void POTFLOW_CalcSecondOrder_Forces(Eigen::Matrix<float, 6, 1> &F_Sum, Eigen::Matrix<float, 6, 1> &F_Diff, QVector<Eigen::MatrixXcf> &QTF_d, QVector<Eigen::MatrixXcf> &QTF_s, Vec3 &floaterPosition);
+    void POTFLOW_CalcSecondOrder_Forces(potentialFlowBodyData &data, Vec3 &floaterPosition);
+    void POTFLOW_CompressQTF(QVector<Eigen::MatrixXcf> &QTF, QVector<Eigen::MatrixXcf> &L, QVector<Eigen::MatrixXcf> &R);
     void POTFLOW_CalculateMeanDriftForces(QVector<Eigen::MatrixXcf> &QTF_d, Eigen::Matrix<float, 6, 1> &F_Mean);
     Eigen::Matrix<float, 6, 1> POTFLOW_CalcRadiationForces(potentialFlowBodyData &data);
     Eigen::Matrix<float, 6, 1> POTFLOW_CalcDiffractionForces(potentialFlowBodyData &data);
+    void POTFLOW_PrecomputeDiffractionSeries(potentialFlowBodyData &data, QVector<QVector<float> > &history, double timeOffset, QVector<Eigen::Matrix<float, 6, 1> > &series);
+    void POTFLOW_RebuildDiffractionHistory(potentialFlowBodyData &data, QVector<QVector<float> > &history, double timeOffset, int steps);
     void SUBSTRUCTURE_CreateMembers();
     void SUBSTRUCTURE_CreateSpringsAndDampers();
     void POTFLOW_Diffraction_Interpolate(potentialFlowBodyData &data);
 
     QList<potentialFlowBodyData> potFlowBodyData;
 
+    LinearWave::KinematicsBatch m_waveKinematics;   // positions and wave kinematics of the hydrodynamic nodes, evaluated in one batch per timestep
+    QVector<int> m_waveKinematicsNodes;             // mesh node index of each batch entry
+    QVector<AeroHydroElement *> m_dragBuoyancyElements, m_cableLoadElements, m_rigidDragBuoyancyElements, m_mooringElements, m_morisonElements;   // elements of the parallel load assembly passes, see CreateLoadElementLists()
+
     double t_trunc_rad, t_trunc_diff, d_f_radiation, d_f_diffraction, d_a_diffraction, d_t_irf;
-    bool useDiffraction, useRadiation, useDiffFrequencies, useSumFrequencies, useNewmanApproximation, useMeanDrift;
+    bool useDiffraction, useRadiation, useDiffFrequencies, useSumFrequencies, useNewmanApproximation, useMeanDrift, useFastQTF;
+    double qtfLowRankTolerance;
+    bool useRadiationStateSpace;
+    bool usePrecomputedDiffraction;
+    int radSSMaxOrder;
+    double radSSTolerance;
     QVector<float> waveDirInt;
     std::shared_ptr<chrono::ChLinkMateFix> floaterFixationConstraint;
 
@@ -0,0 +1,183 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+//-----------------------------------------------------------------------------
+//-------------------------Vortex Treecode Functions---------------------------
+//-----------------------------------------------------------------------------
+
+#include "Vortex_Treecode.h"
+
+namespace VPML
+{
+
+//--- Tree construction
+
+void Vortex_Treecode::Build(const std::vector<Treecode_Source> &Src)
+{
+    // The sources are binned into the leafs of an Oct_Tree, the depth of the tree is chosen such
+    // that on average Leaf_Size sources fall into a leaf. The tree is then flattened into a
+    // cluster list for a fast, thread-safe traversal.
+
+    Clear_Tree();
+    StdAppend(Sources,Src);
+    if (Sources.empty()) return;
+
+    //--- Bounding box of the sources
+
+    Vector3 Min = Sources[0].Pos, Max = Sources[0].Pos;
+    for (const Treecode_Source &S : Sources)
+    {
+        Min = Min.cwiseMin(S.Pos);
+        Max = Max.cwiseMax(S.Pos);
+    }
+
+    Origin = 0.5*(Min+Max);
+    Real Half = 0.5*(Max-Min).maxCoeff()*1.001+1e-6;
+
+    //--- Depth of the tree: root is level 0, leafs are at level Depth
+
+    int NL = Sources.size()/std::max(Leaf_Size,1);
+    Depth = 1;
+    while (NL>1 && Depth<Tree_Lim) {NL /= 8; Depth++;}
+    Depth++;                                                // One additional level to resolve clustered wakes
+    if (Depth>Tree_Lim+1) Depth = Tree_Lim+1;
+
+    uint Branch = Tree_Lim+1-Depth;                         // Branch of the leaf boxes
+    H = 2.0*Half/pow(2.0,Tree_Lim+1);                       // Root box side is H*2**(Tree_Lim+1)
+
+    //--- Binning of the sources
+
+    Src_OctTree = new Oct_Tree<Treecode_Bin>();
+
+    for (int i=0; i<Sources.size(); i++)
+    {
+        Vector3 Pos_Ref = Sources[i].Pos - Origin;
+        Cart_ID CID = Src_OctTree->Get_CID(Pos_Ref,H,Branch);
+        Cart_ID CIDS = CID*(1<<Branch);
+        TreeID TID = TreeTemp;
+        Src_OctTree->Get_TID(CIDS,TID,Branch);
+
+        Tree_Node<Treecode_Bin> *Leaf = Src_OctTree->Get_Leaf(TID,Tree_Lim-Branch);
+        if (Leaf->Get_Object()==nullptr) Leaf->Set_Object(std::make_shared<Treecode_Bin>());
+        Leaf->Get_Object()->IDs.push_back(i);
+    }
+
+    //--- Flatten tree and calculate expansions
+
+    Sorted_IDs.reserve(Sources.size());
+    Flatten(Src_OctTree,0,Vector3::Zero(),Half);
+
+    OpenMPfor
+    for (int i=0; i<Clusters.size(); i++) Calc_Moments(Clusters[i]);
+}
+
+int Vortex_Treecode::Flatten(Tree_Node<Treecode_Bin> *Node, const uint &Level, const Vector3 &Centre, const Real &Half)
+{
+    // Depth-first traversal of the Oct_Tree. As the leafs are visited in order each cluster
+    // refers to a contiguous range of the sorted source list.
+
+    if (Level==Depth)
+    {
+        std::shared_ptr<Treecode_Bin> Bin = Node->Get_Object();
+        if (Bin==nullptr || Bin->IDs.empty()) return -1;
+
+        Treecode_Cluster C;
+        C.Centre = Centre + Origin;
+        for (int i=0; i<8; i++) C.Child[i] = -1;
+        C.Src_Start = Sorted_IDs.size();
+        StdAppend(Sorted_IDs,Bin->IDs);
+        C.Src_End = Sorted_IDs.size();
+        Clusters.push_back(C);
+        return Clusters.size()-1;
+    }
+
+    std::vector<Tree_Node<Treecode_Bin>*> Sub;
+    Node->Get_Sub_Nodes(Sub);
+    if (Sub.empty()) return -1;
+
+    int ID = Clusters.size();
+    Treecode_Cluster C;
+    C.Centre = Centre + Origin;
+    C.Src_Start = Sorted_IDs.size();
+    Clusters.push_back(C);
+
+    // Octant ordering follows Oct_Tree::Get_TID: x -> 4, y -> 2, z -> 1
+
+    Real HS = 0.5*Half;
+    for (int i=0; i<8; i++)
+    {
+        Vector3 Shift((i&4) ? HS : -HS, (i&2) ? HS : -HS, (i&1) ? HS : -HS);
+        int CID = Flatten(Sub[i],Level+1,Centre+Shift,HS);
+        Clusters[ID].Child[i] = CID;
+    }
+
+    Clusters[ID].Src_End = Sorted_IDs.size();
+    if (Clusters[ID].Src_End==Clusters[ID].Src_Start)
+    {
+        Clusters.pop_back();
+        return -1;
+    }
+
+    return ID;
+}
+
+void Vortex_Treecode::Calc_Moments(Treecode_Cluster &C)
+{
+    // Multipole moments about the box centre
+
+    C.A = Vector3::Zero();
+    C.A_Str = Vector3::Zero();
+    C.M = Matrix3::Zero();
+    C.P = Matrix3::Zero();
+    C.S2 = Vector3::Zero();
+    for (int k=0; k<6; k++) C.T[k] = Vector3::Zero();
+    C.Radius = 0;
+
+    for (int i=C.Src_Start; i<C.Src_End; i++)
+    {
+        const Treecode_Source &S = Sources[Sorted_IDs[i]];
+        Vector3 D = S.Pos - C.Centre;
+        C.A += S.Alpha;
+        if (S.Stretch) C.A_Str += S.Alpha;
+        C.M += D*S.Alpha.transpose();
+        if (Order>1)
+        {
+            C.P += D*D.cross(S.Alpha).transpose();
+            C.S2 += S.Alpha*D.squaredNorm();
+            C.T[0] += S.Alpha*D(0)*D(0);
+            C.T[1] += S.Alpha*D(0)*D(1);
+            C.T[2] += S.Alpha*D(0)*D(2);
+            C.T[3] += S.Alpha*D(1)*D(1);
+            C.T[4] += S.Alpha*D(1)*D(2);
+            C.T[5] += S.Alpha*D(2)*D(2);
+        }
+        C.Radius = std::max(C.Radius, D.norm()+S.Ext);
+    }
+
+    C.M_Skew = Vector3(C.M(1,2)-C.M(2,1), C.M(2,0)-C.M(0,2), C.M(0,1)-C.M(1,0));
+}
+
+void Vortex_Treecode::Clear_Tree()
+{
+    if (Src_OctTree) delete Src_OctTree;
+    Src_OctTree = nullptr;
+    Sources.clear();
+    Clusters.clear();
+    Sorted_IDs.clear();
+}
+
+}
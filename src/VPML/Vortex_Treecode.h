@@ -0,0 +1,186 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+//-------------------------------------------------------------------
+// Barnes-Hut type treecode for the evaluation of vortex induction---
+//-------------------------------------------------------------------
+
+#ifndef VORTEX_TREECODE_H
+#define VORTEX_TREECODE_H
+
+#include "Math_Types.h"
+#include "Octtree.h"
+
+namespace VPML
+{
+
+//--- Source element as seen by the treecode
+
+struct Treecode_Source
+{
+    Vector3 Pos;            // Centre of the element
+    Vector3 Alpha;          // Vector strength: Gamma*dl for filaments, alpha for particles
+    Real    Ext;            // Half extent of the element (half length for filaments)
+    bool    Stretch;        // Does this source contribute to the stretching of particles?
+};
+
+//--- Binning object stored at the leafs of the Oct_Tree
+
+struct Treecode_Bin
+{
+    std::vector<int> IDs;
+};
+
+//--- Flattened cluster used during the evaluation
+
+struct Treecode_Cluster
+{
+    Vector3 Centre;         // Expansion centre (geometric box centre)
+    Real    Radius;         // Radius of the sphere containing all sources of the cluster
+    Vector3 A;              // Monopole: sum of all source strengths
+    Vector3 A_Str;          // Monopole of the stretching sources
+    Matrix3 M;              // Dipole moment tensor sum(d x alpha)
+    Vector3 M_Skew;         // Antisymmetric part of the dipole tensor
+    Matrix3 P;              // Quadrupole moment sum(d x (d cross alpha))
+    Vector3 S2;             // Quadrupole moment sum(|d|^2 alpha)
+    Vector3 T[6];           // Quadrupole moment sum(d_k d_l alpha), symmetric in kl: xx,xy,xz,yy,yz,zz
+    int     Child[8];       // Indices of the sub clusters, -1 if empty
+    int     Src_Start;      // First entry in the sorted source list
+    int     Src_End;        // Last entry (exclusive) in the sorted source list
+};
+
+class Vortex_Treecode
+{
+protected:
+
+    //--- Tree parameters
+
+    Real    Theta = 0.5;        // Opening angle
+    int     Order = 2;          // Expansion order: 0 -> monopole, 1 -> dipole, 2 -> quadrupole
+    int     Leaf_Size = 16;     // Clusters with fewer sources are evaluated directly
+
+    //--- Tree variables
+
+    Tree_Node<Treecode_Bin> *Src_OctTree = nullptr;
+    Vector3 Origin;
+    Real    H;
+    uint    Depth;
+
+    std::vector<Treecode_Source>    Sources;
+    std::vector<Treecode_Cluster>   Clusters;
+    std::vector<int>                Sorted_IDs;
+
+    int     Flatten(Tree_Node<Treecode_Bin> *Node, const uint &Level, const Vector3 &Centre, const Real &Half);
+    void    Calc_Moments(Treecode_Cluster &C);
+
+public:
+
+    //--- Constructor
+
+    Vortex_Treecode()   {}
+
+    //--- Setup
+
+    void    Set_Parameters(const Real &theta, const int &order, const int &leafsize = 16)
+    {
+        Theta = theta;
+        Order = order;
+        Leaf_Size = leafsize;
+    }
+
+    void    Build(const std::vector<Treecode_Source> &Src);
+    void    Clear_Tree();
+
+    int     N_Sources()     {return Sources.size();}
+    int     N_Clusters()    {return Clusters.size();}
+
+    //--- Evaluation
+
+    template <typename NearField>
+    Vector3 Evaluate(const Vector3 &X, const Vector3 *Alpha_P, Vector3 &Stretch, NearField &Near) const
+    {
+        // Evaluates the velocity induced at X. Clusters which satisfy the opening criterion
+        // are evaluated with the far field expansion, for all other sources Near(ID) is called
+        // and the caller is responsible to evaluate the exact kernel.
+        // If Alpha_P is given the far field contribution to the particle stretching is returned in Stretch.
+
+        Vector3 Vel = Vector3::Zero();
+        if (Clusters.empty()) return Vel;
+
+        Real Theta2 = Theta*Theta;
+
+        int Stack[8*Tree_Lim+8];
+        int NS = 0;
+        Stack[NS++] = 0;
+
+        while (NS>0)
+        {
+            const Treecode_Cluster &C = Clusters[Stack[--NS]];
+
+            Vector3 R = X - C.Centre;
+            Real D2 = R.squaredNorm();
+
+            if (C.Radius*C.Radius < Theta2*D2)
+            {
+                // Far field expansion
+                Real iD2 = 1.0/D2;
+                Real iD3 = iD2/sqrt(D2);
+
+                Vector3 U = R.cross(C.A)*iD3;
+                if (Order>0)    U += (3.0*iD2*R.cross(C.M.transpose()*R) - C.M_Skew)*iD3;
+                if (Order>1)
+                {
+                    Vector3 TRR =   C.T[0]*R(0)*R(0) + C.T[3]*R(1)*R(1) + C.T[5]*R(2)*R(2)
+                                + (C.T[1]*R(0)*R(1) + C.T[2]*R(0)*R(2) + C.T[4]*R(1)*R(2))*2.0;
+                    U += (-3.0*C.P.transpose()*R - 1.5*R.cross(C.S2) + 7.5*iD2*R.cross(TRR))*iD3*iD2;
+                }
+                Vel -= U*FourPIinv;
+
+                if (Alpha_P)
+                {
+                    Vector3 B = Alpha_P->cross(C.A_Str)*iD3;
+                    Vector3 T = R*(Alpha_P->dot(R.cross(C.A_Str)))*3.0*iD3*iD2;
+                    Stretch += (B+T)*FourPIinv;
+                }
+                continue;
+            }
+
+            bool Is_Leaf = true;
+            if (C.Src_End-C.Src_Start > Leaf_Size)
+            {
+                for (int i=0; i<8; i++)
+                {
+                    if (C.Child[i]<0) continue;
+                    Stack[NS++] = C.Child[i];
+                    Is_Leaf = false;
+                }
+            }
+
+            if (Is_Leaf)    for (int i=C.Src_Start; i<C.Src_End; i++) Near(Sorted_IDs[i]);
+        }
+
+        return Vel;
+    }
+
+    //--- Destructor
+
+    ~Vortex_Treecode()  {Clear_Tree();}
+};
+
+}
+
+#endif // VORTEX_TREECODE_H
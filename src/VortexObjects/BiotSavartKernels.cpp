@@ -0,0 +1,478 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "BiotSavartKernels.h"
+#include "src/Params.h"
+#include <cmath>
+#include <algorithm>
+#include <QElapsedTimer>
+
+// the AVX kernels are compiled for x86-64 with gcc/clang (including MinGW) and MSVC; MinGW does not
+// align the stack for 32/64 byte vectors that are spilled in functions with a target attribute, the
+// Windows build therefore lets the assembler emit unaligned vector moves (-muse-unaligned-vector-move
+// in qblade.pro). MSVC needs no target attribute for the intrinsics, the instruction set is only
+// selected at runtime after the cpuid check.
+
+#if (defined(__GNUC__) && defined(__x86_64__)) || (defined(_MSC_VER) && defined(_M_X64))
+    #define BIOTSAVART_SIMD
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+#endif
+
+static inline void lineKernelScalar(Vec3 const &EvalPt, double x1, double y1, double z1, double x2, double y2, double z2, float gamma, float coreSizeSquared, double zSign, double &vx, double &vy, double &vz){
+
+    // same operations as QTurbineSimulationData::biotSavartLineKernel()
+
+    const float r1x = EvalPt.x - x1;
+    const float r1y = EvalPt.y - y1;
+    const float r1z = EvalPt.z - zSign*z1;
+    const float r2x = EvalPt.x - x2;
+    const float r2y = EvalPt.y - y2;
+    const float r2z = EvalPt.z - zSign*z2;
+
+    const float r1abs = sqrtf(r1x*r1x + r1y*r1y + r1z*r1z);
+    const float r2abs = sqrtf(r2x*r2x + r2y*r2y + r2z*r2z);
+    const float r1r2 = r1abs*r2abs;
+
+    const float cx = r1y*r2z - r1z*r2y;
+    const float cy = r1z*r2x - r1x*r2z;
+    const float cz = r1x*r2y - r1y*r2x;
+
+    const float dot = r1x*r2x + r1y*r2y + r1z*r2z;
+
+    const float mag = ((float) zSign*gamma)*(r1abs + r2abs)/12.5663706144f/(r1r2*(r1r2+dot)+coreSizeSquared);
+
+    if (std::isnan(mag) || std::isinf(mag)) return;
+
+    vx += cx*mag;
+    vy += cy*mag;
+    vz += cz*mag;
+}
+
+static inline void particleKernelScalar(Vec3 const &EvalPt, float px, float py, float pz, float ax, float ay, float az, float coresize, float volume, float zSign, VortexParticle *particle_p, Vec3f &dalpha, double &vx, double &vy, double &vz){
+
+    // same operations as QTurbineSimulationData::biotSavartParticleKernel() for the LOA kernel with
+    // transpose scheme stretching and particle strength exchange
+
+    const float rx = (float) EvalPt.x - px;
+    const float ry = (float) EvalPt.y - py;
+    const float rz = (float) EvalPt.z - pz*zSign;
+
+    const float R = sqrtf(rx*rx + ry*ry + rz*rz);
+
+    if (R < 0.000001f) return;
+
+    const float R2 = R*R;
+    const float A2 = coresize*coresize;
+    const float D = R2+A2;
+    const float Coeff_q = 0.07957747154594f/sqrtf(D*D*D);
+
+    const float aqx = ax*zSign;
+    const float aqy = ay*zSign;
+    const float aqz = az;
+
+    const float cx = ry*aqz - rz*aqy;
+    const float cy = rz*aqx - rx*aqz;
+    const float cz = rx*aqy - ry*aqx;
+
+    vx += cx*(-Coeff_q);
+    vy += cy*(-Coeff_q);
+    vz += cz*(-Coeff_q);
+
+    if (particle_p){
+
+        const float Coeff_s = 3.0f*Coeff_q/D;
+
+        const float apx = particle_p->alpha.x;
+        const float apy = particle_p->alpha.y;
+        const float apz = particle_p->alpha.z;
+
+        const float proj = apx*cx + apy*cy + apz*cz;
+
+        dalpha.x += (apy*aqz - apz*aqy)*Coeff_q + rx*proj*Coeff_s;
+        dalpha.y += (apz*aqx - apx*aqz)*Coeff_q + ry*proj*Coeff_s;
+        dalpha.z += (apx*aqy - apy*aqx)*Coeff_q + rz*proj*Coeff_s;
+
+        const float C5 = A2*A2*coresize;
+        const float E = R2/A2+1;
+        const float Diff_Fac = (float) (15*KINVISCAIR/(2*PI_))/C5/sqrtf(E*E*E*E*E*E*E);
+
+        const float volp = particle_p->volume;
+
+        dalpha.x += (aqx*volp - apx*volume)*Diff_Fac;
+        dalpha.y += (aqy*volp - apy*volume)*Diff_Fac;
+        dalpha.z += (aqz*volp - apz*volume)*Diff_Fac;
+    }
+}
+
+#ifdef BIOTSAVART_SIMD
+
+/////////////
+// AVX2, 8 elements per instruction
+/////////////
+
+#ifdef __GNUC__
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+static inline __m256 fromDiff_avx2(__m256d e, const double *p){
+    __m128 lo = _mm256_cvtpd_ps(_mm256_sub_pd(e,_mm256_loadu_pd(p)));
+    __m128 hi = _mm256_cvtpd_ps(_mm256_sub_pd(e,_mm256_loadu_pd(p+4)));
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(lo),hi,1);
+}
+
+static inline __m256 fromSignedDiff_avx2(__m256d e, const double *p, __m256d s){
+    __m128 lo = _mm256_cvtpd_ps(_mm256_sub_pd(e,_mm256_mul_pd(_mm256_loadu_pd(p),s)));
+    __m128 hi = _mm256_cvtpd_ps(_mm256_sub_pd(e,_mm256_mul_pd(_mm256_loadu_pd(p+4),s)));
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(lo),hi,1);
+}
+
+static inline void accumulate_avx2(__m256d &lo, __m256d &hi, __m256 v){
+    lo = _mm256_add_pd(lo,_mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+    hi = _mm256_add_pd(hi,_mm256_cvtps_pd(_mm256_extractf128_ps(v,1)));
+}
+
+static inline double hsumDouble_avx2(__m256d v){
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v),_mm256_extractf128_pd(v,1));
+    s = _mm_add_sd(s,_mm_unpackhi_pd(s,s));
+    return _mm_cvtsd_f64(s);
+}
+
+static inline float hsumFloat_avx2(__m256 v){
+    float t[8];
+    _mm256_storeu_ps(t,v);
+    return ((t[0]+t[1])+(t[2]+t[3]))+((t[4]+t[5])+(t[6]+t[7]));
+}
+
+#define BS_SUFFIX(name) name##_avx2
+#define BS_W 8
+#define VF __m256
+#define VD __m256d
+#define F_SET1(a) _mm256_set1_ps(a)
+#define F_ZERO() _mm256_setzero_ps()
+#define F_LOAD(p) _mm256_loadu_ps(p)
+#define F_ADD(a,b) _mm256_add_ps(a,b)
+#define F_SUB(a,b) _mm256_sub_ps(a,b)
+#define F_MUL(a,b) _mm256_mul_ps(a,b)
+#define F_DIV(a,b) _mm256_div_ps(a,b)
+#define F_SQRT(a) _mm256_sqrt_ps(a)
+#define F_FINITE(v) _mm256_and_ps(v,_mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f),v),_mm256_set1_ps(INFINITY),_CMP_LT_OQ))
+#define F_SELECT_GE(v,a,b) _mm256_and_ps(v,_mm256_cmp_ps(a,b,_CMP_GE_OQ))
+#define F_HSUM(v) hsumFloat_avx2(v)
+#define F_FROM_DIFF(e,p) fromDiff_avx2(e,p)
+#define F_FROM_SIGNED_DIFF(e,p,s) fromSignedDiff_avx2(e,p,s)
+#define D_SET1(a) _mm256_set1_pd(a)
+#define D_ZERO() _mm256_setzero_pd()
+#define D_ADD(a,b) _mm256_add_pd(a,b)
+#define D_ACCUM(lo,hi,v) accumulate_avx2(lo,hi,v)
+#define D_HSUM(v) hsumDouble_avx2(v)
+
+#include "BiotSavartKernelsSIMD.h"
+
+#undef BS_SUFFIX
+#undef BS_W
+#undef VF
+#undef VD
+#undef F_SET1
+#undef F_ZERO
+#undef F_LOAD
+#undef F_ADD
+#undef F_SUB
+#undef F_MUL
+#undef F_DIV
+#undef F_SQRT
+#undef F_FINITE
+#undef F_SELECT_GE
+#undef F_HSUM
+#undef F_FROM_DIFF
+#undef F_FROM_SIGNED_DIFF
+#undef D_SET1
+#undef D_ZERO
+#undef D_ADD
+#undef D_ACCUM
+#undef D_HSUM
+
+#ifdef __GNUC__
+#pragma GCC pop_options
+#endif
+
+/////////////
+// AVX-512, 16 elements per instruction
+/////////////
+
+#ifdef __GNUC__
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+static inline __m512 combine_avx512(__m256 lo, __m256 hi){
+    return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(lo)),_mm256_castps_pd(hi),1));
+}
+
+static inline __m512 fromDiff_avx512(__m512d e, const double *p){
+    __m256 lo = _mm512_cvtpd_ps(_mm512_sub_pd(e,_mm512_loadu_pd(p)));
+    __m256 hi = _mm512_cvtpd_ps(_mm512_sub_pd(e,_mm512_loadu_pd(p+8)));
+    return combine_avx512(lo,hi);
+}
+
+static inline __m512 fromSignedDiff_avx512(__m512d e, const double *p, __m512d s){
+    __m256 lo = _mm512_cvtpd_ps(_mm512_sub_pd(e,_mm512_mul_pd(_mm512_loadu_pd(p),s)));
+    __m256 hi = _mm512_cvtpd_ps(_mm512_sub_pd(e,_mm512_mul_pd(_mm512_loadu_pd(p+8),s)));
+    return combine_avx512(lo,hi);
+}
+
+static inline void accumulate_avx512(__m512d &lo, __m512d &hi, __m512 v){
+    lo = _mm512_add_pd(lo,_mm512_cvtps_pd(_mm512_castps512_ps256(v)));
+    hi = _mm512_add_pd(hi,_mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v),1))));
+}
+
+#define BS_SUFFIX(name) name##_avx512
+#define BS_W 16
+#define VF __m512
+#define VD __m512d
+#define F_SET1(a) _mm512_set1_ps(a)
+#define F_ZERO() _mm512_setzero_ps()
+#define F_LOAD(p) _mm512_loadu_ps(p)
+#define F_ADD(a,b) _mm512_add_ps(a,b)
+#define F_SUB(a,b) _mm512_sub_ps(a,b)
+#define F_MUL(a,b) _mm512_mul_ps(a,b)
+#define F_DIV(a,b) _mm512_div_ps(a,b)
+#define F_SQRT(a) _mm512_sqrt_ps(a)
+#define F_FINITE(v) _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(_mm512_abs_ps(v),_mm512_set1_ps(INFINITY),_CMP_LT_OQ),v)
+#define F_SELECT_GE(v,a,b) _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(a,b,_CMP_GE_OQ),v)
+#define F_HSUM(v) _mm512_reduce_add_ps(v)
+#define F_FROM_DIFF(e,p) fromDiff_avx512(e,p)
+#define F_FROM_SIGNED_DIFF(e,p,s) fromSignedDiff_avx512(e,p,s)
+#define D_SET1(a) _mm512_set1_pd(a)
+#define D_ZERO() _mm512_setzero_pd()
+#define D_ADD(a,b) _mm512_add_pd(a,b)
+#define D_ACCUM(lo,hi,v) accumulate_avx512(lo,hi,v)
+#define D_HSUM(v) _mm512_reduce_add_pd(v)
+
+#include "BiotSavartKernelsSIMD.h"
+
+#undef BS_SUFFIX
+#undef BS_W
+#undef VF
+#undef VD
+#undef F_SET1
+#undef F_ZERO
+#undef F_LOAD
+#undef F_ADD
+#undef F_SUB
+#undef F_MUL
+#undef F_DIV
+#undef F_SQRT
+#undef F_FINITE
+#undef F_SELECT_GE
+#undef F_HSUM
+#undef F_FROM_DIFF
+#undef F_FROM_SIGNED_DIFF
+#undef D_SET1
+#undef D_ZERO
+#undef D_ADD
+#undef D_ACCUM
+#undef D_HSUM
+
+#ifdef __GNUC__
+#pragma GCC pop_options
+#endif
+
+#endif // BIOTSAVART_SIMD
+
+int getMaxSupportedBiotSavartISA(){
+
+#if defined(BIOTSAVART_SIMD) && defined(_MSC_VER)
+    // the OS must also save the ymm (and zmm) registers on a context switch, checked with xgetbv
+    int info[4];
+    __cpuid(info,0);
+    if (info[0] < 7) return BIOTSAVART_SCALAR;
+    __cpuid(info,1);
+    if (!(info[2] & (1<<27)) || !(info[2] & (1<<28))) return BIOTSAVART_SCALAR; // osxsave and avx
+    const unsigned long long xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x6) != 0x6) return BIOTSAVART_SCALAR;
+    __cpuidex(info,7,0);
+    if ((info[1] & (1<<16)) && (xcr0 & 0xe6) == 0xe6) return BIOTSAVART_AVX512;
+    if (info[1] & (1<<5)) return BIOTSAVART_AVX2;
+#elif defined(BIOTSAVART_SIMD)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return BIOTSAVART_AVX512;
+    if (__builtin_cpu_supports("avx2")) return BIOTSAVART_AVX2;
+#endif
+
+    return BIOTSAVART_SCALAR;
+}
+
+static int &currentBiotSavartISA(){
+    static int isa = getMaxSupportedBiotSavartISA();
+    return isa;
+}
+
+int getBiotSavartISA(){
+    return currentBiotSavartISA();
+}
+
+void setBiotSavartISA(int isa){
+    currentBiotSavartISA() = std::max(int(BIOTSAVART_SCALAR),std::min(isa,getMaxSupportedBiotSavartISA()));
+}
+
+QString getBiotSavartISAName(int isa){
+    if (isa == BIOTSAVART_AVX512) return "AVX-512";
+    if (isa == BIOTSAVART_AVX2) return "AVX2";
+    return "Scalar";
+}
+
+Vec3 biotSavartLineInduction(VortexLineArrays &lines, Vec3 const &EvalPt, bool mirror){
+
+    double vx = 0, vy = 0, vz = 0;
+
+    switch (getBiotSavartISA()) {
+#ifdef BIOTSAVART_SIMD
+    case BIOTSAVART_AVX512:
+        lineInduction_avx512(lines,EvalPt,mirror,vx,vy,vz);
+        break;
+    case BIOTSAVART_AVX2:
+        lineInduction_avx2(lines,EvalPt,mirror,vx,vy,vz);
+        break;
+#endif
+    default:{
+        const double zSign = mirror ? -1.0 : 1.0;
+        for (int i=0;i<lines.size();i++)
+            lineKernelScalar(EvalPt,lines.x1[i],lines.y1[i],lines.z1[i],lines.x2[i],lines.y2[i],lines.z2[i],lines.gamma[i],lines.coreSizeSquared[i],zSign,vx,vy,vz);
+        break;
+    }
+    }
+
+    return Vec3(vx,vy,vz);
+}
+
+Vec3 biotSavartParticleInduction(VortexParticleArrays &particles, Vec3 const &EvalPt, bool mirror, VortexParticle *particle_p){
+
+    double vx = 0, vy = 0, vz = 0;
+
+    if (mirror) particle_p = NULL; // no stretching from the ground images
+
+    switch (getBiotSavartISA()) {
+#ifdef BIOTSAVART_SIMD
+    case BIOTSAVART_AVX512:
+        particleInduction_avx512(particles,EvalPt,mirror,particle_p,vx,vy,vz);
+        break;
+    case BIOTSAVART_AVX2:
+        particleInduction_avx2(particles,EvalPt,mirror,particle_p,vx,vy,vz);
+        break;
+#endif
+    default:{
+        const float zSign = mirror ? -1.0f : 1.0f;
+        Vec3f dalpha(0,0,0);
+        for (int i=0;i<particles.size();i++)
+            particleKernelScalar(EvalPt,particles.x[i],particles.y[i],particles.z[i],particles.alphaX[i],particles.alphaY[i],particles.alphaZ[i],particles.coresize[i],particles.volume[i],zSign,particle_p,dalpha,vx,vy,vz);
+        if (particle_p) particle_p->dalpha_dt += dalpha;
+        break;
+    }
+    }
+
+    return Vec3(vx,vy,vz);
+}
+
+QString checkBiotSavartKernels(int numElements, int numPoints){
+
+    /* Compares all supported instruction sets to the scalar kernels for a random cloud of lines and particles,
+     * including the ground images and the particle stretching. The induced velocities may only differ by the
+     * summation order, the deviation is reported relative to the magnitude of the induced velocity.
+     * */
+
+    if (numElements < 1 || numPoints < 1) return QString();
+
+    quint32 seed = 12345;
+    auto random = [&seed](double min, double max){
+        seed = seed*1664525u+1013904223u;
+        return min+(max-min)*double(seed)/4294967296.0;
+    };
+
+    VortexLineArrays lines;
+    VortexParticleArrays particles;
+    QList<VortexParticle> particleList;
+
+    for (int i=0;i<numElements;i++){
+        Vec3 L(random(-50,50),random(-50,50),random(10,110));
+        Vec3 T = L + Vec3(random(-1,1),random(-1,1),random(-1,1));
+        lines.Append(L,T,random(-5,5),random(0.01,1));
+
+        VortexParticle particle;
+        particle.position = Vec3f(random(-50,50),random(-50,50),random(10,110));
+        particle.alpha = Vec3f(random(-5,5),random(-5,5),random(-5,5));
+        particle.coresize = random(0.1,1);
+        particle.volume = random(0.1,1);
+        particleList.append(particle);
+    }
+    particles.Pack(particleList);
+
+    QVector<Vec3> points(numPoints);
+    for (int i=0;i<numPoints;i++) points[i] = Vec3(random(-50,50),random(-50,50),random(10,110));
+    points[0] = Vec3(lines.x1[0],lines.y1[0],lines.z1[0]); // evaluation point on a filament end
+
+    const int userISA = getBiotSavartISA();
+
+    QVector<Vec3> reference(numPoints), referenceStretch(numPoints);
+    QString result;
+
+    for (int isa=BIOTSAVART_SCALAR;isa<=getMaxSupportedBiotSavartISA();isa++){
+
+        setBiotSavartISA(isa);
+
+        double maxError = 0, maxStretchError = 0;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for (int i=0;i<numPoints;i++){
+            VortexParticle particle_p = particleList.at(i%numElements);
+            particle_p.dalpha_dt = Vec3f(0,0,0);
+
+            Vec3 vel = biotSavartLineInduction(lines,points[i]) + biotSavartLineInduction(lines,points[i],true);
+            vel += biotSavartParticleInduction(particles,points[i],false,&particle_p) + biotSavartParticleInduction(particles,points[i],true);
+            Vec3 stretch(particle_p.dalpha_dt.x,particle_p.dalpha_dt.y,particle_p.dalpha_dt.z);
+
+            if (isa == BIOTSAVART_SCALAR){
+                reference[i] = vel;
+                referenceStretch[i] = stretch;
+            }
+            else{
+                maxError = std::max(maxError, Vec3(vel-reference[i]).VAbs()/std::max(reference[i].VAbs(),1e-12));
+                maxStretchError = std::max(maxStretchError, Vec3(stretch-referenceStretch[i]).VAbs()/std::max(referenceStretch[i].VAbs(),1e-12));
+            }
+        }
+
+        const double time = std::max(timer.nsecsElapsed()*1e-9, 1e-9);
+        const double interactions = 4.0*numElements*numPoints;
+
+        result += QString("Biot-Savart kernels %1: %2 interactions/s").arg(getBiotSavartISAName(isa)).arg(interactions/time, 0, 'e', 3);
+        if (isa != BIOTSAVART_SCALAR)
+            result += QString(", max. rel. deviation velocity %1, stretching %2 (%3)").arg(maxError, 0, 'e', 2).arg(maxStretchError, 0, 'e', 2)
+                    .arg((maxError < 1e-6 && maxStretchError < 1e-4) ? "passed" : "FAILED");
+        result += "\n";
+    }
+
+    setBiotSavartISA(userISA);
+
+    return result.trimmed();
+}
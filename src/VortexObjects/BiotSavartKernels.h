@@ -0,0 +1,45 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef BIOTSAVARTKERNELS_H
+#define BIOTSAVARTKERNELS_H
+
+#include <QString>
+#include "src/Vec3.h"
+#include "VortexLineArrays.h"
+
+// Vectorized Biot-Savart kernels for the packed vortex lines and particles. The kernels evaluate
+// 8 (AVX2) or 16 (AVX-512) filaments or particles per instruction, the instruction set is chosen
+// at runtime from the capabilities of the CPU, a scalar implementation is used as fallback. The
+// arithmetic follows biotSavartLineKernel() and biotSavartParticleKernel() (LOA kernel) of
+// QTurbineSimulationData operation by operation, so that all implementations agree within a few
+// ulps; only the summation order of the induced velocity differs.
+// For mirror == true the ground images (z -> -z) of the elements are evaluated.
+
+enum BIOTSAVART_ISA {BIOTSAVART_SCALAR, BIOTSAVART_AVX2, BIOTSAVART_AVX512};
+
+Vec3 biotSavartLineInduction(VortexLineArrays &lines, Vec3 const &EvalPt, bool mirror = false);
+Vec3 biotSavartParticleInduction(VortexParticleArrays &particles, Vec3 const &EvalPt, bool mirror = false, VortexParticle *particle_p = NULL);
+
+int getBiotSavartISA();
+int getMaxSupportedBiotSavartISA();
+void setBiotSavartISA(int isa);             // clamped to the supported instruction sets
+QString getBiotSavartISAName(int isa);
+
+QString checkBiotSavartKernels(int numElements = 20000, int numPoints = 200);    // compares the vectorized kernels to the scalar fallback
+
+#endif // BIOTSAVARTKERNELS_H
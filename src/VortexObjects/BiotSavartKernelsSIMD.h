@@ -0,0 +1,185 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+// Implementation of the vectorized Biot-Savart kernels, this file is included once per instruction
+// set by BiotSavartKernels.cpp, with the vector types and operations defined as macros (no include
+// guard on purpose). The remainder that does not fill a vector is evaluated by the scalar kernels.
+
+static void BS_SUFFIX(lineInduction)(VortexLineArrays &lines, Vec3 const &EvalPt, bool mirror, double &vx, double &vy, double &vz){
+
+    const int num = lines.size();
+    const int numVec = num - num % BS_W;
+
+    const double zSign = mirror ? -1.0 : 1.0;
+
+    const VD ex = D_SET1(EvalPt.x);
+    const VD ey = D_SET1(EvalPt.y);
+    const VD ez = D_SET1(EvalPt.z);
+    const VD zs = D_SET1(zSign);
+    const VF gSign = F_SET1((float) zSign);
+    const VF fourPi = F_SET1(12.5663706144f);
+
+    const double *X1 = lines.x1.data(), *Y1 = lines.y1.data(), *Z1 = lines.z1.data();
+    const double *X2 = lines.x2.data(), *Y2 = lines.y2.data(), *Z2 = lines.z2.data();
+    const float *G = lines.gamma.data(), *C = lines.coreSizeSquared.data();
+
+    VD sumX_lo = D_ZERO(), sumX_hi = D_ZERO();
+    VD sumY_lo = D_ZERO(), sumY_hi = D_ZERO();
+    VD sumZ_lo = D_ZERO(), sumZ_hi = D_ZERO();
+
+    for (int i=0;i<numVec;i+=BS_W){
+
+        const VF r1x = F_FROM_DIFF(ex,X1+i);
+        const VF r1y = F_FROM_DIFF(ey,Y1+i);
+        const VF r1z = F_FROM_SIGNED_DIFF(ez,Z1+i,zs);
+        const VF r2x = F_FROM_DIFF(ex,X2+i);
+        const VF r2y = F_FROM_DIFF(ey,Y2+i);
+        const VF r2z = F_FROM_SIGNED_DIFF(ez,Z2+i,zs);
+
+        const VF r1abs = F_SQRT(F_ADD(F_ADD(F_MUL(r1x,r1x),F_MUL(r1y,r1y)),F_MUL(r1z,r1z)));
+        const VF r2abs = F_SQRT(F_ADD(F_ADD(F_MUL(r2x,r2x),F_MUL(r2y,r2y)),F_MUL(r2z,r2z)));
+        const VF r1r2 = F_MUL(r1abs,r2abs);
+
+        const VF cx = F_SUB(F_MUL(r1y,r2z),F_MUL(r1z,r2y));
+        const VF cy = F_SUB(F_MUL(r1z,r2x),F_MUL(r1x,r2z));
+        const VF cz = F_SUB(F_MUL(r1x,r2y),F_MUL(r1y,r2x));
+
+        const VF dot = F_ADD(F_ADD(F_MUL(r1x,r2x),F_MUL(r1y,r2y)),F_MUL(r1z,r2z));
+
+        const VF gamma = F_MUL(F_LOAD(G+i),gSign);
+        VF mag = F_DIV(F_DIV(F_MUL(gamma,F_ADD(r1abs,r2abs)),fourPi),F_ADD(F_MUL(r1r2,F_ADD(r1r2,dot)),F_LOAD(C+i)));
+        mag = F_FINITE(mag);
+
+        D_ACCUM(sumX_lo,sumX_hi,F_MUL(cx,mag));
+        D_ACCUM(sumY_lo,sumY_hi,F_MUL(cy,mag));
+        D_ACCUM(sumZ_lo,sumZ_hi,F_MUL(cz,mag));
+    }
+
+    vx = D_HSUM(D_ADD(sumX_lo,sumX_hi));
+    vy = D_HSUM(D_ADD(sumY_lo,sumY_hi));
+    vz = D_HSUM(D_ADD(sumZ_lo,sumZ_hi));
+
+    for (int i=numVec;i<num;i++)
+        lineKernelScalar(EvalPt,X1[i],Y1[i],Z1[i],X2[i],Y2[i],Z2[i],G[i],C[i],zSign,vx,vy,vz);
+}
+
+static void BS_SUFFIX(particleInduction)(VortexParticleArrays &particles, Vec3 const &EvalPt, bool mirror, VortexParticle *particle_p, double &vx, double &vy, double &vz){
+
+    const int num = particles.size();
+    const int numVec = num - num % BS_W;
+
+    const float zSign = mirror ? -1.0f : 1.0f;
+    const bool stretch = (particle_p != NULL) && !mirror;
+
+    const VF ex = F_SET1((float) EvalPt.x);
+    const VF ey = F_SET1((float) EvalPt.y);
+    const VF ez = F_SET1((float) EvalPt.z);
+    const VF sign = F_SET1(zSign);
+    const VF minR = F_SET1(0.000001f);
+    const VF inv4Pi = F_SET1(0.07957747154594f);
+    const VF three = F_SET1(3.0f);
+    const VF one = F_SET1(1.0f);
+    const VF minusOne = F_SET1(-1.0f);
+    const VF diffCoeff = F_SET1((float) (15*KINVISCAIR/(2*PI_)));
+
+    VF apx = F_ZERO(), apy = F_ZERO(), apz = F_ZERO(), volp = F_ZERO();
+    if (stretch){
+        apx = F_SET1(particle_p->alpha.x);
+        apy = F_SET1(particle_p->alpha.y);
+        apz = F_SET1(particle_p->alpha.z);
+        volp = F_SET1(particle_p->volume);
+    }
+
+    const float *PX = particles.x.data(), *PY = particles.y.data(), *PZ = particles.z.data();
+    const float *AX = particles.alphaX.data(), *AY = particles.alphaY.data(), *AZ = particles.alphaZ.data();
+    const float *CS = particles.coresize.data(), *VOL = particles.volume.data();
+
+    VD sumX_lo = D_ZERO(), sumX_hi = D_ZERO();
+    VD sumY_lo = D_ZERO(), sumY_hi = D_ZERO();
+    VD sumZ_lo = D_ZERO(), sumZ_hi = D_ZERO();
+    VF strX = F_ZERO(), strY = F_ZERO(), strZ = F_ZERO();
+
+    for (int i=0;i<numVec;i+=BS_W){
+
+        const VF rx = F_SUB(ex,F_LOAD(PX+i));
+        const VF ry = F_SUB(ey,F_LOAD(PY+i));
+        const VF rz = F_SUB(ez,F_MUL(F_LOAD(PZ+i),sign));
+
+        const VF R = F_SQRT(F_ADD(F_ADD(F_MUL(rx,rx),F_MUL(ry,ry)),F_MUL(rz,rz)));
+
+        const VF cs = F_LOAD(CS+i);
+        const VF R2 = F_MUL(R,R);
+        const VF A2 = F_MUL(cs,cs);
+        const VF D = F_ADD(R2,A2);
+        const VF Cq = F_SELECT_GE(F_DIV(inv4Pi,F_SQRT(F_MUL(F_MUL(D,D),D))),R,minR);
+
+        const VF aqx = F_MUL(F_LOAD(AX+i),sign);
+        const VF aqy = F_MUL(F_LOAD(AY+i),sign);
+        const VF aqz = F_LOAD(AZ+i);
+
+        const VF cx = F_SUB(F_MUL(ry,aqz),F_MUL(rz,aqy));
+        const VF cy = F_SUB(F_MUL(rz,aqx),F_MUL(rx,aqz));
+        const VF cz = F_SUB(F_MUL(rx,aqy),F_MUL(ry,aqx));
+
+        const VF minusCq = F_MUL(Cq,minusOne);
+
+        D_ACCUM(sumX_lo,sumX_hi,F_MUL(cx,minusCq));
+        D_ACCUM(sumY_lo,sumY_hi,F_MUL(cy,minusCq));
+        D_ACCUM(sumZ_lo,sumZ_hi,F_MUL(cz,minusCq));
+
+        if (stretch){
+
+            // transpose scheme stretching
+
+            const VF Cs = F_SELECT_GE(F_DIV(F_MUL(three,Cq),D),R,minR);
+
+            const VF bx = F_MUL(F_SUB(F_MUL(apy,aqz),F_MUL(apz,aqy)),Cq);
+            const VF by = F_MUL(F_SUB(F_MUL(apz,aqx),F_MUL(apx,aqz)),Cq);
+            const VF bz = F_MUL(F_SUB(F_MUL(apx,aqy),F_MUL(apy,aqx)),Cq);
+
+            const VF proj = F_ADD(F_ADD(F_MUL(apx,cx),F_MUL(apy,cy)),F_MUL(apz,cz));
+
+            strX = F_ADD(strX,F_ADD(bx,F_MUL(F_MUL(rx,proj),Cs)));
+            strY = F_ADD(strY,F_ADD(by,F_MUL(F_MUL(ry,proj),Cs)));
+            strZ = F_ADD(strZ,F_ADD(bz,F_MUL(F_MUL(rz,proj),Cs)));
+
+            // particle strength exchange
+
+            const VF C5 = F_MUL(F_MUL(A2,A2),cs);
+            const VF E = F_ADD(F_DIV(R2,A2),one);
+            const VF E7 = F_MUL(F_MUL(F_MUL(F_MUL(F_MUL(F_MUL(E,E),E),E),E),E),E);
+            const VF diff = F_SELECT_GE(F_DIV(F_DIV(diffCoeff,C5),F_SQRT(E7)),R,minR);
+
+            const VF volq = F_LOAD(VOL+i);
+
+            strX = F_ADD(strX,F_MUL(F_SUB(F_MUL(aqx,volp),F_MUL(apx,volq)),diff));
+            strY = F_ADD(strY,F_MUL(F_SUB(F_MUL(aqy,volp),F_MUL(apy,volq)),diff));
+            strZ = F_ADD(strZ,F_MUL(F_SUB(F_MUL(aqz,volp),F_MUL(apz,volq)),diff));
+        }
+    }
+
+    vx = D_HSUM(D_ADD(sumX_lo,sumX_hi));
+    vy = D_HSUM(D_ADD(sumY_lo,sumY_hi));
+    vz = D_HSUM(D_ADD(sumZ_lo,sumZ_hi));
+
+    Vec3f dalpha(F_HSUM(strX),F_HSUM(strY),F_HSUM(strZ));
+
+    for (int i=numVec;i<num;i++)
+        particleKernelScalar(EvalPt,PX[i],PY[i],PZ[i],AX[i],AY[i],AZ[i],CS[i],VOL[i],zSign,stretch ? particle_p : NULL,dalpha,vx,vy,vz);
+
+    if (stretch) particle_p->dalpha_dt += dalpha;
+}
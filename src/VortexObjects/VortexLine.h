@@ -19,6 +19,7 @@
 #define VORTEXLINE_H
 
 #include "VortexNode.h"
+#include "VortexPool.h"
 #include <qobject.h>
 #include "src/VortexObjects/VortexPanel.h"
 
@@ -27,6 +28,9 @@ class VortexLine
 public:
     VortexLine();
 
+    static void* operator new(std::size_t size){ return VortexPool<VortexLine>::Allocate(size); }
+    static void operator delete(void *ptr, std::size_t size){ VortexPool<VortexLine>::Release(ptr,size); }
+
     void    Update(double dT);
     void    Initialize(double firstWakeRowFraction = 1.0);
     void    SetGamma(double gamma){ Gamma = gamma; }
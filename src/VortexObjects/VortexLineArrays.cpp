@@ -0,0 +1,171 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "VortexLineArrays.h"
+
+VortexLineArrays::VortexLineArrays(){
+    m_source = NULL;
+    m_size = 0;
+}
+
+void VortexLineArrays::Pack(QList<VortexLine *> *lines, int currentTimestep){
+
+    // the arrays are only grown, so that the memory is reused between the timesteps
+
+    const int num = lines->size();
+
+    if (x1.size() < num){
+        x1.resize(num); y1.resize(num); z1.resize(num);
+        x2.resize(num); y2.resize(num); z2.resize(num);
+        gamma.resize(num);
+        coreSizeSquared.resize(num);
+        shedPanel.resize(num);
+        shedAge.resize(num);
+        vort1.resize(num);
+        vort2.resize(num);
+    }
+
+    m_size = 0;
+
+    for (int i=0;i<num;i++){
+
+        VortexLine *line = lines->at(i);
+
+        if (line->Gamma == 0) continue;
+
+        const int k = m_size++;
+
+        x1[k] = line->pL->x;
+        y1[k] = line->pL->y;
+        z1[k] = line->pL->z;
+        x2[k] = line->pT->x;
+        y2[k] = line->pT->y;
+        z2[k] = line->pT->z;
+        gamma[k] = line->Gamma;
+        coreSizeSquared[k] = line->coreSizeSquared;
+
+        shedPanel[k] = line->isShed ? line->rightPanel : NULL;
+        shedAge[k] = currentTimestep - line->fromTimestep;
+
+        vort1[k].x = x1[k];
+        vort1[k].y = y1[k];
+        vort1[k].z = z1[k];
+        vort1[k].w = line->coreSizeSquared;
+
+        vort2[k].x = x2[k];
+        vort2[k].y = y2[k];
+        vort2[k].z = z2[k];
+        vort2[k].w = line->GetGamma();
+    }
+
+    m_source = lines;
+}
+
+void VortexLineArrays::Append(Vec3 const &L, Vec3 const &T, float Gamma, float coreSizeSquared){
+
+    // used for the bound vorticity and the stored geometry, that are not owned by a QList of lines
+
+    const int k = m_size++;
+
+    if ((int) x1.size() < m_size){
+        x1.resize(m_size); y1.resize(m_size); z1.resize(m_size);
+        x2.resize(m_size); y2.resize(m_size); z2.resize(m_size);
+        gamma.resize(m_size);
+        this->coreSizeSquared.resize(m_size);
+        shedPanel.resize(m_size);
+        shedAge.resize(m_size);
+        vort1.resize(m_size);
+        vort2.resize(m_size);
+    }
+
+    x1[k] = L.x;
+    y1[k] = L.y;
+    z1[k] = L.z;
+    x2[k] = T.x;
+    y2[k] = T.y;
+    z2[k] = T.z;
+    gamma[k] = Gamma;
+    this->coreSizeSquared[k] = coreSizeSquared;
+
+    shedPanel[k] = NULL;
+    shedAge[k] = 0;
+
+    vort1[k].x = L.x;
+    vort1[k].y = L.y;
+    vort1[k].z = L.z;
+    vort1[k].w = coreSizeSquared;
+
+    vort2[k].x = T.x;
+    vort2[k].y = T.y;
+    vort2[k].z = T.z;
+    vort2[k].w = Gamma;
+}
+
+VortexParticleArrays::VortexParticleArrays(){
+    m_source = NULL;
+    m_size = 0;
+}
+
+void VortexParticleArrays::Resize(int num){
+
+    if ((int) x.size() < num){
+        x.resize(num); y.resize(num); z.resize(num);
+        alphaX.resize(num); alphaY.resize(num); alphaZ.resize(num);
+        coresize.resize(num);
+        volume.resize(num);
+    }
+
+    m_size = num;
+}
+
+void VortexParticleArrays::Pack(QList<VortexParticle *> *particles){
+
+    Resize(particles->size());
+
+    for (int i=0;i<m_size;i++){
+        VortexParticle *particle = particles->at(i);
+        x[i] = particle->position.x;
+        y[i] = particle->position.y;
+        z[i] = particle->position.z;
+        alphaX[i] = particle->alpha.x;
+        alphaY[i] = particle->alpha.y;
+        alphaZ[i] = particle->alpha.z;
+        coresize[i] = particle->coresize;
+        volume[i] = particle->volume;
+    }
+
+    m_source = particles;
+}
+
+void VortexParticleArrays::Pack(QList<VortexParticle> const &particles){
+
+    Resize(particles.size());
+
+    for (int i=0;i<m_size;i++){
+        const VortexParticle &particle = particles.at(i);
+        x[i] = particle.position.x;
+        y[i] = particle.position.y;
+        z[i] = particle.position.z;
+        alphaX[i] = particle.alpha.x;
+        alphaY[i] = particle.alpha.y;
+        alphaZ[i] = particle.alpha.z;
+        coresize[i] = particle.coresize;
+        volume[i] = particle.volume;
+    }
+
+    m_source = NULL;
+}
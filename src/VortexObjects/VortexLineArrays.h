@@ -0,0 +1,90 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef VORTEXLINEARRAYS_H
+#define VORTEXLINEARRAYS_H
+
+#include <QList>
+#include <vector>
+#include "VortexLine.h"
+#include "VortexParticle.h"
+
+// Packed structure of arrays copy of the vortex line wake. The wake is packed once before the
+// induction is evaluated so that the O(N*M) induction loops run over contiguous arrays instead of
+// chasing the pL/pT node pointers of every filament. Lines with zero circulation are skipped.
+// The endpoints are additionally stored as float4 records (x,y,z,coreSizeSquared | x,y,z,Gamma)
+// in the layout that is expected by the OpenCL kernel.
+
+struct VortexLineFloat4{
+    float x, y, z, w;
+};
+
+class VortexLineArrays
+{
+public:
+    VortexLineArrays();
+
+    void Pack(QList<VortexLine *> *lines, int currentTimestep);
+    void Clear(){ m_source = NULL; m_size = 0; }
+    void Append(Vec3 const &L, Vec3 const &T, float Gamma, float coreSizeSquared);
+    void Invalidate(){ m_source = NULL; }
+    bool IsPackedFrom(QList<VortexLine *> *lines){ return m_source && m_source == lines; }
+    int  size(){ return m_size; }
+
+    // line endpoints, circulation and core size
+
+    std::vector<double> x1, y1, z1, x2, y2, z2;
+    std::vector<float> gamma, coreSizeSquared;
+
+    // data needed for the evaluation of the shed vorticity close to the panels
+
+    std::vector<VortexPanel *> shedPanel;    // right panel of shed lines, NULL for trailing lines
+    std::vector<int> shedAge;                // number of timesteps since the line was shed
+
+    // float4 records for the OpenCL kernel
+
+    std::vector<VortexLineFloat4> vort1, vort2;
+
+private:
+    QList<VortexLine *> *m_source;
+    int m_size;
+};
+
+// Packed copy of the vortex particles, the layout that is used by the vectorized particle kernels
+
+class VortexParticleArrays
+{
+public:
+    VortexParticleArrays();
+
+    void Pack(QList<VortexParticle *> *particles);
+    void Pack(QList<VortexParticle> const &particles);
+    void Clear(){ m_source = NULL; m_size = 0; }
+    void Invalidate(){ m_source = NULL; }
+    bool IsPackedFrom(QList<VortexParticle *> *particles){ return m_source && m_source == particles; }
+    int  size(){ return m_size; }
+
+    std::vector<float> x, y, z, alphaX, alphaY, alphaZ, coresize, volume;
+
+private:
+    void Resize(int num);
+
+    QList<VortexParticle *> *m_source;
+    int m_size;
+};
+
+#endif // VORTEXLINEARRAYS_H
@@ -20,6 +20,7 @@
 
 #include "../Vec3.h"
 #include "QObject"
+#include "VortexPool.h"
 
 class VortexNode : public Vec3
 {
@@ -27,6 +28,9 @@ public:
     VortexNode(const double &xi, const double &yi, const double &zi);
     VortexNode();
 
+    static void* operator new(std::size_t size){ return VortexPool<VortexNode>::Allocate(size); }
+    static void operator delete(void *ptr, std::size_t size){ VortexPool<VortexNode>::Release(ptr,size); }
+
     QList <void*> attachedLines;
 
     void attachLine(void *line);
@@ -22,11 +22,16 @@
 #include "src/Vec3f.h"
 #include "src/VortexObjects/VortexPanel.h"
 #include <QList>
+#include "src/VortexObjects/VortexPool.h"
 
 class VortexParticle
 {
 public:
     VortexParticle();
+
+    static void* operator new(std::size_t size){ return VortexPool<VortexParticle>::Allocate(size); }
+    static void operator delete(void *ptr, std::size_t size){ VortexPool<VortexParticle>::Release(ptr,size); }
+
     void serialize();
     void serializeCompressed(float intercept_pos, float slope_pos, float intercept_alpha, float slope_alpha);
     void Update(double dT, double maxGrowth);
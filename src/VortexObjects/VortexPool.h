@@ -0,0 +1,188 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef VORTEXPOOL_H
+#define VORTEXPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Pool allocator for the wake objects (VortexNode, VortexLine, VortexParticle). The objects are
+// placed into large contiguous chunks and freed slots are recycled through free lists, this
+// removes the allocator churn of the wake creation / truncation and keeps the wake elements of
+// a simulation close together in memory.
+// Every thread is assigned one of numShards shards with its own free list, current chunk and
+// mutex, so that the threads of the wake code do not contend for a single lock; only the
+// allocation of a new chunk goes through the pool wide mutex. Slots are returned to the shard
+// of the releasing thread. ReleaseUnusedChunks() returns the chunks without live objects to
+// the OS, it is called when the wake of a simulation has been cleared.
+
+template <class T>
+class VortexPool
+{
+public:
+
+    static void* Allocate(std::size_t size){
+
+        if (size != sizeof(T)) return ::operator new(size); // derived classes use the default allocator
+
+        VortexPool &pool = Instance();
+        Shard &shard = pool.m_shards[ShardIndex()];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        if (shard.freeList){
+            Slot *slot = shard.freeList;
+            shard.freeList = slot->next;
+            return slot;
+        }
+
+        if (!shard.chunk || shard.used == chunkSize){
+            shard.chunk = pool.NewChunk();
+            shard.used = 0;
+        }
+
+        return &shard.chunk[shard.used++];
+    }
+
+    static void Release(void *ptr, std::size_t size){
+
+        if (!ptr) return;
+
+        if (size != sizeof(T)){
+            ::operator delete(ptr);
+            return;
+        }
+
+        VortexPool &pool = Instance();
+        Shard &shard = pool.m_shards[ShardIndex()];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        Slot *slot = static_cast<Slot*>(ptr);
+        slot->next = shard.freeList;
+        shard.freeList = slot;
+    }
+
+    static void ReleaseUnusedChunks(){
+
+        VortexPool &pool = Instance();
+
+        // lock order: shards before the chunk mutex, as in Allocate()
+
+        for (int i=0;i<numShards;i++) pool.m_shards[i].mutex.lock();
+        pool.m_chunkMutex.lock();
+
+        std::vector<Slot*> &chunks = pool.m_chunks;
+        std::sort(chunks.begin(),chunks.end());
+
+        // the unused tails of the current chunks are moved to the free lists, then the free slots are counted per chunk
+
+        for (int i=0;i<numShards;i++){
+            Shard &shard = pool.m_shards[i];
+            if (shard.chunk){
+                for (int k=shard.used;k<chunkSize;k++){
+                    shard.chunk[k].next = shard.freeList;
+                    shard.freeList = &shard.chunk[k];
+                }
+            }
+            shard.chunk = nullptr;
+            shard.used = 0;
+        }
+
+        std::vector<int> numFree(chunks.size(),0);
+
+        for (int i=0;i<numShards;i++)
+            for (Slot *slot = pool.m_shards[i].freeList; slot; slot = slot->next)
+                numFree[ChunkIndex(chunks,slot)]++;
+
+        // the free lists are rebuilt without the slots of the empty chunks, which are then released
+
+        for (int i=0;i<numShards;i++){
+            Slot *list = nullptr;
+            Slot *slot = pool.m_shards[i].freeList;
+            while (slot){
+                Slot *next = slot->next;
+                if (numFree[ChunkIndex(chunks,slot)] < chunkSize){
+                    slot->next = list;
+                    list = slot;
+                }
+                slot = next;
+            }
+            pool.m_shards[i].freeList = list;
+        }
+
+        std::vector<Slot*> kept;
+        for (size_t i=0;i<chunks.size();i++){
+            if (numFree[i] == chunkSize) ::operator delete(chunks[i]);
+            else kept.push_back(chunks[i]);
+        }
+        chunks.swap(kept);
+
+        pool.m_chunkMutex.unlock();
+        for (int i=0;i<numShards;i++) pool.m_shards[i].mutex.unlock();
+    }
+
+private:
+
+    union Slot{
+        Slot *next;
+        alignas(alignof(std::max_align_t)) char storage[sizeof(T)];
+    };
+
+    struct Shard{
+        std::mutex mutex;
+        Slot *freeList = nullptr;
+        Slot *chunk = nullptr;
+        int used = 0;
+        char padding[64]; // keeps the shards of different threads on different cache lines
+    };
+
+    static const int chunkSize = 4096;
+    static const int numShards = 64;
+
+    VortexPool() {}
+
+    static VortexPool& Instance(){
+        static VortexPool *pool = new VortexPool(); // never destroyed, wake objects may still be released during the static destruction
+        return *pool;
+    }
+
+    static int ShardIndex(){
+        static thread_local int index = Instance().m_nextShard++ % numShards;
+        return index;
+    }
+
+    static size_t ChunkIndex(std::vector<Slot*> &chunks, Slot *slot){
+        return std::upper_bound(chunks.begin(),chunks.end(),slot) - chunks.begin() - 1;
+    }
+
+    Slot* NewChunk(){
+        std::lock_guard<std::mutex> lock(m_chunkMutex);
+        m_chunks.push_back(static_cast<Slot*>(::operator new(chunkSize*sizeof(Slot))));
+        return m_chunks.back();
+    }
+
+    Shard m_shards[numShards];
+    std::mutex m_chunkMutex;
+    std::vector<Slot*> m_chunks;
+    std::atomic<int> m_nextShard{0};
+};
+
+#endif // VORTEXPOOL_H
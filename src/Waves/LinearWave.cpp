@@ -141,6 +141,9 @@ void LinearWave::SampleTimeseries(float &dt, QVector<float> &elevation){
     // decomposition of time signal
     //1st step sampling...
     int num = floor((max-min)/dt);
+    elevation.reserve(num);
+    // the sample times are increasing, the interval search continues from the previous sample
+    int j = 0;
     for (int i=0;i<num;i++){
         float t = min+i*dt;
         float amp = 0;
@@ -149,13 +152,10 @@ void LinearWave::SampleTimeseries(float &dt, QVector<float> &elevation){
         else if (t>=timeseries.at(timeseries.size()-1).at(0))
             amp = timeseries.at(timeseries.size()-1).at(1);
         else{
-            for (int j=0;j<timeseries.size()-1;j++){
-                if (t>=timeseries.at(j).at(0) && t<=timeseries.at(j+1).at(0)){
-                    amp = timeseries.at(j).at(1) +
-                            (timeseries.at(j+1).at(1)-timeseries.at(j).at(1))*
-                            (t-timeseries.at(j).at(0))/(timeseries.at(j+1).at(0)-timeseries.at(j).at(0));
-                }
-            }
+            while (j<timeseries.size()-2 && t>timeseries.at(j+1).at(0)) j++;
+            amp = timeseries.at(j).at(1) +
+                    (timeseries.at(j+1).at(1)-timeseries.at(j).at(1))*
+                    (t-timeseries.at(j).at(0))/(timeseries.at(j+1).at(0)-timeseries.at(j).at(0));
         }
         elevation.append(amp);
     }
@@ -511,6 +511,145 @@ void LinearWave::GetVelocityAndAcceleration(Vec3 pos, float time, float elevatio
 
 }
 
+void LinearWave::KinematicsBatch::Resize(int num){
+
+    x.resize(num); y.resize(num); z.resize(num);
+    evalElevation.resize(num);
+    elevation.resize(num);
+    velX.resize(num); velY.resize(num); velZ.resize(num);
+    accX.resize(num); accY.resize(num); accZ.resize(num);
+    dynP.resize(num);
+}
+
+void LinearWave::GetKinematicsBatch(KinematicsBatch &batch, float time, float depth, int stretchingType, bool unstretched){
+
+    // batched version of GetElevation() and GetVelocityAndAcceleration() (without the MacCamy-Fuchs correction):
+    // the temporal phase of every train is evaluated once per call, the spatial phase once per position and
+    // train and is shared between the elevation and the kinematics; sin(kX - wt + p) is composed from the
+    // phasors. The depth functions are evaluated as exponentials that do not overflow for large k*depth.
+    // With unstretched == true the positions are taken as the (already stretched) evaluation depth, the
+    // kinematics are not cut off at the surface; above MSL the extrapolation is used if it is selected.
+
+    int numTrains = waveTrains.size();
+    int numPoints = batch.size();
+
+    batch.Resize(numPoints);
+
+    QVector<float> k(numTrains), cosDir(numTrains), sinDir(numTrains), amp(numTrains), A_omega(numTrains), A_omega2(numTrains);
+    QVector<float> tanhKD(numTrains), invDen(numTrains), invTanhKD(numTrains);
+    QVector<double> cosT(numTrains), sinT(numTrains);
+
+    for (int i=0;i<numTrains;i++){
+        const waveTrain &train = waveTrains.at(i);
+        k[i] = train.wavenumber;
+        cosDir[i] = train.cosfDIR;
+        sinDir[i] = train.sinfDIR;
+        amp[i] = train.amplitude;
+        A_omega[i] = train.A_omega;
+        A_omega2[i] = train.A_omega2;
+        tanhKD[i] = tanhf(train.wavenumber*depth);
+        invTanhKD[i] = 1.0f/tanhKD[i];
+        invDen[i] = 1.0/(1.0-exp(-2.0*train.wavenumber*depth));
+        const double theta = -train.omega*(double(time)+timeoffset)+train.phase;
+        cosT[i] = cos(theta);
+        sinT[i] = sin(theta);
+    }
+
+    bool deepWater = depth > 100;
+
+    #pragma omp parallel default (none) shared (batch, k, cosDir, sinDir, amp, A_omega, A_omega2, tanhKD, invDen, invTanhKD, cosT, sinT, numTrains, numPoints, depth, stretchingType, deepWater, unstretched)
+    {
+        QVector<float> SINF(numTrains), COSF(numTrains);
+
+        #pragma omp for
+        for (int p=0;p<numPoints;p++){
+
+            const float x = batch.x.at(p);
+            const float y = batch.y.at(p);
+            float z = batch.z.at(p);
+
+            // phase of all trains at this position and the elevation
+
+            float elevation = 0;
+            for (int i=0;i<numTrains;i++){
+                const double arg = k[i] * (x * cosDir[i] + y * sinDir[i]);
+                const double sinKX = sin(arg), cosKX = cos(arg);
+                SINF[i] = sinKX*cosT[i] + cosKX*sinT[i];
+                COSF[i] = cosKX*cosT[i] - sinKX*sinT[i];
+                elevation += amp[i] * SINF[i];
+            }
+
+            batch.elevation[p] = elevation;
+            batch.velX[p] = 0; batch.velY[p] = 0; batch.velZ[p] = 0;
+            batch.accX[p] = 0; batch.accY[p] = 0; batch.accZ[p] = 0;
+            batch.dynP[p] = 0;
+
+            // stretching, same as in GetVelocityAndAcceleration()
+
+            if (!unstretched){
+
+                double nu = batch.evalElevation.at(p) ? elevation : 0;
+                if (stretchingType == NOSTRETCHING) nu = 0;
+
+                if (z + depth < 0 || z > nu) continue;
+
+                if (stretchingType == VERTICAL){
+                    if (z > 0) z = 0;
+                }
+                else if (stretchingType == WHEELER){
+                    z = (z-nu)*depth/(nu+depth);
+                }
+            }
+
+            if (z + depth < 0) continue;
+
+            const bool extrapolate = (stretchingType == EXTRAPOLATION) && (z > 0);
+
+            float vx = 0, vy = 0, vz = 0, ax = 0, ay = 0, az = 0, dp = 0;
+
+            for (int i=0;i<numTrains;i++){
+
+                float depthVarXY, depthVarZ;
+
+                if (deepWater){
+                    if (extrapolate) depthVarXY = 1.0f + k[i] * z;
+                    else depthVarXY = expf(k[i]*z);
+                    depthVarZ = depthVarXY;
+                }
+                else{
+                    if (extrapolate){
+                        depthVarXY = invTanhKD[i] + z*k[i];
+                        depthVarZ = 1.0f + z*k[i]*invTanhKD[i];
+                    }
+                    else{
+                        // cosh(k(z+d))/sinh(kd) and sinh(k(z+d))/sinh(kd)
+                        const float up = expf(k[i]*z);
+                        const float down = expf(-k[i]*(z+2.0f*depth));
+                        depthVarXY = (up + down) * invDen[i];
+                        depthVarZ = (up - down) * invDen[i];
+                    }
+                }
+
+                const float velXY = A_omega[i] * depthVarXY * SINF[i];
+                vx += velXY * cosDir[i];
+                vy += velXY * sinDir[i];
+                vz += -A_omega[i] * depthVarZ * COSF[i];
+
+                const float accXY = -A_omega2[i] * depthVarXY * COSF[i];
+                ax += accXY * cosDir[i];
+                ay += accXY * sinDir[i];
+                az += -A_omega2[i] * depthVarZ * SINF[i];
+
+                dp += tanhKD[i] * depthVarXY * amp[i] * SINF[i];
+            }
+
+            batch.velX[p] = vx; batch.velY[p] = vy; batch.velZ[p] = vz;
+            batch.accX[p] = ax; batch.accY[p] = ay; batch.accZ[p] = az;
+            batch.dynP[p] = dp;
+        }
+    }
+}
+
 double LinearWave::GetPhaseMCFPhaseShift(double x){
 
     // interpolation is based on data in Table 1.1 (p.38) of the USFOS theory manual https://www.usfos.no/manuals/usfos/theory/documents/Usfos_Hydrodynamics.pdf
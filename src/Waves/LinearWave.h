@@ -45,6 +45,19 @@ public:
         }
     };
 
+    // structure of arrays buffers for the batched evaluation of the wave kinematics at many positions
+    struct KinematicsBatch{
+        QVector<float> x, y, z;                 // evaluation positions
+        QVector<char> evalElevation;            // 1: the elevation is evaluated and used for the stretching, 0: elevation = 0 (e.g. cable nodes)
+        QVector<float> elevation;
+        QVector<float> velX, velY, velZ;
+        QVector<float> accX, accY, accZ;
+        QVector<float> dynP;                    // dynamic pressure head, same as GetVelocityAndAcceleration()
+
+        void Resize(int num);
+        int size() const { return x.size(); }
+    };
+
     LinearWave();
     ~LinearWave();
 
@@ -103,6 +116,7 @@ public:
     void SampleTimeseries(float &dt, QVector<float> &elevation);
     QVector<float> GetElevationPerDirection(Vec3 pos, float time, QVector<float> &waveDir, double deltaDir);
     void GetVelocityAndAcceleration(Vec3 pos, float time, float elevation = 0, float depth = 100, int stretchingType = 0, Vec3 *Vel = NULL, Vec3 *Acc = NULL, float *dynP = NULL, int isFuchs = 0, float dia = 0);
+    void GetKinematicsBatch(KinematicsBatch &batch, float time, float depth = 100, int stretchingType = 0, bool unstretched = false);
     void GLRenderSurfaceElevation(Vec3 centerPos, float time, float width, float length, int discW, int discL, int GlList, bool showGrid = true, bool showSurface = true, bool showGround = false, double opacity = 0.7, double groundOpacity = 1.0, double depth = 0);
     void PrepareGraphData(double start, double end, double delta, double depth);
 
@@ -0,0 +1,493 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "WaveKinematicsGrid.h"
+
+#include <QDir>
+#include <QDebug>
+#include <QCryptographicHash>
+#include <QCoreApplication>
+#include <random>
+#include <climits>
+#include <math.h>
+
+#include "../src/Globals.h"
+#include "../src/GlobalFunctions.h"
+
+#define WAVEGRID_MAGIC 0x47574251      // "QBWG"
+#define WAVEGRID_FORMAT 1
+#define WAVEGRID_HEADERSIZE 64
+#define WAVEGRID_MAXSIZE_MB 16384.0
+#define WAVEGRID_CACHESIZE_MB 32768.0
+
+WaveKinematicsGrid::WaveKinematicsGrid(){
+
+    m_wave = NULL;
+    m_data = NULL;
+    m_nx = m_ny = m_nz = m_nt = 0;
+    m_sliceSize = m_numFloats = 0;
+}
+
+WaveKinematicsGrid::~WaveKinematicsGrid(){
+
+    Clear();
+}
+
+void WaveKinematicsGrid::Clear(){
+
+    if (m_cacheFile.isOpen()){
+        if (m_data) m_cacheFile.unmap((uchar *) m_data);
+        m_cacheFile.close();
+    }
+
+    m_memoryData.clear();
+    m_memoryData.squeeze();
+    m_data = NULL;
+}
+
+QString WaveKinematicsGrid::GetCacheDirectory(){
+    return GetUserCacheDirectory("WaveKinematics");
+}
+
+bool WaveKinematicsGrid::Build(LinearWave *wave, GridDefinition const &def, QString cacheDirectory){
+
+    Clear();
+
+    if (!wave) return false;
+
+    m_wave = wave;
+    m_def = def;
+
+    // the vertical grid ends at MSL, only for the extrapolation stretching the field above MSL is needed
+
+    m_def.zMin = std::max(def.zMin, -def.depth);
+    m_def.zMax = (def.stretchingType == EXTRAPOLATION) ? std::max(def.zMax, 0.0f) : 0;
+    if (m_def.zMin > m_def.zMax - def.dz) m_def.zMin = m_def.zMax - def.dz;
+
+    m_nx = std::max(2, int(ceil((m_def.xMax - m_def.xMin) / m_def.dxy)) + 1);
+    m_ny = std::max(2, int(ceil((m_def.yMax - m_def.yMin) / m_def.dxy)) + 1);
+    m_nz = std::max(2, int(ceil((m_def.zMax - m_def.zMin) / m_def.dz)) + 1);
+    m_nt = std::max(2, int(ceil((m_def.tMax - m_def.tMin) / m_def.dt)) + 1);
+
+    m_def.xMax = m_def.xMin + (m_nx - 1) * m_def.dxy;
+    m_def.yMax = m_def.yMin + (m_ny - 1) * m_def.dxy;
+    m_def.zMin = m_def.zMax - (m_nz - 1) * m_def.dz;
+    m_def.tMax = m_def.tMin + (m_nt - 1) * m_def.dt;
+
+    m_sliceSize = qint64(m_nx) * m_ny * (1 + NUM_FIELDS * m_nz);
+    m_numFloats = m_sliceSize * m_nt;
+
+    qDebug().noquote() << "...wave kinematics grid:" << m_nx << "x" << m_ny << "x" << m_nz << "points," << m_nt << "timesteps," << QString().number(GetSizeInMB(),'f',1) << "MB";
+
+    if (GetSizeInMB() > WAVEGRID_MAXSIZE_MB){
+        qDebug().noquote() << "...wave kinematics grid exceeds" << WAVEGRID_MAXSIZE_MB << "MB, increase the grid spacing or timestep";
+        return false;
+    }
+
+    if (!cacheDirectory.isEmpty() && QDir().mkpath(cacheDirectory)){
+
+        m_cacheFileName = QDir(cacheDirectory).absoluteFilePath("wavegrid_" + QString(ComputeHash(wave).toHex()) + ".bin");
+
+        if (ReadCacheFile(m_cacheFileName)){
+            TouchCacheFile(m_cacheFileName);
+            qDebug().noquote() << "...reusing wave kinematics grid from" << m_cacheFileName;
+            return true;
+        }
+
+        EvictCacheFiles(cacheDirectory, QStringList("wavegrid_*.bin"), WAVEGRID_CACHESIZE_MB, GetSizeInMB());
+
+        // the field is written to a temporary file first, so that concurrent simulations never map a partially written field
+
+        QFile tempFile(m_cacheFileName + "." + QString().number(QCoreApplication::applicationPid()) + ".tmp");
+        if (tempFile.open(QIODevice::WriteOnly)){
+
+            bool success = WriteField(&tempFile);
+            tempFile.close();
+
+            if (!success || !tempFile.rename(m_cacheFileName)) tempFile.remove();
+
+            if (ReadCacheFile(m_cacheFileName)) return true;
+        }
+
+        qDebug().noquote() << "...could not write the wave kinematics cache file, the grid is kept in memory";
+    }
+
+    m_cacheFileName.clear();
+
+    if (m_numFloats > INT_MAX){
+        qDebug().noquote() << "...wave kinematics grid is too large to be kept in memory";
+        return false;
+    }
+
+    m_memoryData.resize(m_numFloats);
+
+    LinearWave::KinematicsBatch batch;
+    for (int n=0;n<m_nt;n++)
+        ComputeTimeSlice(n, m_memoryData.data() + n * m_sliceSize, batch);
+
+    m_data = m_memoryData.constData();
+
+    return true;
+}
+
+QByteArray WaveKinematicsGrid::ComputeHash(LinearWave *wave){
+
+    // the cache key covers everything that the stored field depends on
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+
+    int format = WAVEGRID_FORMAT;
+    hash.addData((const char *) &format, sizeof(int));
+    hash.addData((const char *) &m_def, sizeof(GridDefinition));
+    hash.addData((const char *) &wave->timeoffset, sizeof(float));
+    hash.addData((const char *) wave->waveTrains.constData(), wave->waveTrains.size() * sizeof(LinearWave::waveTrain));
+
+    return hash.result();
+}
+
+bool WaveKinematicsGrid::ReadCacheFile(QString fileName){
+
+    if (!QFile::exists(fileName)) return false;
+
+    m_cacheFile.setFileName(fileName);
+    if (!m_cacheFile.open(QIODevice::ReadOnly)) return false;
+
+    qint32 header[6];
+    bool valid = m_cacheFile.size() == WAVEGRID_HEADERSIZE + m_numFloats * qint64(sizeof(float));
+    valid = valid && m_cacheFile.read((char *) header, sizeof(header)) == sizeof(header);
+    valid = valid && header[0] == WAVEGRID_MAGIC && header[1] == WAVEGRID_FORMAT;
+    valid = valid && header[2] == m_nx && header[3] == m_ny && header[4] == m_nz && header[5] == m_nt;
+
+    if (valid) m_data = (const float *) m_cacheFile.map(WAVEGRID_HEADERSIZE, m_numFloats * sizeof(float));
+
+    if (!m_data){
+        m_cacheFile.close();
+        return false;
+    }
+
+    return true;
+}
+
+bool WaveKinematicsGrid::WriteField(QFile *file){
+
+    QByteArray header(WAVEGRID_HEADERSIZE, 0);
+    qint32 *values = (qint32 *) header.data();
+    values[0] = WAVEGRID_MAGIC;
+    values[1] = WAVEGRID_FORMAT;
+    values[2] = m_nx;
+    values[3] = m_ny;
+    values[4] = m_nz;
+    values[5] = m_nt;
+
+    if (file->write(header) != header.size()) return false;
+
+    QVector<float> slice(m_sliceSize);
+    LinearWave::KinematicsBatch batch;
+
+    int progress = 0;
+
+    for (int n=0;n<m_nt;n++){
+
+        ComputeTimeSlice(n, slice.data(), batch);
+
+        if (file->write((const char *) slice.constData(), m_sliceSize * sizeof(float)) != qint64(m_sliceSize * sizeof(float)))
+            return false;
+
+        if ((n+1) * 10 / m_nt > progress){
+            progress = (n+1) * 10 / m_nt;
+            qDebug().noquote() << "...computing wave kinematics grid:" << progress * 10 << "%";
+        }
+    }
+
+    return true;
+}
+
+void WaveKinematicsGrid::ComputeTimeSlice(int n, float *slice, LinearWave::KinematicsBatch &batch){
+
+    // slice layout: the elevation of all (x,y) points, followed by the NUM_FIELDS values of all (x,y,z) points
+
+    const int numXY = m_nx * m_ny;
+
+    if (batch.size() != numXY * m_nz){
+        batch.Resize(numXY * m_nz);
+        for (int k=0;k<m_nz;k++){
+            for (int j=0;j<m_ny;j++){
+                for (int i=0;i<m_nx;i++){
+                    const int p = (k * m_ny + j) * m_nx + i;
+                    batch.x[p] = m_def.xMin + i * m_def.dxy;
+                    batch.y[p] = m_def.yMin + j * m_def.dxy;
+                    batch.z[p] = m_def.zMin + k * m_def.dz;
+                    batch.evalElevation[p] = 1;
+                }
+            }
+        }
+    }
+
+    m_wave->GetKinematicsBatch(batch, m_def.tMin + n * m_def.dt, m_def.depth, m_def.stretchingType, true);
+
+    for (int p=0;p<numXY;p++)
+        slice[p] = batch.elevation.at(p);
+
+    float *kin = slice + numXY;
+
+    for (int p=0;p<batch.size();p++){
+        kin[p * NUM_FIELDS + 0] = batch.velX.at(p);
+        kin[p * NUM_FIELDS + 1] = batch.velY.at(p);
+        kin[p * NUM_FIELDS + 2] = batch.velZ.at(p);
+        kin[p * NUM_FIELDS + 3] = batch.accX.at(p);
+        kin[p * NUM_FIELDS + 4] = batch.accY.at(p);
+        kin[p * NUM_FIELDS + 5] = batch.accZ.at(p);
+        kin[p * NUM_FIELDS + 6] = batch.dynP.at(p);
+    }
+}
+
+bool WaveKinematicsGrid::GetStencil(float value, float min, float delta, int num, Stencil &stencil){
+
+    float u = (value - min) / delta;
+
+    if (u < 0 || u > num - 1) return false;
+
+    int i0 = std::min(int(u), num - 2);
+    float f = u - i0;
+
+    if (m_def.interpolation == WAVEGRID_LINEAR){
+        stencil.num = 2;
+        stencil.index[0] = i0;
+        stencil.index[1] = i0 + 1;
+        stencil.weight[0] = 1.0f - f;
+        stencil.weight[1] = f;
+    }
+    else{
+        // Catmull-Rom, the stencil is clamped at the grid boundaries
+        const float f2 = f * f, f3 = f2 * f;
+        stencil.num = 4;
+        stencil.index[0] = std::max(i0 - 1, 0);
+        stencil.index[1] = i0;
+        stencil.index[2] = i0 + 1;
+        stencil.index[3] = std::min(i0 + 2, num - 1);
+        stencil.weight[0] = 0.5f * (-f3 + 2.0f * f2 - f);
+        stencil.weight[1] = 0.5f * (3.0f * f3 - 5.0f * f2 + 2.0f);
+        stencil.weight[2] = 0.5f * (-3.0f * f3 + 4.0f * f2 + f);
+        stencil.weight[3] = 0.5f * (f3 - f2);
+    }
+
+    return true;
+}
+
+bool WaveKinematicsGrid::InterpolatePoint(Stencil const &sT, float x, float y, float z, bool evalElevation, float *result){
+
+    // result: elevation followed by the NUM_FIELDS kinematic values, returns false if the point is not covered by the grid
+
+    Stencil sX, sY, sZ;
+
+    if (!GetStencil(x, m_def.xMin, m_def.dxy, m_nx, sX)) return false;
+    if (!GetStencil(y, m_def.yMin, m_def.dxy, m_ny, sY)) return false;
+
+    float elevation = 0;
+    for (int t=0;t<sT.num;t++){
+        const float *elev = m_data + sT.index[t] * m_sliceSize;
+        for (int j=0;j<sY.num;j++){
+            const float wTY = sT.weight[t] * sY.weight[j];
+            for (int i=0;i<sX.num;i++)
+                elevation += wTY * sX.weight[i] * elev[sY.index[j] * m_nx + sX.index[i]];
+        }
+    }
+
+    result[0] = elevation;
+    for (int f=0;f<NUM_FIELDS;f++) result[f+1] = 0;
+
+    // stretching, same as in LinearWave::GetKinematicsBatch()
+
+    const float depth = m_def.depth;
+
+    double nu = evalElevation ? elevation : 0;
+    if (m_def.stretchingType == NOSTRETCHING) nu = 0;
+
+    if (z + depth < 0 || z > nu) return true;
+
+    if (m_def.stretchingType == VERTICAL){
+        if (z > 0) z = 0;
+    }
+    else if (m_def.stretchingType == WHEELER){
+        z = (z-nu)*depth/(nu+depth);
+    }
+
+    if (z + depth < 0) return true;
+
+    if (!GetStencil(z, m_def.zMin, m_def.dz, m_nz, sZ)) return false;
+
+    const int numXY = m_nx * m_ny;
+
+    for (int t=0;t<sT.num;t++){
+        const float *kin = m_data + sT.index[t] * m_sliceSize + numXY;
+        for (int k=0;k<sZ.num;k++){
+            const float wTZ = sT.weight[t] * sZ.weight[k];
+            for (int j=0;j<sY.num;j++){
+                const float wTZY = wTZ * sY.weight[j];
+                const float *row = kin + qint64((sZ.index[k] * m_ny + sY.index[j]) * m_nx) * NUM_FIELDS;
+                for (int i=0;i<sX.num;i++){
+                    const float w = wTZY * sX.weight[i];
+                    const float *values = row + sX.index[i] * NUM_FIELDS;
+                    for (int f=0;f<NUM_FIELDS;f++)
+                        result[f+1] += w * values[f];
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void WaveKinematicsGrid::Evaluate(LinearWave::KinematicsBatch &batch, float time){
+
+    int numPoints = batch.size();
+
+    batch.Resize(numPoints);
+
+    Stencil sT;
+
+    if (!m_data || !GetStencil(time, m_def.tMin, m_def.dt, m_nt, sT)){
+        m_wave->GetKinematicsBatch(batch, time, m_def.depth, m_def.stretchingType);
+        return;
+    }
+
+    QVector<char> isCovered(numPoints);
+
+    #pragma omp parallel default (none) shared (batch, sT, isCovered, numPoints)
+    {
+        #pragma omp for
+        for (int p=0;p<numPoints;p++){
+
+            float result[NUM_FIELDS+1];
+
+            isCovered[p] = InterpolatePoint(sT, batch.x.at(p), batch.y.at(p), batch.z.at(p), batch.evalElevation.at(p), result);
+
+            if (isCovered[p]){
+                batch.elevation[p] = result[0];
+                batch.velX[p] = result[1];
+                batch.velY[p] = result[2];
+                batch.velZ[p] = result[3];
+                batch.accX[p] = result[4];
+                batch.accY[p] = result[5];
+                batch.accZ[p] = result[6];
+                batch.dynP[p] = result[7];
+            }
+        }
+    }
+
+    // positions outside of the grid are evaluated from the wave trains
+
+    QVector<int> fallbackIndex;
+    for (int p=0;p<numPoints;p++)
+        if (!isCovered.at(p)) fallbackIndex.append(p);
+
+    if (!fallbackIndex.size()) return;
+
+    LinearWave::KinematicsBatch fallbackBatch;
+    fallbackBatch.Resize(fallbackIndex.size());
+    for (int i=0;i<fallbackIndex.size();i++){
+        const int p = fallbackIndex.at(i);
+        fallbackBatch.x[i] = batch.x.at(p);
+        fallbackBatch.y[i] = batch.y.at(p);
+        fallbackBatch.z[i] = batch.z.at(p);
+        fallbackBatch.evalElevation[i] = batch.evalElevation.at(p);
+    }
+
+    m_wave->GetKinematicsBatch(fallbackBatch, time, m_def.depth, m_def.stretchingType);
+
+    for (int i=0;i<fallbackIndex.size();i++){
+        const int p = fallbackIndex.at(i);
+        batch.elevation[p] = fallbackBatch.elevation.at(i);
+        batch.velX[p] = fallbackBatch.velX.at(i);
+        batch.velY[p] = fallbackBatch.velY.at(i);
+        batch.velZ[p] = fallbackBatch.velZ.at(i);
+        batch.accX[p] = fallbackBatch.accX.at(i);
+        batch.accY[p] = fallbackBatch.accY.at(i);
+        batch.accZ[p] = fallbackBatch.accZ.at(i);
+        batch.dynP[p] = fallbackBatch.dynP.at(i);
+    }
+}
+
+double WaveKinematicsGrid::CheckAccuracy(int numSamples){
+
+    // compares the interpolated field to the exact sum over the wave trains at random positions and times
+    // inside of the grid; the errors are normalized with the max. magnitude of each quantity. Samples that
+    // are wet for one and dry for the other evaluation (i.e. within the elevation error) are not compared.
+
+    if (!m_data) return 0;
+
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+
+    const int numTimes = 20;
+    const int numPerTime = std::max(1, numSamples / numTimes);
+    const float zTop = std::max(m_def.zMax, 0.0f) + m_def.dz;
+
+    double maxElev = 0, maxVel = 0, maxAcc = 0, maxDynP = 0;
+    double errElev = 0, errVel = 0, errAcc = 0, errDynP = 0;
+
+    LinearWave::KinematicsBatch exact, interpolated;
+
+    for (int n=0;n<numTimes;n++){
+
+        const float time = m_def.tMin + uniform(generator) * (m_def.tMax - m_def.tMin);
+
+        exact.Resize(numPerTime);
+        for (int p=0;p<numPerTime;p++){
+            exact.x[p] = m_def.xMin + uniform(generator) * (m_def.xMax - m_def.xMin);
+            exact.y[p] = m_def.yMin + uniform(generator) * (m_def.yMax - m_def.yMin);
+            exact.z[p] = m_def.zMin + uniform(generator) * (zTop - m_def.zMin);
+            exact.evalElevation[p] = 1;
+        }
+        interpolated = exact;
+
+        m_wave->GetKinematicsBatch(exact, time, m_def.depth, m_def.stretchingType);
+        Evaluate(interpolated, time);
+
+        for (int p=0;p<numPerTime;p++){
+
+            maxElev = std::max<double>(maxElev, fabs(exact.elevation.at(p)));
+            errElev = std::max<double>(errElev, fabs(exact.elevation.at(p) - interpolated.elevation.at(p)));
+
+            const bool wetExact = exact.z.at(p) <= exact.elevation.at(p);
+            const bool wetInterpolated = interpolated.z.at(p) <= interpolated.elevation.at(p);
+            if (m_def.stretchingType != NOSTRETCHING && wetExact != wetInterpolated) continue;
+
+            Vec3 vE(exact.velX.at(p), exact.velY.at(p), exact.velZ.at(p));
+            Vec3 vI(interpolated.velX.at(p), interpolated.velY.at(p), interpolated.velZ.at(p));
+            Vec3 aE(exact.accX.at(p), exact.accY.at(p), exact.accZ.at(p));
+            Vec3 aI(interpolated.accX.at(p), interpolated.accY.at(p), interpolated.accZ.at(p));
+
+            maxVel = std::max<double>(maxVel, vE.VAbs());
+            errVel = std::max<double>(errVel, (vE - vI).VAbs());
+            maxAcc = std::max<double>(maxAcc, aE.VAbs());
+            errAcc = std::max<double>(errAcc, (aE - aI).VAbs());
+            maxDynP = std::max<double>(maxDynP, fabs(exact.dynP.at(p)));
+            errDynP = std::max<double>(errDynP, fabs(exact.dynP.at(p) - interpolated.dynP.at(p)));
+        }
+    }
+
+    if (maxElev > 0) errElev /= maxElev;
+    if (maxVel > 0) errVel /= maxVel;
+    if (maxAcc > 0) errAcc /= maxAcc;
+    if (maxDynP > 0) errDynP /= maxDynP;
+
+    qDebug().noquote() << "...wave kinematics grid max. rel. error: elevation" << QString().number(errElev,'e',2) << "; velocity" << QString().number(errVel,'e',2)
+                       << "; acceleration" << QString().number(errAcc,'e',2) << "; dyn. pressure" << QString().number(errDynP,'e',2);
+
+    return std::max(std::max(errElev, errVel), std::max(errAcc, errDynP));
+}
@@ -0,0 +1,94 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef WAVEKINEMATICSGRID_H
+#define WAVEKINEMATICSGRID_H
+
+#include <QVector>
+#include <QString>
+#include <QFile>
+#include "LinearWave.h"
+
+// Precomputed wave kinematics on a regular (x,y,z) grid x time. The unstretched kinematics (velocity,
+// acceleration and dynamic pressure head) are stored on the 3D grid and the surface elevation on the
+// 2D (x,y) grid, for every grid timestep. Evaluations interpolate the field (quadrilinear or
+// Catmull-Rom cubic in x,y,z and t), the wave stretching is applied at the evaluation point with the
+// interpolated elevation, exactly as in LinearWave::GetKinematicsBatch(). Positions or times outside
+// of the grid are evaluated from the wave trains.
+// The field is written to a cache file that is memory mapped; the file name is a hash of the wave
+// trains and the grid definition, so that simulations with the same sea state (e.g. the wind seeds
+// of a load case) reuse the field without recomputation. The cache lives in the per-user cache
+// location (it survives the removal of the Temp folder) and the least recently used fields are
+// evicted when the cache would exceed WAVEGRID_CACHESIZE_MB.
+
+enum WaveGridInterpolation {WAVEGRID_LINEAR, WAVEGRID_CUBIC};
+
+class WaveKinematicsGrid
+{
+public:
+
+    struct GridDefinition{
+        float xMin = 0, xMax = 0, yMin = 0, yMax = 0, zMin = 0, zMax = 0;
+        float tMin = 0, tMax = 0;
+        float dxy = 5, dz = 2, dt = 0.1;
+        float depth = 100;
+        int stretchingType = 0;
+        int interpolation = WAVEGRID_CUBIC;
+    };
+
+    WaveKinematicsGrid();
+    ~WaveKinematicsGrid();
+
+    static QString GetCacheDirectory();
+
+    bool Build(LinearWave *wave, GridDefinition const &def, QString cacheDirectory = QString());
+    void Evaluate(LinearWave::KinematicsBatch &batch, float time);
+    double CheckAccuracy(int numSamples = 2000);   // max. error of all quantities relative to their max. magnitude
+    void Clear();
+
+    bool IsValid(){ return m_data != NULL; }
+    QString GetCacheFileName(){ return m_cacheFileName; }
+    double GetSizeInMB(){ return double(m_numFloats) * sizeof(float) / 1024.0 / 1024.0; }
+
+private:
+    static const int NUM_FIELDS = 7;    // velX, velY, velZ, accX, accY, accZ, dynP
+
+    struct Stencil{
+        int index[4];
+        float weight[4];
+        int num;
+    };
+
+    QByteArray ComputeHash(LinearWave *wave);
+    bool ReadCacheFile(QString fileName);
+    bool WriteField(QFile *file);
+    void ComputeTimeSlice(int n, float *slice, LinearWave::KinematicsBatch &batch);
+    bool GetStencil(float value, float min, float delta, int num, Stencil &stencil);
+    bool InterpolatePoint(Stencil const &sT, float x, float y, float z, bool evalElevation, float *result);
+
+    LinearWave *m_wave;
+    GridDefinition m_def;
+    int m_nx, m_ny, m_nz, m_nt;
+    qint64 m_sliceSize, m_numFloats;
+
+    const float *m_data;
+    QVector<float> m_memoryData;    // used if no cache file can be written
+    QFile m_cacheFile;
+    QString m_cacheFileName;
+};
+
+#endif // WAVEKINEMATICSGRID_H
@@ -18,6 +18,7 @@
 #include "WindField.h"
 
 #include <cmath>
+#include <algorithm>
 #include <ctime>  // For time()
 #include <cstdlib>  // For srand() and rand()
 #include <limits>
@@ -25,6 +26,12 @@
 #include <GL/gl.h>
 #include <QDebug>
 #include <QDate>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define WINDFIELD_SSE2
+    #include <emmintrin.h>
+#endif
 
 #include "../Serializer.h"
 #include "../GlobalFunctions.h"
@@ -51,6 +58,7 @@ WindField::WindField ()
     m_pen.setColor(g_colorManager.getLeastUsedColor(&g_windFieldStore));
 
     m_shownTimestep = 0;
+    m_resultantVelocity = NULL;
 }
 
 WindField::WindField(ParameterViewer<Parameter::Windfield> *viewer, bool *cancelCalculation)
@@ -145,14 +153,8 @@ WindField::WindField(ParameterViewer<Parameter::Windfield> *viewer, bool *cancel
 	}
 	
 	/* m_resultantVelocity */
-    m_resultantVelocity = new Vec3i**[m_pointsPerSideZ];
-    for (int z = 0; z < m_pointsPerSideZ; ++z) {
-        m_resultantVelocity[z] = new Vec3i*[m_pointsPerSideY];
-        for (int y = 0; y < m_pointsPerSideY; ++y) {
-			// empty paranthesis initialize the whole new array with 0
-            m_resultantVelocity[z][y] = new Vec3i[m_numberOfTimesteps] ();
-		}
-	}
+    m_velocityStorage = WindFieldStorage::allocate(m_pointsPerSideZ, m_pointsPerSideY, m_numberOfTimesteps);
+    m_resultantVelocity = m_velocityStorage->data();
 }
 
 NewCurve* WindField::newCurve (QString xAxis, QString yAxis, NewGraph::GraphType graphType){
@@ -232,14 +234,8 @@ WindField::~WindField() {
     delete [] m_yCoordinatesNormalized;
 	delete [] m_timeAtTimestep;
 	delete [] m_meanWindSpeedAtHeigth;
-	
-    for (int z = 0; z < m_pointsPerSideZ; ++z) {
-        for (int y = 0; y < m_pointsPerSideY; ++y) {
-			delete [] m_resultantVelocity[z][y];
-		}
-		delete [] m_resultantVelocity[z];
-	}
-	delete [] m_resultantVelocity;
+
+    // the velocity storage is released with the last wind field that uses it
 }
 
 QStringList WindField::prepareMissingObjectMessage() {
@@ -334,10 +330,10 @@ void WindField::render(int component) {
         for (y = 0; y < m_pointsPerSideY; ++y) {
 
 			/* normalized to [0,1] */
-            if (component == 0) normalized = (convertX(m_resultantVelocity[z][y][m_shownTimestep].x) - m_minValueX) / difference;
-            if (component == 1) normalized = (convertY(m_resultantVelocity[z][y][m_shownTimestep].y) - m_minValueY) / difference;
-            if (component == 2) normalized = (convertZ(m_resultantVelocity[z][y][m_shownTimestep].z) - m_minValueZ) / difference;
-//            normalized = (convertX(m_resultantVelocity[z][y][m_shownTimestep].x)) / m_maxValueX;
+            if (component == 0) normalized = (convertX(velocityAt(z,y,m_shownTimestep).x) - m_minValueX) / difference;
+            if (component == 1) normalized = (convertY(velocityAt(z,y,m_shownTimestep).y) - m_minValueY) / difference;
+            if (component == 2) normalized = (convertZ(velocityAt(z,y,m_shownTimestep).z) - m_minValueZ) / difference;
+//            normalized = (convertX(velocityAt(z,y,m_shownTimestep).x)) / m_maxValueX;
 
 			hs.h = (1-normalized)*225;
 			
@@ -346,10 +342,10 @@ void WindField::render(int component) {
             glVertex3f (m_yCoordinatesNormalized[y] * scaleY, m_zCoordinatesNormalized[z] * scaleZ, 2*normalized*scaleZ);
 			
 			
-            if (component == 0) normalized = (convertX(m_resultantVelocity[z+1][y][m_shownTimestep].x) - m_minValueX) / difference;
-            if (component == 1) normalized = (convertY(m_resultantVelocity[z+1][y][m_shownTimestep].y) - m_minValueY) / difference;
-            if (component == 2) normalized = (convertZ(m_resultantVelocity[z+1][y][m_shownTimestep].z) - m_minValueZ) / difference;
-//            normalized = (convertX(m_resultantVelocity[z+1][y][m_shownTimestep].x)) / m_maxValueX;
+            if (component == 0) normalized = (convertX(velocityAt(z+1,y,m_shownTimestep).x) - m_minValueX) / difference;
+            if (component == 1) normalized = (convertY(velocityAt(z+1,y,m_shownTimestep).y) - m_minValueY) / difference;
+            if (component == 2) normalized = (convertZ(velocityAt(z+1,y,m_shownTimestep).z) - m_minValueZ) / difference;
+//            normalized = (convertX(velocityAt(z+1,y,m_shownTimestep).x)) / m_maxValueX;
 
 			hs.h = (1-normalized)*225;
 			
@@ -368,16 +364,16 @@ void WindField::render(int component) {
 		glEnable(GL_POLYGON_OFFSET_FILL);  // polygons get a reduced Z-value. Now the grid is drawn onto the WindField surface
 		glPolygonOffset(-2, -2);
         for (y = 0; y < m_pointsPerSideY; ++y) {
-            if (component == 0) normalized = (convertX(m_resultantVelocity[z][y][m_shownTimestep].x) - m_minValueX) / difference;
-            if (component == 1) normalized = (convertY(m_resultantVelocity[z][y][m_shownTimestep].y) - m_minValueY) / difference;
-            if (component == 2) normalized = (convertZ(m_resultantVelocity[z][y][m_shownTimestep].z) - m_minValueZ) / difference;
-//            normalized = (convertX(m_resultantVelocity[z][y][m_shownTimestep].x)) / m_maxValueX;
+            if (component == 0) normalized = (convertX(velocityAt(z,y,m_shownTimestep).x) - m_minValueX) / difference;
+            if (component == 1) normalized = (convertY(velocityAt(z,y,m_shownTimestep).y) - m_minValueY) / difference;
+            if (component == 2) normalized = (convertZ(velocityAt(z,y,m_shownTimestep).z) - m_minValueZ) / difference;
+//            normalized = (convertX(velocityAt(z,y,m_shownTimestep).x)) / m_maxValueX;
             glVertex3f (m_yCoordinatesNormalized[y] * scaleY, m_zCoordinatesNormalized[z] * scaleZ, 2*normalized*scaleZ);
 
-            if (component == 0) normalized = (convertX(m_resultantVelocity[z+1][y][m_shownTimestep].x) - m_minValueX) / difference;
-            if (component == 1) normalized = (convertY(m_resultantVelocity[z+1][y][m_shownTimestep].y) - m_minValueY) / difference;
-            if (component == 2) normalized = (convertZ(m_resultantVelocity[z+1][y][m_shownTimestep].z) - m_minValueZ) / difference;
-//            normalized = (convertX(m_resultantVelocity[z+1][y][m_shownTimestep].x)) / m_maxValueX;
+            if (component == 0) normalized = (convertX(velocityAt(z+1,y,m_shownTimestep).x) - m_minValueX) / difference;
+            if (component == 1) normalized = (convertY(velocityAt(z+1,y,m_shownTimestep).y) - m_minValueY) / difference;
+            if (component == 2) normalized = (convertZ(velocityAt(z+1,y,m_shownTimestep).z) - m_minValueZ) / difference;
+//            normalized = (convertX(velocityAt(z+1,y,m_shownTimestep).x)) / m_maxValueX;
             glVertex3f (m_yCoordinatesNormalized[y] * scaleY, m_zCoordinatesNormalized[z+1] * scaleZ, 2*normalized*scaleZ);
 		}
 		glEnd();
@@ -391,10 +387,10 @@ void WindField::render(int component) {
 		glPolygonOffset(-2, -2);
         for (y = 0; y < m_pointsPerSideY; ++y) {
 			/* normalized to [0,1] */
-            if (component == 0) normalized = (convertX(m_resultantVelocity[z][y][m_shownTimestep].x) - m_minValueX) / difference;
-            if (component == 1) normalized = (convertY(m_resultantVelocity[z][y][m_shownTimestep].y) - m_minValueY) / difference;
-            if (component == 2) normalized = (convertZ(m_resultantVelocity[z][y][m_shownTimestep].z) - m_minValueZ) / difference;
-//            normalized = (convertX(m_resultantVelocity[z][y][m_shownTimestep].x)) / m_maxValueX;
+            if (component == 0) normalized = (convertX(velocityAt(z,y,m_shownTimestep).x) - m_minValueX) / difference;
+            if (component == 1) normalized = (convertY(velocityAt(z,y,m_shownTimestep).y) - m_minValueY) / difference;
+            if (component == 2) normalized = (convertZ(velocityAt(z,y,m_shownTimestep).z) - m_minValueZ) / difference;
+//            normalized = (convertX(velocityAt(z,y,m_shownTimestep).x)) / m_maxValueX;
             glVertex3f (m_yCoordinatesNormalized[y] * scaleY, m_zCoordinatesNormalized[z] * scaleZ, 2*normalized*scaleZ);
 		}
 		glEnd ();
@@ -492,8 +488,8 @@ void WindField::renderForQLLTSim(double time, double dist, double radius, double
         for (y = 0; y < m_pointsPerSideY; ++y) {
             /* normalized to [0,1] */
 
-            normalized = (1-c)*convertX(m_resultantVelocity[z][y][t].x) / m_maxValueX  + (c)*convertX(m_resultantVelocity[z][y][t+1].x) / m_maxValueX ;
-            vel = fabs((1-c)*convertX(m_resultantVelocity[z][y][t].x) / mean + (c)*convertX(m_resultantVelocity[z][y][t+1].x) / mean );
+            normalized = (1-c)*convertX(velocityAt(z,y,t).x) / m_maxValueX  + (c)*convertX(velocityAt(z,y,t+1).x) / m_maxValueX ;
+            vel = fabs((1-c)*convertX(velocityAt(z,y,t).x) / mean + (c)*convertX(velocityAt(z,y,t+1).x) / mean );
             if (!redblue){
             hs.h = (1-vel/fac)*225;
             glColor4d (hsv2rgb(hs).r, hsv2rgb(hs).g, hsv2rgb(hs).b,0.7);
@@ -505,8 +501,8 @@ void WindField::renderForQLLTSim(double time, double dist, double radius, double
             }
             glVertex3f (depth*normalized+dist, m_yCoordinates[y], m_zCoordinates[z]+m_fieldRadius+m_bottomZ);
 
-            normalized = (1-c)*convertX(m_resultantVelocity[z+1][y][t].x) / m_maxValueX  + (c)*convertX(m_resultantVelocity[z+1][y][t+1].x) / m_maxValueX ;
-            vel = fabs((1-c)*convertX(m_resultantVelocity[z+1][y][t].x) / mean  + (c)*convertX(m_resultantVelocity[z+1][y][t+1].x) / mean );
+            normalized = (1-c)*convertX(velocityAt(z+1,y,t).x) / m_maxValueX  + (c)*convertX(velocityAt(z+1,y,t+1).x) / m_maxValueX ;
+            vel = fabs((1-c)*convertX(velocityAt(z+1,y,t).x) / mean  + (c)*convertX(velocityAt(z+1,y,t+1).x) / mean );
 
             if (!redblue){
             hs.h = (1-vel/fac)*225;
@@ -530,10 +526,10 @@ void WindField::renderForQLLTSim(double time, double dist, double radius, double
         glEnable(GL_POLYGON_OFFSET_FILL);  // polygons get a reduced Z-value. Now the grid is drawn onto the WindField surface
         glPolygonOffset(-2, -2);
         for (y = 0; y < m_pointsPerSideY; ++y) {
-            normalized = (1-c)*convertX(m_resultantVelocity[z][y][t].x) / m_maxValueX + (c)*convertX(m_resultantVelocity[z][y][t+1].x) / m_maxValueX;
+            normalized = (1-c)*convertX(velocityAt(z,y,t).x) / m_maxValueX + (c)*convertX(velocityAt(z,y,t+1).x) / m_maxValueX;
 
             glVertex3f (depth*normalized+dist, m_yCoordinates[y], m_zCoordinates[z]+m_fieldRadius+m_bottomZ);
-            normalized = fabs((1-c)*convertX(m_resultantVelocity[z+1][y][t].x) / m_maxValueX+(c) * convertX(m_resultantVelocity[z+1][y][t+1].x) / m_maxValueX);
+            normalized = fabs((1-c)*convertX(velocityAt(z+1,y,t).x) / m_maxValueX+(c) * convertX(velocityAt(z+1,y,t+1).x) / m_maxValueX);
 
             glVertex3f (depth*normalized+dist, m_yCoordinates[y], m_zCoordinates[z+1]+m_fieldRadius+m_bottomZ);
         }
@@ -548,7 +544,7 @@ void WindField::renderForQLLTSim(double time, double dist, double radius, double
         glPolygonOffset(-2, -2);
         for (y = 0; y < m_pointsPerSideY; ++y) {
             /* normalized to [0,1] */
-            normalized = (1-c)*convertX(m_resultantVelocity[z][y][t].x) / m_maxValueX + (c)*convertX(m_resultantVelocity[z][y][t+1].x) / m_maxValueX;
+            normalized = (1-c)*convertX(velocityAt(z,y,t).x) / m_maxValueX + (c)*convertX(velocityAt(z,y,t+1).x) / m_maxValueX;
 
             glVertex3f (depth*normalized+dist, m_yCoordinates[y], m_zCoordinates[z]+m_fieldRadius+m_bottomZ);
         }
@@ -608,19 +604,23 @@ void WindField::exportToBinary(QDataStream &dataStream) {
 		dataStream << qint8(infoByteArray[i]);
 	}
 	
-    /* write the velocity values */
+    /* write the velocity values, the storage has the layout of the file so that whole slabs are written */
 	for (int timestep = 0; timestep < m_numberOfTimesteps; ++timestep) {
+        if (WindFieldStorage::canMapBinaryFiles()) {
+            dataStream.writeRawData((const char *) &velocityAt(0,0,timestep), m_pointsPerSideZ*m_pointsPerSideY*sizeof(Vec3i));
+            continue;
+        }
         for (int zIndex = 0; zIndex < m_pointsPerSideZ; ++zIndex) {
             for (int yIndex = 0; yIndex < m_pointsPerSideY; ++yIndex) {
-                dataStream << qint16(m_resultantVelocity[zIndex][yIndex][timestep].x) <<
-                              qint16(m_resultantVelocity[zIndex][yIndex][timestep].y) <<
-                              qint16(m_resultantVelocity[zIndex][yIndex][timestep].z);
+                dataStream << qint16(velocityAt(zIndex,yIndex,timestep).x) <<
+                              qint16(velocityAt(zIndex,yIndex,timestep).y) <<
+                              qint16(velocityAt(zIndex,yIndex,timestep).z);
 			}
 		}
 	}
 }
 
-void WindField::importFromBinary(QDataStream &dataStream) {
+void WindField::importFromBinary(QDataStream &dataStream, bool mapFile) {
     qint8 q8;
     qint16 q16;
     qint32 q32;
@@ -635,7 +635,8 @@ void WindField::importFromBinary(QDataStream &dataStream) {
     dataStream >> q32;
     m_pointsPerSideY = q32;
 
-    dataStream >> q32; // placeholder for tower points
+    dataStream >> q32;
+    const int numTowerPoints = q32;  // tower points are not used
 
     dataStream >> q32;
     m_numberOfTimesteps = q32;
@@ -655,15 +656,6 @@ void WindField::importFromBinary(QDataStream &dataStream) {
     dataStream >> qr;
     m_bottomZ = qr;
 
-    // initialize vector matrix
-    m_resultantVelocity = new Vec3i**[m_pointsPerSideZ];
-    for (int z = 0; z < m_pointsPerSideZ; ++z) {
-        m_resultantVelocity[z] = new Vec3i*[m_pointsPerSideY];
-        for (int y = 0; y < m_pointsPerSideY; ++y) {
-            m_resultantVelocity[z][y] = new Vec3i[m_numberOfTimesteps];
-        }
-    }
-
     double range;
 
     dataStream >> qr;
@@ -712,19 +704,33 @@ void WindField::importFromBinary(QDataStream &dataStream) {
         dataStream >> q8;
     }
 
-    for (int timestep = 0; timestep < m_numberOfTimesteps; ++timestep) {
-        for (int zIndex = 0; zIndex < m_pointsPerSideZ; ++zIndex) {
-            for (int yIndex = 0; yIndex < m_pointsPerSideY; ++yIndex) {
-                dataStream >> q16;
-                m_resultantVelocity[zIndex][yIndex][timestep].x = q16;
-                dataStream >> q16;
-                m_resultantVelocity[zIndex][yIndex][timestep].y = q16;
+    // the velocity section has the time major layout of the storage, without tower points it is mapped directly
+
+    QFile *file = qobject_cast<QFile *>(dataStream.device());
+
+    if (mapFile && file && !numTowerPoints)
+        m_velocityStorage = WindFieldStorage::mapFile(file->fileName(), file->pos(), m_pointsPerSideZ, m_pointsPerSideY, m_numberOfTimesteps);
+
+    if (!m_velocityStorage){
+
+        m_velocityStorage = WindFieldStorage::allocate(m_pointsPerSideZ, m_pointsPerSideY, m_numberOfTimesteps);
+        Vec3i *velocity = m_velocityStorage->writableData();
+
+        for (int timestep = 0; timestep < m_numberOfTimesteps; ++timestep) {
+            for (int zIndex = 0; zIndex < m_pointsPerSideZ; ++zIndex) {
+                for (int yIndex = 0; yIndex < m_pointsPerSideY; ++yIndex) {
+                    dataStream >> velocity->x >> velocity->y >> velocity->z;
+                    velocity++;
+                }
+            }
+            for (int i = 0; i < 3*numTowerPoints; ++i) {
                 dataStream >> q16;
-                m_resultantVelocity[zIndex][yIndex][timestep].z = q16;
             }
         }
     }
 
+    m_resultantVelocity = m_velocityStorage->data();
+
     // initialize
 
     /* m_yCoordinates */
@@ -810,7 +816,7 @@ void WindField::exportToTxt(QTextStream &stream) {
 	for (int timestep = 0; timestep < m_numberOfTimesteps; ++timestep) {
         for (int zIndex = 0; zIndex < m_pointsPerSideZ; ++zIndex) {
             for (int yIndex = 0; yIndex < m_pointsPerSideY; ++yIndex) {
-                stream << QString("%1 %2 %3").arg(convertX(m_resultantVelocity[zIndex][yIndex][timestep].x), 7, 'f', 3).arg(convertY(m_resultantVelocity[zIndex][yIndex][timestep].y), 7, 'f', 3).arg(convertZ(m_resultantVelocity[zIndex][yIndex][timestep].z), 7, 'f', 3);
+                stream << QString("%1 %2 %3").arg(convertX(velocityAt(zIndex,yIndex,timestep).x), 7, 'f', 3).arg(convertY(velocityAt(zIndex,yIndex,timestep).y), 7, 'f', 3).arg(convertZ(velocityAt(zIndex,yIndex,timestep).z), 7, 'f', 3);
 			}
 			stream << endl;
 		}
@@ -869,7 +875,23 @@ void WindField::serialize() {
 	g_serializer.readOrWriteFloatArray1D (&m_timeAtTimestep, m_numberOfTimesteps);
     g_serializer.readOrWriteFloatArray1D (&m_meanWindSpeedAtHeigth, m_pointsPerSideZ);
 	g_serializer.readOrWriteFloat (&m_meanWindSpeedAtHub);
-    g_serializer.readOrWriteCVectoriArray3D (&m_resultantVelocity, m_pointsPerSideZ, m_pointsPerSideY, m_numberOfTimesteps);
+
+    // the archive keeps the [z][y][time] order of the former nested arrays
+    Vec3i *velocities = NULL;
+    if (g_serializer.isReadMode()) {
+        m_velocityStorage = WindFieldStorage::allocate(m_pointsPerSideZ, m_pointsPerSideY, m_numberOfTimesteps);
+        velocities = m_velocityStorage->writableData();
+        m_resultantVelocity = velocities;
+    }
+    for (int z = 0; z < m_pointsPerSideZ; ++z) {
+        for (int y = 0; y < m_pointsPerSideY; ++y) {
+            for (int t = 0; t < m_numberOfTimesteps; ++t) {
+                Vec3i velocity = velocityAt(z,y,t);
+                velocity.serialize();
+                if (velocities) velocities[(size_t(t)*m_pointsPerSideZ+z)*m_pointsPerSideY+y] = velocity;
+            }
+        }
+    }
 
     /* new parameters needed for turb-sim windfields */
     g_serializer.readOrWriteFloat (&m_jetHeight);
@@ -995,7 +1017,20 @@ void WindField::calculateWindField() {
 //		qDebug() << "deltaF/2: " << deltaF/2 << " factor: " << psdNormalizationFactor[zIndex];
     }
 
-    #pragma omp parallel private (j, k, sum, S_j, S_diagonal, H) shared (frequency, random, amplitude, phi, psdNormalizationFactor)
+    /* The coherence only depends on the distance between two points, which on the equidistant grid is a
+     * function of the index offsets in y and z alone. The distances are therefore tabulated once for all
+     * Y x Z offsets and for each frequency only these few coherence values have to be evaluated instead of
+     * one per matrix entry. Likewise the PSD term sqrt(S_jj*S_kk) only depends on the heights of j and k.
+     * */
+    float *offsetDistance = new float[pointsInTotal];
+    for (int dz = 0; dz < m_pointsPerSideZ; ++dz) {
+        for (int dy = 0; dy < m_pointsPerSideY; ++dy) {
+            offsetDistance[dz*m_pointsPerSideY+dy] = getDist(m_yCoordinates[dy], m_zCoordinates[dz],
+                                                             m_yCoordinates[0], m_zCoordinates[0]);
+        }
+    }
+
+    #pragma omp parallel private (j, k, sum, S_j, S_diagonal, H) shared (frequency, random, amplitude, phi, psdNormalizationFactor, offsetDistance)
     {
 		/* * * * * * allocate thread private memory * * * * * */
 		int j_y;  // the column in the windfield of point j
@@ -1005,6 +1040,7 @@ void WindField::calculateWindField() {
 		int l;  // refers to the column count within the H matrix
 		float Re;
 		float Im;
+		float offDiagonalSum;  // upper bound for the sum of the coherences in one row of the matrix
 		
 		S_j = new float[pointsInTotal] ();
 		S_diagonal = new float[pointsInTotal] ();
@@ -1014,26 +1050,69 @@ void WindField::calculateWindField() {
 			H[j] = new float[j+1] ();  // lower triangular matrix
         }
 
+		float *coherence = new float[pointsInTotal];  // coherence for each y/z index offset
+		float *psdProduct = new float[m_pointsPerSideZ*m_pointsPerSideZ];  // sqrt(S_jj*S_kk) for each pair of heights
+		float *cosRandom = new float[pointsInTotal];
+		float *sinRandom = new float[pointsInTotal];
+
 		/* * * * * * calculation * * * * * */
         #pragma omp for
 		for (m = 0; m < numberOfFrequencies; ++m) {  // independent loop, therefore parallelized
+			if (*m_cancelCalculation) continue;
+
+			for (int z = 0; z < m_pointsPerSideZ; ++z) {
+				S_diagonal[z] = getPSD(frequency[m], z) * psdNormalizationFactor[z];
+			}
+			for (int zj = 0; zj < m_pointsPerSideZ; ++zj) {
+				for (int zk = 0; zk < m_pointsPerSideZ; ++zk) {
+					psdProduct[zj*m_pointsPerSideZ+zk] = sqrt(S_diagonal[zj] * S_diagonal[zk]);
+				}
+			}
+
+			offDiagonalSum = 0;
+			for (j = 0; j < pointsInTotal; ++j) {
+				coherence[j] = getCoh(frequency[m], offsetDistance[j]);
+				if (j > 0) offDiagonalSum += 4*coherence[j];
+			}
+
+			for (k = 0; k < pointsInTotal; ++k) {
+				cosRandom[k] = cos(random[k][m]);
+				sinRandom[k] = sin(random[k][m]);
+			}
+
+			/* At high frequencies the coherence between neighbouring points vanishes. If all off-diagonal
+			 * terms of a row sum up to less than the float resolution the factorization is the diagonal
+			 * matrix sqrt(S_jj) and the costly Cholesky decomposition can be skipped.
+			 * */
+			if (offDiagonalSum < std::numeric_limits<float>::epsilon()) {
+				j_z = 0; j_y = 0;
+				for (j = 0; j < pointsInTotal; ++j) {
+					const float H_jj = sqrt(S_diagonal[j_z]);
+					Re = H_jj*cosRandom[j];
+					Im = H_jj*sinRandom[j];
+					amplitude[j][m] = sqrt (Re*Re + Im*Im);
+					phi[j][m] = atan2 (Im, Re);
+
+					emit updateProgress();
+					++j_y;
+					if (j_y == m_pointsPerSideY) {
+						j_y = 0;
+						++j_z;
+					}
+				}
+				continue;
+			}
+
 			j_z = 0; j_y = 0;
 			for (j = 0; j < pointsInTotal && ! *m_cancelCalculation; ++j) {
-				if (j_y == 0) {  // calculate new PSD only at new height
-					S_diagonal[j] = getPSD(frequency[m], j_z) * psdNormalizationFactor[j_z];
-				} else {  // otherwise take the last one, because it's the same
-					S_diagonal[j] = S_diagonal[j-1];
-				}
-				
 				k_z = 0; k_y = 0;
 				Re = 0; Im = 0;
 				for (k = 0; k <= j; ++k) {
 					if (j != k) {  // calculate S_jk
-                        S_j[k] = getCoh (frequency[m], getDist(m_yCoordinates[j_y], m_zCoordinates[j_z],
-                                                               m_yCoordinates[k_y], m_zCoordinates[k_z] )
-																	) * sqrt(S_diagonal[j] * S_diagonal[k]);
+						S_j[k] = coherence[(j_z-k_z)*m_pointsPerSideY+abs(j_y-k_y)] *
+								 psdProduct[j_z*m_pointsPerSideZ+k_z];
 					} else {  // calculate S_kk
-						S_j[k] = S_diagonal[k];
+						S_j[k] = S_diagonal[k_z];
 					}
 					sum = 0;
 					if (j != k) {  // calculate H_jk
@@ -1043,13 +1122,13 @@ void WindField::calculateWindField() {
 						H[j][k] = (S_j[k] - sum) / H[k][k];
 					} else {  // calculate H_kk
 						for (l = 0; l <= k-1; ++l) {
-							sum = pow(H[k][l],2) + sum;
+							sum = H[k][l]*H[k][l] + sum;
 						}
 						H[k][k] = sqrt(S_j[k] - sum);
 					}
 					
-					Re = Re + (H[j][k]*cos(random[k][m]));
-					Im = Im + (H[j][k]*sin(random[k][m]));
+					Re = Re + H[j][k]*cosRandom[k];
+					Im = Im + H[j][k]*sinRandom[k];
 					++k_y;
                     if (k_y == m_pointsPerSideY) {
 						k_y = 0;
@@ -1057,7 +1136,7 @@ void WindField::calculateWindField() {
 					}
 				}  // for k
 				
-				amplitude[j][m] = sqrt (pow(Re,2) + pow(Im,2));
+				amplitude[j][m] = sqrt (Re*Re + Im*Im);
 				phi[j][m] = atan2 (Im, Re);
 				
 				emit updateProgress();
@@ -1076,8 +1155,14 @@ void WindField::calculateWindField() {
 			delete [] H[j];
 		}
 		delete [] H;
+		delete [] coherence;
+		delete [] psdProduct;
+		delete [] cosRandom;
+		delete [] sinRandom;
     }  // omp parallel END
 
+    delete [] offsetDistance;
+
 
     Vec3f*** tempVelocity = new Vec3f**[m_pointsPerSideZ];
     for (int z = 0; z < m_pointsPerSideZ; ++z) {
@@ -1088,39 +1173,55 @@ void WindField::calculateWindField() {
     }
 
 	/* * * * * * superposition of frequencies * * * * * */
+	/* The time series at each point is the sum over all frequencies of 2*A*cos(2*pi*f_m*t_n - phi).
+	 * With f_m = (m+1)/T and t_n = n*T/(N-1) the argument equals 2*pi*(m+1)*n/(N-1), so the sum is the real
+	 * part of an inverse DFT of length N-1 with the coefficients 2*A*exp(-i*phi) placed in bin m+1. The last
+	 * timestep coincides with the first one, as the series is periodic in T.
+	 * */
 	if (! *m_cancelCalculation)
 	{
-		int z = 0;  // the row (or height) in the windfield
-		int y = 0;  // the column in the windfield
-		int t = 0;  // refers to the timesteps
-		for (j = 0; j < pointsInTotal && ! *m_cancelCalculation; ++j) {  // for every point j
-			for (t = 0; t < m_numberOfTimesteps; ++t) {  // for every timestep t
-				sum = 0;
-				for (m = 0; m < numberOfFrequencies; ++m) {  // for every frequency m
-                    sum = sum + (2*amplitude[j][m]*cos(2*PI_*frequency[m]*m_timeAtTimestep[t]-phi[j][m]));
-				}
-                tempVelocity[z][y][t].x = m_meanWindSpeedAtHeigth[z] + sum;  // store final result
-                tempVelocity[z][y][t].y = 0;
-                tempVelocity[z][y][t].z = 0;
-				
-				/* find the max and min value for the windfield */
-                if (tempVelocity[z][y][t].x < m_minValueX) {
-                    m_minValueX = tempVelocity[z][y][t].x;
-				}
-                if (tempVelocity[z][y][t].x > m_maxValueX) {
-                    m_maxValueX = tempVelocity[z][y][t].x;
-				}
-				emit updateProgress();						
-			}
+		const int fftSize = std::max(m_numberOfTimesteps-1, 1);
 
-			++y;
-            if (y == m_pointsPerSideY) {
-				y = 0;
-				++z;
+        #pragma omp parallel shared (amplitude, phi, tempVelocity)
+        {
+            QVector<std::complex<double> > spectrum (fftSize);
+
+            #pragma omp for
+            for (int p = 0; p < pointsInTotal; ++p) {  // for every point p
+                if (*m_cancelCalculation) continue;
+
+                const int z = p / m_pointsPerSideY;  // the row (or height) in the windfield
+                const int y = p % m_pointsPerSideY;  // the column in the windfield
+
+                spectrum.fill(std::complex<double>(0,0));
+                for (int f = 0; f < numberOfFrequencies; ++f) {  // for every frequency f
+                    spectrum[(f+1) % fftSize] += std::polar(2.0*amplitude[p][f], -double(phi[p][f]));
+                }
+                CalculateFFT(spectrum, true);
+
+                for (int t = 0; t < m_numberOfTimesteps; ++t) {  // for every timestep t
+                    tempVelocity[z][y][t].x = m_meanWindSpeedAtHeigth[z] + spectrum[t % fftSize].real();  // store final result
+                    tempVelocity[z][y][t].y = 0;
+                    tempVelocity[z][y][t].z = 0;
+                }
+                emit updateProgress();
+            }
+        }
+
+		/* find the max and min value for the windfield */
+		for (int z = 0; z < m_pointsPerSideZ; ++z) {
+			for (int y = 0; y < m_pointsPerSideY; ++y) {
+				for (int t = 0; t < m_numberOfTimesteps; ++t) {
+					if (tempVelocity[z][y][t].x < m_minValueX) {
+						m_minValueX = tempVelocity[z][y][t].x;
+					}
+					if (tempVelocity[z][y][t].x > m_maxValueX) {
+						m_maxValueX = tempVelocity[z][y][t].x;
+					}
+				}
 			}
 		}
     }
-
     const float valueRangeX = m_maxValueX - m_minValueX;
     vslopeX = 65535 / valueRangeX;
     vinterceptX = -32768 - vslopeX*m_minValueX;
@@ -1143,12 +1244,14 @@ void WindField::calculateWindField() {
         int z = 0;  // the row (or height) in the windfield
         int y = 0;  // the column in the windfield
         int t = 0;  // refers to the timesteps
+        Vec3i *velocities = m_velocityStorage->writableData();
         for (j = 0; j < pointsInTotal && ! *m_cancelCalculation; ++j) {  // for every point j
             for (t = 0; t < m_numberOfTimesteps; ++t) {  // for every timestep t
 
-                m_resultantVelocity[z][y][t].x = tempVelocity[z][y][t].x*vslopeX+vinterceptX;  // store final result
-                m_resultantVelocity[z][y][t].y = tempVelocity[z][y][t].y*vslopeY+vinterceptY;
-                m_resultantVelocity[z][y][t].z = tempVelocity[z][y][t].z*vslopeZ+vinterceptZ;
+                Vec3i &velocity = velocities[(size_t(t)*m_pointsPerSideZ+z)*m_pointsPerSideY+y];
+                velocity.x = tempVelocity[z][y][t].x*vslopeX+vinterceptX;  // store final result
+                velocity.y = tempVelocity[z][y][t].y*vslopeY+vinterceptY;
+                velocity.z = tempVelocity[z][y][t].z*vslopeZ+vinterceptZ;
             }
 
             ++y;
@@ -1272,19 +1375,79 @@ void WindField::DeleteProbe(int index){
 
 }
 
-Vec3 WindField::getWindspeed(Vec3 vec, double time, bool mirror, bool isAutoFielShift, double shiftTime){
-    double z,y;
-    z = vec.z;
-    y = vec.y;
+void WindField::decodeStencil(const Vec3i **runs, float *velocity){
 
-    z -= m_bottomZ;
-    y += m_fieldDimensionY/2;
+    // same arithmetic as convertX/Y/Z; every run holds two adjacent velocities (6 int16 values) that
+    // are loaded directly, without reading past the run, as the storage might be a mapped file
+
+#ifdef WINDFIELD_SSE2
+    const __m128 i0 = _mm_setr_ps(vinterceptX, vinterceptY, vinterceptZ, vinterceptX);
+    const __m128 i1 = _mm_setr_ps(vinterceptY, vinterceptZ, vinterceptX, vinterceptY);
+    const __m128 s0 = _mm_setr_ps(vslopeX, vslopeY, vslopeZ, vslopeX);
+    const __m128 s1 = _mm_setr_ps(vslopeY, vslopeZ, vslopeX, vslopeY);
+
+    for (int r=0;r<4;r++){
+        const char *run = (const char *) runs[r];
+
+        int last;
+        memcpy(&last, run+8, sizeof(int));
+        const __m128i packed = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *) run), _mm_cvtsi32_si128(last));
+
+        // sign extension of the int16 values to int32
+        const __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(packed,packed),16));
+        const __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(packed,packed),16));
+
+        // the two surplus values of hi are overwritten by the next run
+        _mm_storeu_ps(velocity+6*r, _mm_div_ps(_mm_sub_ps(lo,i0),s0));
+        _mm_storeu_ps(velocity+6*r+4, _mm_div_ps(_mm_sub_ps(hi,i1),s1));
+    }
+#else
+    for (int r=0;r<4;r++){
+        for (int k=0;k<2;k++){
+            velocity[6*r+3*k] = convertX(runs[r][k].x);
+            velocity[6*r+3*k+1] = convertY(runs[r][k].y);
+            velocity[6*r+3*k+2] = convertZ(runs[r][k].z);
+        }
+    }
+#endif
+}
+
+Vec3 WindField::getWindspeed(Vec3 vec, double time, bool mirror, bool isAutoFielShift, double shiftTime){
 
     //here the windfield is marched trhough the domain with the hub height wind speed. initially it is marched through the domain for half a windfield diameter
 
     if (isAutoFielShift) time += (m_fieldDimensionY/2.0 - vec.x) / m_meanWindSpeedAtHub;
     else time += shiftTime;
 
+    time = getFieldTime(time, mirror);
+    const int tindex = getTimeIndex(time);
+
+    return interpolateWindspeed(vec, time, tindex);
+}
+
+void WindField::getWindspeeds(QVector<Vec3> const &positions, QVector<Vec3> &velocities, double time, bool mirror, bool isAutoFielShift, double shiftTime){
+
+    // without the automatic field shift all points share the same field time, so that the time wrapping
+    // and the time index are evaluated only once
+
+    const int num = positions.size();
+    velocities.resize(num);
+
+    int tindex = 0;
+    if (!isAutoFielShift){
+        time = getFieldTime(time+shiftTime, mirror);
+        tindex = getTimeIndex(time);
+    }
+
+    #pragma omp parallel for if (num > 64)
+    for (int i=0;i<num;i++){
+        if (isAutoFielShift) velocities[i] = getWindspeed(positions.at(i), time, mirror, true, shiftTime);
+        else velocities[i] = interpolateWindspeed(positions.at(i), time, tindex);
+    }
+}
+
+double WindField::getFieldTime(double time, bool mirror){
+
     if (time < 0) time = 0;
 
     //mirror windfield, windfields are mirrored at the ends and then pieced together
@@ -1306,6 +1469,31 @@ Vec3 WindField::getWindspeed(Vec3 vec, double time, bool mirror, bool isAutoFiel
 
     }
 
+    return time;
+}
+
+int WindField::getTimeIndex(double &time){
+
+    double temporalwidth = m_simulationTime / (m_numberOfTimesteps-1);
+
+    int tindex = floor(time / temporalwidth);
+
+    if (tindex > (m_numberOfTimesteps-2)){
+        time = m_simulationTime;
+        tindex = (m_numberOfTimesteps-2);
+    }
+
+    return tindex;
+}
+
+Vec3 WindField::interpolateWindspeed(Vec3 const &vec, double time, int tindex){
+    double z,y;
+    z = vec.z;
+    y = vec.y;
+
+    z -= m_bottomZ;
+    y += m_fieldDimensionY/2;
+
     //z is constant above and below the field dimensions
     if ( z > m_fieldDimensionZ) z = m_fieldDimensionZ;
     if ( z < 0) z = 0;
@@ -1331,12 +1519,6 @@ Vec3 WindField::getWindspeed(Vec3 vec, double time, bool mirror, bool isAutoFiel
 
         int zindex = floor(z / spatialwidthZ);
         int yindex = floor(y / spatialwidthY);
-        int tindex = floor(time / temporalwidth);
-        
-        if (tindex > (m_numberOfTimesteps-2)){
-            time = m_simulationTime;
-            tindex = (m_numberOfTimesteps-2);
-        }
 
         if (zindex > (m_pointsPerSideZ-2)){
             zindex = (m_pointsPerSideZ-2);
@@ -1346,29 +1528,37 @@ Vec3 WindField::getWindspeed(Vec3 vec, double time, bool mirror, bool isAutoFiel
             yindex = (m_pointsPerSideY-2);
         }
         
+        // the velocities at (z,y) and (z,y+1) are adjacent in a time slab, the stencil is gathered as four
+        // runs of two velocities and decoded at once
+        const Vec3i *runs[4] = {&velocityAt(zindex,yindex,tindex), &velocityAt(zindex+1,yindex,tindex),
+                                &velocityAt(zindex,yindex,tindex+1), &velocityAt(zindex+1,yindex,tindex+1)};
+
+        float v[26];
+        decodeStencil(runs, v);
+
+        const double dz = z-spatialwidthZ*zindex;
+
         Vec3f mZYfloorTfloor, mZYceiltTfloor, mZYfloorTceil, mZYceiltTceil;
-        
-        mZYfloorTfloor.x = convertX(m_resultantVelocity[zindex][yindex][tindex].x)+(convertX(m_resultantVelocity[zindex+1][yindex][tindex].x)-convertX(m_resultantVelocity[zindex][yindex][tindex].x))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        mZYfloorTfloor.y = convertY(m_resultantVelocity[zindex][yindex][tindex].y)+(convertY(m_resultantVelocity[zindex+1][yindex][tindex].y)-convertY(m_resultantVelocity[zindex][yindex][tindex].y))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        mZYfloorTfloor.z = convertZ(m_resultantVelocity[zindex][yindex][tindex].z)+(convertZ(m_resultantVelocity[zindex+1][yindex][tindex].z)-convertZ(m_resultantVelocity[zindex][yindex][tindex].z))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        
-        mZYceiltTfloor.x = convertX(m_resultantVelocity[zindex][yindex+1][tindex].x)+(convertX(m_resultantVelocity[zindex+1][yindex+1][tindex].x)-convertX(m_resultantVelocity[zindex][yindex+1][tindex].x))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        mZYceiltTfloor.y = convertY(m_resultantVelocity[zindex][yindex+1][tindex].y)+(convertY(m_resultantVelocity[zindex+1][yindex+1][tindex].y)-convertY(m_resultantVelocity[zindex][yindex+1][tindex].y))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        mZYceiltTfloor.z = convertZ(m_resultantVelocity[zindex][yindex+1][tindex].z)+(convertZ(m_resultantVelocity[zindex+1][yindex+1][tindex].z)-convertZ(m_resultantVelocity[zindex][yindex+1][tindex].z))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        
+
+        mZYfloorTfloor.x = v[0]+(v[6]-v[0])*dz/spatialwidthZ;
+        mZYfloorTfloor.y = v[1]+(v[7]-v[1])*dz/spatialwidthZ;
+        mZYfloorTfloor.z = v[2]+(v[8]-v[2])*dz/spatialwidthZ;
+
+        mZYceiltTfloor.x = v[3]+(v[9]-v[3])*dz/spatialwidthZ;
+        mZYceiltTfloor.y = v[4]+(v[10]-v[4])*dz/spatialwidthZ;
+        mZYceiltTfloor.z = v[5]+(v[11]-v[5])*dz/spatialwidthZ;
+
+        mZYfloorTceil.x = v[12]+(v[18]-v[12])*dz/spatialwidthZ;
+        mZYfloorTceil.y = v[13]+(v[19]-v[13])*dz/spatialwidthZ;
+        mZYfloorTceil.z = v[14]+(v[20]-v[14])*dz/spatialwidthZ;
+
+        mZYceiltTceil.x = v[15]+(v[21]-v[15])*dz/spatialwidthZ;
+        mZYceiltTceil.y = v[16]+(v[22]-v[16])*dz/spatialwidthZ;
+        mZYceiltTceil.z = v[17]+(v[23]-v[17])*dz/spatialwidthZ;
+
         Vec3f meanTfloor = mZYfloorTfloor+Vec3f(mZYceiltTfloor-mZYfloorTfloor)*(y-spatialwidthY*yindex)/spatialwidthY;
-        
-        mZYfloorTceil.x = convertX(m_resultantVelocity[zindex][yindex][tindex+1].x)+(convertX(m_resultantVelocity[zindex+1][yindex][tindex+1].x)-convertX(m_resultantVelocity[zindex][yindex][tindex+1].x))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        mZYfloorTceil.y = convertY(m_resultantVelocity[zindex][yindex][tindex+1].y)+(convertY(m_resultantVelocity[zindex+1][yindex][tindex+1].y)-convertY(m_resultantVelocity[zindex][yindex][tindex+1].y))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        mZYfloorTceil.z = convertZ(m_resultantVelocity[zindex][yindex][tindex+1].z)+(convertZ(m_resultantVelocity[zindex+1][yindex][tindex+1].z)-convertZ(m_resultantVelocity[zindex][yindex][tindex+1].z))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        
-        mZYceiltTceil.x = convertX(m_resultantVelocity[zindex][yindex+1][tindex+1].x)+(convertX(m_resultantVelocity[zindex+1][yindex+1][tindex+1].x)-convertX(m_resultantVelocity[zindex][yindex+1][tindex+1].x))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        mZYceiltTceil.y = convertY(m_resultantVelocity[zindex][yindex+1][tindex+1].y)+(convertY(m_resultantVelocity[zindex+1][yindex+1][tindex+1].y)-convertY(m_resultantVelocity[zindex][yindex+1][tindex+1].y))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        mZYceiltTceil.z = convertZ(m_resultantVelocity[zindex][yindex+1][tindex+1].z)+(convertZ(m_resultantVelocity[zindex+1][yindex+1][tindex+1].z)-convertZ(m_resultantVelocity[zindex][yindex+1][tindex+1].z))*(z-spatialwidthZ*zindex)/spatialwidthZ;
-        
         Vec3f meanTceil = mZYfloorTceil+Vec3f(mZYceiltTceil-mZYfloorTceil)*(y-spatialwidthY*yindex)/spatialwidthY;
         
-        
         Vec3f Vint = meanTfloor+Vec3f(meanTceil-meanTfloor)*(time-temporalwidth*tindex)/temporalwidth;
         
         return Vec3(Vint.x,Vint.y,Vint.z);
@@ -1446,9 +1636,9 @@ WindField* WindField::newBySerialize() {
 	return windfield;
 }
 
-WindField *WindField::newByImport(QDataStream &dataStream) {
+WindField *WindField::newByImport(QDataStream &dataStream, bool mapFile) {
 	WindField* windfield = new WindField;
-	windfield->importFromBinary(dataStream);
+	windfield->importFromBinary(dataStream, mapFile);
 
     if (windfield->m_isValid) windfield->PrepareGraphData();
 
@@ -19,12 +19,14 @@
 #define WINDFIELD_H
 
 #include <QTextStream>
+#include <QSharedPointer>
 #include "src/Graph/ShowAsGraphInterface.h"
 #include "../StorableObject.h"
 #include "../Vec3f.h"
 #include "../Vec3.h"
 #include "../ParameterObject.h"
 #include "../ParameterKeys.h"
+#include "WindFieldStorage.h"
 template <class ParameterGroup>
 class ParameterViewer;
 
@@ -35,7 +37,7 @@ class WindField : public StorableObject, public ShowAsGraphInterface, public Par
 	
 public:
 	static WindField* newBySerialize ();
-	static WindField* newByImport (QDataStream &dataStream);
+	static WindField* newByImport (QDataStream &dataStream, bool mapFile = false);
 	WindField (ParameterViewer<Parameter::Windfield> *viewer, bool *cancelCalculation);
 
 	~WindField();
@@ -66,7 +68,14 @@ public:
     float convertY(qint16 y){return float(y-vinterceptY)/vslopeY;}
     float convertZ(qint16 z){return float(z-vinterceptZ)/vslopeZ;}
 
+    const Vec3i &velocityAt(int z, int y, int t) const { return m_resultantVelocity[(size_t(t)*m_pointsPerSideZ+z)*m_pointsPerSideY+y]; }
+
     Vec3 getWindspeed(Vec3 vec, double time, bool mirror, bool isAutoFielShift, double shiftTime);
+    void getWindspeeds(QVector<Vec3> const &positions, QVector<Vec3> &velocities, double time, bool mirror, bool isAutoFielShift, double shiftTime);  // batched getWindspeed()
+    double getFieldTime(double time, bool mirror);  // periodic or mirrored continuation of the field time
+    int getTimeIndex(double &time);  // index of the time slab below time, clamps time in the last interval
+    Vec3 interpolateWindspeed(Vec3 const &vec, double time, int tindex);
+    void decodeStencil(const Vec3i **runs, float *velocity);  // converts the four runs of two velocities of an interpolation stencil
 	
 	void setShownTimestep (int shownTimestep) { m_shownTimestep = shownTimestep; }
 	int getShownTimestep () { return m_shownTimestep; }
@@ -82,7 +91,7 @@ public:
     void render (int component);  // renders WindField with OpenGL
     void renderForQLLTSim(double time, double dist, double radius, double mean, bool redblue, int GlList, bool mirror, bool autoShift, double shiftTime);
 	void exportToBinary (QDataStream &dataStream);  // exports as "FF TurbSim Binary File Grid Format"
-    void importFromBinary(QDataStream &dataStream);  // imports from "FF TurbSim Binary File Grid Format"
+    void importFromBinary(QDataStream &dataStream, bool mapFile = false);  // imports from "FF TurbSim Binary File Grid Format", mapFile maps the velocities instead of reading them
 	void exportToTxt (QTextStream &stream);
 	void serialize();  // override of StorableObject
 	
@@ -147,7 +156,8 @@ public:
 	float* m_timeAtTimestep;  // the discrete resolution of time
 	float* m_meanWindSpeedAtHeigth;  // the windspeed for each point in heigth
 	float m_meanWindSpeedAtHub;  // ~ for the hub heigth that might not be covered by a grid point
-    Vec3i*** m_resultantVelocity;  // 3D array of velocity values at yz-position. Indizes: [z][y][time]
+    QSharedPointer<WindFieldStorage> m_velocityStorage;  // owns (or maps) the velocity values
+    const Vec3i* m_resultantVelocity;  // contiguous velocity values, time major: [time][z][y], use velocityAt()
 
     float vslopeX, vinterceptX, vslopeY, vinterceptY, vslopeZ, vinterceptZ;
 
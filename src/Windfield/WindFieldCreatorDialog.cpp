@@ -666,7 +666,7 @@ void WindFieldCreatorDialog::onCreateButtonClicked() {
         m_cancelCalculation = false;
         m_progressStep = 0;
         m_progressStepShown = 0;
-        const int progressSteps = pow(get<NumberEdit>(P::Points)->getValue(),2) * (get<NumberEdit>(P::Time)->getValue() / get<NumberEdit>(P::TimestepSize)->getValue() + 1) * 1.8;
+        const int progressSteps = pow(get<NumberEdit>(P::Points)->getValue(),2) * (get<NumberEdit>(P::Time)->getValue() / get<NumberEdit>(P::TimestepSize)->getValue() / 2 + 1) * 1.1;
         m_progressDialog = new QProgressDialog ("Generating Windfield... please wait", "Cancel", 0, progressSteps+1);
         m_progressDialog->setWindowFlags(Qt::Window | Qt::WindowTitleHint | Qt::CustomizeWindowHint);
         m_progressDialog->setModal(true);
@@ -0,0 +1,109 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#include "WindFieldStorage.h"
+
+#include <QFileInfo>
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QDebug>
+#include <QSysInfo>
+
+static QHash<QString, QWeakPointer<WindFieldStorage> > mappedFiles;
+static QMutex mappedFilesMutex;
+
+WindFieldStorage::WindFieldStorage(){
+    m_data = NULL;
+    m_buffer = NULL;
+    m_numElements = 0;
+}
+
+WindFieldStorage::~WindFieldStorage(){
+    if (m_buffer) delete [] m_buffer;
+    if (m_file.isOpen()) m_file.close();  // also unmaps the file
+}
+
+bool WindFieldStorage::canMapBinaryFiles(){
+    return (QSysInfo::ByteOrder == QSysInfo::LittleEndian);
+}
+
+QSharedPointer<WindFieldStorage> WindFieldStorage::allocate(int numZ, int numY, int numT){
+
+    QSharedPointer<WindFieldStorage> storage(new WindFieldStorage());
+
+    storage->m_numElements = size_t(numZ) * numY * numT;
+    // empty paranthesis initialize the whole new array with 0
+    storage->m_buffer = new Vec3i[storage->m_numElements] ();
+    storage->m_data = storage->m_buffer;
+
+    return storage;
+}
+
+QSharedPointer<WindFieldStorage> WindFieldStorage::mapFile(QString fileName, qint64 offset, int numZ, int numY, int numT){
+
+    if (!canMapBinaryFiles()) return QSharedPointer<WindFieldStorage>();
+
+    QFileInfo info(fileName);
+    if (!info.exists()) return QSharedPointer<WindFieldStorage>();
+
+    const size_t numElements = size_t(numZ) * numY * numT;
+    const qint64 numBytes = qint64(numElements * sizeof(Vec3i));
+
+    if (info.size() < offset + numBytes) return QSharedPointer<WindFieldStorage>();
+
+    // a modified file gets a new key, wind fields that use the old mapping keep it alive
+
+    const QString key = info.canonicalFilePath() + QString(":%1:%2:%3").arg(offset).arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch());
+
+    QMutexLocker locker(&mappedFilesMutex);
+
+    QSharedPointer<WindFieldStorage> storage = mappedFiles.value(key).toStrongRef();
+    if (storage) return storage;
+
+    storage = QSharedPointer<WindFieldStorage>(new WindFieldStorage());
+    storage->m_file.setFileName(info.canonicalFilePath());
+
+    if (!storage->m_file.open(QIODevice::ReadOnly)){
+        qDebug().noquote() << "Windfield: could not open" << fileName << "for mapping";
+        return QSharedPointer<WindFieldStorage>();
+    }
+
+    uchar *mapped = storage->m_file.map(offset, numBytes);
+
+    // the int16 values must be 2 byte aligned, this depends on the length of the info string
+
+    if (!mapped || (quintptr(mapped) % sizeof(qint16))){
+        if (mapped) storage->m_file.unmap(mapped);
+        storage->m_file.close();
+        return QSharedPointer<WindFieldStorage>();
+    }
+
+    storage->m_data = reinterpret_cast<const Vec3i *>(mapped);
+    storage->m_numElements = numElements;
+
+    QList<QString> keys = mappedFiles.keys();
+    for (int i=0;i<keys.size();i++)
+        if (!mappedFiles.value(keys.at(i))) mappedFiles.remove(keys.at(i));
+
+    mappedFiles.insert(key, storage.toWeakRef());
+
+    qDebug().noquote() << "Windfield: mapped" << storage->getSizeInMB() << "MB of" << info.fileName();
+
+    return storage;
+}
@@ -0,0 +1,58 @@
+/**********************************************************************
+
+    Copyright (C) 2026 The QBlade Contributors
+
+    This program is licensed under the Academic Public License
+    (APL) v1.0; You can use, redistribute and/or modify it in
+    non-commercial academic environments under the terms of the
+    APL as published by the QBlade project; See the file 'LICENSE'
+    for details; Commercial use requires a commercial license
+    (contact info@qblade.org).
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+***********************************************************************/
+
+#ifndef WINDFIELDSTORAGE_H
+#define WINDFIELDSTORAGE_H
+
+#include <QString>
+#include <QFile>
+#include <QSharedPointer>
+#include "../Vec3f.h"
+
+// Contiguous, time major storage of the int16 compressed wind field velocities. One slab holds all
+// grid points of a timestep in the order [z][y] with the three components interleaved, which is the
+// layout of the velocity section of a TurbSim .bts file without tower points. Imported .bts files
+// can therefore be memory mapped instead of being read into RAM; a mapping is read-only and shared
+// between all wind fields that are imported from the same (unmodified) file, the operating system
+// shares the pages between concurrent QBlade processes as well.
+
+Q_STATIC_ASSERT(sizeof(Vec3i) == 3*sizeof(qint16));
+
+class WindFieldStorage
+{
+public:
+    static QSharedPointer<WindFieldStorage> allocate(int numZ, int numY, int numT);
+    static QSharedPointer<WindFieldStorage> mapFile(QString fileName, qint64 offset, int numZ, int numY, int numT);   // returns NULL if the file can't be mapped
+    static bool canMapBinaryFiles();    // the .bts data is little endian
+
+    ~WindFieldStorage();
+
+    const Vec3i *data() const { return m_data; }
+    Vec3i *writableData() { return m_buffer; }   // NULL for mapped storage
+    bool isMapped() const { return m_buffer == NULL; }
+    qint64 getSizeInMB() const { return qint64(m_numElements) * sizeof(Vec3i) / 1024 / 1024; }
+
+private:
+    WindFieldStorage();
+
+    const Vec3i *m_data;
+    Vec3i *m_buffer;
+    QFile m_file;
+    size_t m_numElements;
+};
+
+#endif // WINDFIELDSTORAGE_H